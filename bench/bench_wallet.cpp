@@ -0,0 +1,645 @@
+// Offline benchmarks for wallet hot paths.
+//
+// Usage: bench_wallet [results.json]
+//
+// Results are written as JSON to the given file, or to stdout if none is
+// given, so that runs can be compared across releases. Inputs are derived
+// deterministically so that each run performs identical work. Each result
+// includes the number of heap allocations made per operation.
+//
+// Environment:
+//   GDK_BENCH_FILTER      Only run benchmarks whose names contain this string
+//   GDK_BENCH_MAX_TXS     Largest cache size to benchmark (default 100000)
+//   GDK_BENCH_NUM_OUTPUTS Number of Liquid outputs to blind/unblind (default 500)
+//   GDK_BENCH_NUM_UTXOS   Number of UTXOs in the multisig wallet benchmarks (default 500)
+//   GDK_WAMP_RECORDING    Login recording for the multisig wallet benchmarks
+//                         (default: tests/wamp_standin_recording.json)
+//
+// The multisig wallet benchmarks run a logged in session against an
+// in-process WAMP stand-in, so their timings and allocation counts include
+// the (local) server round trips each operation makes.
+#include "src/assertion.hpp"
+#include "src/auth_handler.hpp"
+#include "src/client_blob.hpp"
+#include "src/ga_auth_handlers.hpp"
+#include "src/ga_cache.hpp"
+#include "src/ga_psbt.hpp"
+#include "src/ga_tx.hpp"
+#include "src/memory.hpp"
+#include "src/network_parameters.hpp"
+#include "src/session.hpp"
+#include "src/session_impl.hpp"
+#include "src/signer.hpp"
+#include "src/transaction_utils.hpp"
+#include "src/utils.hpp"
+#include "tests/wamp_standin.hpp"
+#include "version.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <nlohmann/json.hpp>
+#include <wally_psbt.h>
+
+using namespace green;
+
+// Count heap allocations, to measure allocations per benchmarked operation
+static std::atomic_size_t num_allocs{ 0 };
+
+void* operator new(std::size_t size)
+{
+    ++num_allocs;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+    const std::string BENCH_DATADIR("gdk_bench_data");
+    const std::string MNEMONIC("abandon abandon abandon abandon abandon abandon "
+                               "abandon abandon abandon abandon abandon about");
+
+    static nlohmann::json results = nlohmann::json::array();
+
+    static uint64_t envnum(const char* name, const uint64_t default_)
+    {
+        const auto p = std::getenv(name);
+        return p ? static_cast<uint64_t>(std::strtoull(p, nullptr, 10)) : default_;
+    }
+
+    static bool is_enabled(const std::string& name)
+    {
+        const auto filter = std::getenv("GDK_BENCH_FILTER");
+        return !filter || name.find(filter) != std::string::npos;
+    }
+
+    // Run 'fn', which performs 'ops' operations on a data set of size 'n'.
+    // Returns false if the benchmark is filtered out and so was not run.
+    template <typename FN> static bool run(const std::string& name, size_t n, size_t ops, FN&& fn)
+    {
+        if (!is_enabled(name)) {
+            return false;
+        }
+        using clock = std::chrono::steady_clock;
+        const size_t start_allocs = num_allocs.load();
+        const auto start = clock::now();
+        fn();
+        const auto total_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+        const double ns_per_op = static_cast<double>(total_ns) / ops;
+        const double allocs_per_op = static_cast<double>(num_allocs.load() - start_allocs) / ops;
+        std::cerr << name << " n=" << n << ": " << ops << " ops, " << ns_per_op / 1000.0 << "us/op, "
+                  << allocs_per_op << " allocs/op" << std::endl;
+        results.push_back({ { "name", name }, { "n", n }, { "ops", ops }, { "total_ns", total_ns },
+            { "ns_per_op", ns_per_op }, { "allocs_per_op", allocs_per_op } });
+        return true;
+    }
+
+    // Deterministic 32 byte values, e.g. for keys and blinders
+    static std::array<unsigned char, SHA256_LEN> bytes32(const std::string& label, size_t i)
+    {
+        return sha256(ustring_span(label + std::to_string(i)));
+    }
+
+    static std::vector<unsigned char> p2wpkh_script(size_t i)
+    {
+        std::vector<unsigned char> script{ 0x0, 0x14 };
+        const auto hash = bytes32("script", i);
+        script.insert(script.end(), hash.begin(), hash.begin() + 20);
+        return script;
+    }
+
+    // A synthetic cached transaction, with the fields used by cache queries
+    static nlohmann::json make_tx_json(size_t i)
+    {
+        const int64_t satoshi = 1000 + static_cast<int64_t>(i % 1000) * 1000;
+        nlohmann::json addressee = { { "address", "addr" + std::to_string(i % 5000) } };
+        return { { "block_height", 100 + i }, { "type", i % 3 ? "incoming" : "outgoing" },
+            { "memo", i % 10 ? std::string() : "memo " + std::to_string(i) },
+            { "satoshi", { { "btc", i % 3 ? satoshi : -satoshi } } }, { "inputs", nlohmann::json::array() },
+            { "outputs", nlohmann::json::array({ std::move(addressee) }) } };
+    }
+
+    static void bench_cache(const network_parameters& net_params, size_t n)
+    {
+        const auto wallet_signer = std::make_shared<signer>(
+            net_params, nlohmann::json::object(), nlohmann::json({ { "mnemonic", MNEMONIC } }));
+        const auto encryption_key = bytes32("cache", n);
+        const auto network_name = net_params.network();
+
+        auto db = std::make_unique<cache>(net_params, network_name);
+        db->load_db(encryption_key, wallet_signer);
+
+        const auto insert_txs = [&] {
+            for (size_t i = 0; i < n; ++i) {
+                db->insert_transaction(0, 1000 + i, b2h(bytes32("txid", i)), make_tx_json(i));
+            }
+        };
+        if (!run("cache.insert_transaction", n, n, insert_txs)) {
+            insert_txs(); // Required by the benchmarks below
+        }
+
+        // Page through all txs, as when the user scrolls their tx list
+        run("cache.get_transactions", n, n / 30 + 1, [&] {
+            uint64_t before_ts = std::numeric_limits<int64_t>::max();
+            for (bool more = true; more;) {
+                more = false;
+                db->get_transactions_before(0, before_ts, 30,
+                    [&](uint64_t ts, const std::string&, uint32_t, uint32_t, uint32_t, nlohmann::json&) {
+                        before_ts = ts;
+                        more = true;
+                    });
+            }
+        });
+
+        const size_t num_queries = 100;
+        const std::vector<nlohmann::json> queries = { { { "subaccount", 0 }, { "type", "outgoing" } },
+            { { "subaccount", 0 }, { "asset_id", "btc" }, { "min_satoshi", 500000 }, { "sort_by", "largest" } },
+            { { "subaccount", 0 }, { "memo", "memo 1" }, { "memo_txids", nlohmann::json::array() } },
+            { { "subaccount", 0 }, { "address", "addr42" } } };
+        run("cache.query_transactions", n, num_queries, [&] {
+            for (size_t i = 0; i < num_queries; ++i) {
+                db->query_transactions(queries[i % queries.size()],
+                    [](uint64_t, const std::string&, uint32_t, uint32_t, uint32_t, nlohmann::json&) {});
+            }
+        });
+
+        if (!run("cache.save_db", n, 1, [&] { db->save_db(); })) {
+            db->save_db();
+        }
+
+        db = std::make_unique<cache>(net_params, network_name);
+        run("cache.load_db", n, 1, [&] { db->load_db(encryption_key, wallet_signer); });
+        GDK_RUNTIME_ASSERT(db->get_latest_transaction_timestamp(0) == 1000 + n - 1);
+    }
+
+    struct blinded_output {
+        std::array<unsigned char, ASSET_GENERATOR_LEN> generator;
+        std::vector<unsigned char> commitment;
+        std::vector<unsigned char> nonce_commitment;
+        std::vector<unsigned char> rangeproof;
+        std::vector<unsigned char> surjectionproof;
+        std::vector<unsigned char> script;
+    };
+
+    // Blind n outputs to 'blinding_pubkey', spending a single input of the same asset
+    static std::vector<blinded_output> make_blinded_outputs(size_t n, byte_span_t blinding_pubkey)
+    {
+        const auto asset = bytes32("asset", 0);
+        const auto input_abf = bytes32("input_abf", 0);
+        const auto input_generator = asset_generator_from_bytes(asset, input_abf);
+
+        std::vector<blinded_output> outputs(n);
+        for (size_t i = 0; i < n; ++i) {
+            auto& output = outputs[i];
+            const uint64_t satoshi = 1000 + i;
+            const auto abf = bytes32("abf", i);
+            const auto vbf = bytes32("vbf", i);
+            const auto ephemeral_key = bytes32("ephemeral", i);
+            output.script = p2wpkh_script(i);
+            output.generator = asset_generator_from_bytes(asset, abf);
+            output.commitment = asset_value_commitment(satoshi, vbf, output.generator);
+            output.nonce_commitment = ec_public_key_from_private_key(ephemeral_key);
+            output.rangeproof = asset_rangeproof(satoshi, blinding_pubkey, ephemeral_key, asset, abf, vbf,
+                output.commitment, output.script, output.generator);
+            output.surjectionproof = asset_surjectionproof(
+                asset, abf, output.generator, bytes32("entropy", i), asset, input_abf, input_generator);
+        }
+        return outputs;
+    }
+
+    static void bench_unblinding(const std::vector<blinded_output>& outputs, byte_span_t blinding_key)
+    {
+        const size_t n = outputs.size();
+        run("unblind.output", n, n, [&] {
+            for (size_t i = 0; i < n; ++i) {
+                const auto& output = outputs[i];
+                const auto unblinded = asset_unblind(blinding_key, output.rangeproof, output.commitment,
+                    output.nonce_commitment, output.script, output.generator);
+                GDK_RUNTIME_ASSERT(std::get<3>(unblinded) == 1000 + i);
+            }
+        });
+    }
+
+    // A tx with n p2wpkh inputs and n outputs, blinded if outputs are given
+    static Tx make_tx(size_t n, bool is_liquid, const std::vector<blinded_output>& outputs)
+    {
+        Tx tx(0, WALLY_TX_VERSION_2, is_liquid);
+        for (size_t i = 0; i < n; ++i) {
+            tx.add_input(bytes32("txid", i), i % 4, 0xfffffffd, {});
+            if (!is_liquid) {
+                tx.add_output(1000 + i, p2wpkh_script(i));
+            } else {
+                const auto& output = outputs.at(i);
+                tx.add_elements_output_at(i, output.script, output.generator, output.commitment,
+                    output.nonce_commitment, output.surjectionproof, output.rangeproof);
+            }
+        }
+        return tx;
+    }
+
+    static void bench_signing(size_t n)
+    {
+        const Tx tx = make_tx(n, false, {});
+        std::vector<std::vector<unsigned char>> ders(n);
+        run("sign.p2wpkh_input", n, n, [&] {
+            for (size_t i = 0; i < n; ++i) {
+                const auto private_key = bytes32("signing_key", i);
+                const auto pubkey = ec_public_key_from_private_key(private_key);
+                // Script code for p2wpkh is the p2pkh script of the key hash
+                const auto script = scriptpubkey_p2pkh_from_hash160(hash160(pubkey));
+
+                std::array<unsigned char, SHA256_LEN> sighash;
+                GDK_VERIFY(wally_tx_get_btc_signature_hash(tx.get(), i, script.data(), script.size(), 1000 + i,
+                    WALLY_SIGHASH_ALL, WALLY_TX_FLAG_USE_WITNESS, sighash.data(), sighash.size()));
+                ders[i] = ec_sig_to_der(ec_sig_from_bytes(private_key, sighash));
+            }
+        });
+    }
+
+    static void bench_psbt(size_t n, bool is_liquid, const std::vector<blinded_output>& outputs)
+    {
+        const Tx tx = make_tx(n, is_liquid, outputs);
+        struct wally_psbt* p;
+        const uint32_t flags = is_liquid ? WALLY_PSBT_INIT_PSET : 0;
+        const uint32_t version = is_liquid ? WALLY_PSBT_VERSION_2 : WALLY_PSBT_VERSION_0;
+        GDK_VERIFY(wally_psbt_from_tx(tx.get(), version, flags, &p));
+        char* base64;
+        const int ret = wally_psbt_to_base64(p, 0, &base64);
+        wally_psbt_free(p);
+        GDK_VERIFY(ret);
+        const std::string psbt_base64 = make_string(base64);
+
+        const size_t num_round_trips = 100;
+        run(is_liquid ? "psbt.round_trip_liquid" : "psbt.round_trip", n, num_round_trips, [&] {
+            for (size_t i = 0; i < num_round_trips; ++i) {
+                Psbt psbt(psbt_base64, is_liquid);
+                GDK_RUNTIME_ASSERT(psbt.extract().get_num_outputs() == n);
+                GDK_RUNTIME_ASSERT(!psbt.to_base64(false).empty());
+            }
+        });
+    }
+
+    // A handler making a single blinding nonces request, which is resolved
+    // on the host by auto_auth_handler as when syncing txs for a software wallet
+    struct blinding_nonces_handler final : public auth_handler {
+        blinding_nonces_handler(std::shared_ptr<signer> signer, nlohmann::json request)
+            : m_signer(std::move(signer))
+            , m_request(std::move(request))
+            , m_state(state_type::resolve_code)
+        {
+        }
+
+        void request_code(const std::string& /*method*/) override { GDK_RUNTIME_ASSERT(false); }
+        void resolve_code(const std::string& /*code*/) override { GDK_RUNTIME_ASSERT(false); }
+        void resolve_hw_reply(nlohmann::json&& reply) override
+        {
+            m_reply = std::move(reply);
+            m_state = state_type::done;
+        }
+
+        nlohmann::json get_status() const override { return nlohmann::json(); }
+        state_type get_state() const override { return m_state; }
+        hw_request get_hw_request() const override { return hw_request::get_blinding_nonces; }
+        bool is_data_request() const override { return false; }
+        nlohmann::json& get_twofactor_data() override { return m_request; }
+        const std::string& get_code() const override { return m_code; }
+        nlohmann::json& get_hw_reply() override { return m_reply; }
+        nlohmann::json&& move_result() override { return std::move(m_reply); }
+
+        void operator()() override { GDK_RUNTIME_ASSERT(false); }
+        session_impl& get_session() const override
+        {
+            GDK_RUNTIME_ASSERT(false);
+            __builtin_unreachable();
+        }
+        std::shared_ptr<signer> get_signer() const override { return m_signer; }
+
+    private:
+        std::shared_ptr<signer> m_signer;
+        nlohmann::json m_request;
+        nlohmann::json m_reply;
+        std::string m_code;
+        state_type m_state;
+    };
+
+    static void bench_auth_handler(const network_parameters& net_params, const std::vector<blinded_output>& outputs)
+    {
+        const auto wallet_signer = std::make_shared<signer>(
+            net_params, nlohmann::json::object(), nlohmann::json({ { "mnemonic", MNEMONIC } }));
+        nlohmann::json::array_t scripts, public_keys;
+        for (const auto& output : outputs) {
+            scripts.emplace_back(b2h(output.script));
+            public_keys.emplace_back(b2h(output.nonce_commitment));
+        }
+        const nlohmann::json request = { { "action", "get_blinding_nonces" }, { "blinding_keys_required", false },
+            { "scripts", std::move(scripts) }, { "public_keys", std::move(public_keys) } };
+
+        const size_t n = outputs.size();
+        const size_t num_requests = 20;
+        // Create the handlers up front, so only resolving them is measured
+        std::vector<blinding_nonces_handler*> handlers;
+        for (size_t i = 0; i < num_requests; ++i) {
+            handlers.push_back(new blinding_nonces_handler(wallet_signer, request));
+        }
+        const bool was_run = run("auth_handler.get_blinding_nonces", n, num_requests * n, [&] {
+            for (auto* handler : handlers) {
+                auto_auth_handler call(handler); // Takes ownership
+                call.advance();
+                GDK_RUNTIME_ASSERT(handler->get_hw_reply().at("nonces").size() == n);
+            }
+        });
+        if (!was_run) {
+            std::for_each(handlers.begin(), handlers.end(), [](auto* handler) { delete handler; });
+        }
+    }
+
+    static void bench_client_blob(size_t n)
+    {
+        const auto pubkey = ec_public_key_from_private_key(bytes32("client_blob", 0));
+        client_blob blob;
+        blob.compute_keys(pubkey);
+        nlohmann::json memos = nlohmann::json::object();
+        for (size_t i = 0; i < n; ++i) {
+            memos.emplace(b2h(bytes32("txid", i)), "memo " + std::to_string(i));
+        }
+        blob.update_tx_memos(memos);
+
+        const size_t num_saves = 20;
+        std::pair<std::vector<unsigned char>, nlohmann::json> saved;
+        const auto save_blobs = [&] {
+            for (size_t i = 0; i < num_saves; ++i) {
+                // Modify one memo per save, as happens in normal use
+                blob.set_tx_memo(b2h(bytes32("txid", i)), "updated memo " + std::to_string(i));
+                saved = blob.save();
+            }
+        };
+        if (!run("client_blob.save", n, num_saves, save_blobs)) {
+            save_blobs();
+        }
+
+        const std::string hmac = saved.second.at("hmac");
+        run("client_blob.load", n, num_saves, [&] {
+            for (size_t i = 0; i < num_saves; ++i) {
+                client_blob loaded;
+                loaded.compute_keys(pubkey);
+                loaded.load(saved.first, hmac);
+                GDK_RUNTIME_ASSERT(loaded.get_tx_memo(b2h(bytes32("txid", 0))) == "updated memo 0");
+            }
+        });
+    }
+
+    static nlohmann::json process_auth(auth_handler& handler)
+    {
+        while (true) {
+            const auto status_json = handler.get_status();
+            const std::string status = status_json.at("status");
+            if (status == "error") {
+                throw std::runtime_error(status_json.at("error"));
+            } else if (status == "call") {
+                handler.operator()();
+            } else if (status == "done") {
+                return status_json.at("result");
+            } else {
+                throw std::runtime_error("unexpected status " + status);
+            }
+        }
+    }
+
+    static nlohmann::json load_recording()
+    {
+        const auto p = std::getenv("GDK_WAMP_RECORDING");
+        std::ifstream f(p ? p : GDK_BENCH_RECORDING);
+        GDK_RUNTIME_ASSERT_MSG(f.is_open(), "cannot open recording");
+        return nlohmann::json::parse(f);
+    }
+
+    // A wallet address at the given pointer of the main multisig subaccount
+    static nlohmann::json multisig_address(session_impl& impl, uint32_t pointer)
+    {
+        const nlohmann::json utxo
+            = { { "address_type", "p2wsh" }, { "subaccount", 0 }, { "pointer", pointer }, { "branch", 1 } };
+        auto address = utxo;
+        address["script"] = b2h(impl.output_script_from_utxo(utxo));
+        return address;
+    }
+
+    // Server format UTXOs for n outputs of a single funding tx paying the
+    // wallet, blinded to the wallet for Liquid. Returns the UTXOs and the tx
+    static std::pair<nlohmann::json::array_t, Tx> make_server_utxos(session_impl& impl, size_t n)
+    {
+        const auto& net_params = impl.get_network_parameters();
+        const bool is_liquid = net_params.is_liquid();
+        const auto wallet_signer = impl.get_signer();
+        std::vector<unsigned char> policy_asset;
+        if (is_liquid) {
+            policy_asset = h2b_rev(net_params.get_policy_asset());
+        }
+
+        Tx tx(0, WALLY_TX_VERSION_2, is_liquid);
+        tx.add_input(bytes32("funding", n), 0, 0xfffffffd, {});
+        nlohmann::json::array_t utxos;
+        utxos.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            const uint32_t pointer = i + 1;
+            const auto script = j_bytesref(multisig_address(impl, pointer), "script");
+            const auto scriptpubkey = scriptpubkey_p2sh_p2wsh_from_bytes(script);
+            const uint64_t satoshi = 10000 + i * 100;
+            constexpr uint32_t ga_p2sh_p2wsh_fortified_out = 14;
+            nlohmann::json utxo = { { "pt_idx", i }, { "subaccount", 0 }, { "pointer", pointer },
+                { "script_type", ga_p2sh_p2wsh_fortified_out }, { "block_height", 990 } };
+            if (!is_liquid) {
+                tx.add_output(satoshi, scriptpubkey);
+                utxo["value"] = std::to_string(satoshi);
+            } else {
+                const auto abf = bytes32("utxo_abf", i);
+                const auto vbf = bytes32("utxo_vbf", i);
+                const auto ephemeral_key = bytes32("utxo_ephemeral", i);
+                const auto generator = asset_generator_from_bytes(policy_asset, abf);
+                const auto commitment = asset_value_commitment(satoshi, vbf, generator);
+                const auto nonce_commitment = ec_public_key_from_private_key(ephemeral_key);
+                const auto blinding_pubkey = wallet_signer->get_blinding_pubkey_from_script(scriptpubkey);
+                const auto rangeproof = asset_rangeproof(satoshi, blinding_pubkey, ephemeral_key, policy_asset, abf,
+                    vbf, commitment, scriptpubkey, generator);
+                tx.add_elements_output_at(i, scriptpubkey, generator, commitment, nonce_commitment, {}, rangeproof);
+                utxo.update({ { "asset_tag", b2h(generator) }, { "commitment", b2h(commitment) },
+                    { "nonce_commitment", b2h(nonce_commitment) }, { "range_proof", b2h(rangeproof) },
+                    { "script", b2h(scriptpubkey) } });
+            }
+            utxos.emplace_back(std::move(utxo));
+        }
+        const auto txhash = b2h_rev(tx.get_txid());
+        for (auto& utxo : utxos) {
+            utxo["txhash"] = txhash;
+        }
+        return { std::move(utxos), std::move(tx) };
+    }
+
+    // Fetch, create, blind and sign txs in a multisig wallet with n UTXOs,
+    // logged in to a local stand-in of the Green backend
+    static void bench_multisig_wallet(const std::string& network, size_t n)
+    {
+        wamp_standin standin(load_recording(), 0);
+        auto network_json = network_parameters::get(network);
+        network_json["wamp_url"] = "ws://127.0.0.1:" + std::to_string(standin.start(0)) + "/v2/ws";
+        network_json["wamp_onion_url"] = std::string();
+        network_json["blob_server_url"] = std::string();
+        network_json["blob_server_onion_url"] = std::string();
+        network_parameters::add("bench-" + network, network_json);
+
+        session s;
+        s.connect({ { "name", "bench-" + network } });
+        {
+            const nlohmann::json credentials = { { "mnemonic", MNEMONIC } };
+            auto_auth_handler call(new login_user_call(s, nlohmann::json(), credentials));
+            process_auth(call);
+        }
+        const auto impl = s.get_nonnull_impl();
+        const auto& net_params = impl->get_network_parameters();
+        const bool is_liquid = net_params.is_liquid();
+        const std::string asset_id = is_liquid ? net_params.get_policy_asset() : "btc";
+        const std::string prefix = is_liquid ? "multisig_liquid." : "multisig.";
+
+        // Serve the wallets UTXOs, their funding tx and a change address
+        auto [utxos, funding_tx] = make_server_utxos(*impl, n);
+        standin.set_results("txs.get_all_unspent_outputs", nlohmann::json::array({ std::move(utxos) }));
+        standin.set_results("txs.get_raw_output", nlohmann::json::array({ funding_tx.to_hex() }));
+        const nlohmann::json no_nlocktimes = { { "list", nlohmann::json::array() } };
+        standin.set_results("txs.upcoming_nlocktime", nlohmann::json::array({ no_nlocktimes }));
+        standin.set_results("vault.fund", nlohmann::json::array({ multisig_address(*impl, n + 1) }));
+
+        // Fetch the UTXOs through the API first, which for Liquid also
+        // unblinds and caches them as happens in normal use
+        const nlohmann::json utxo_details = { { "subaccount", 0 }, { "num_confs", 0 } };
+        auto_auth_handler utxo_call(new get_unspent_outputs_call(s, utxo_details));
+        const auto unspent_outputs = process_auth(utxo_call).at("unspent_outputs");
+        GDK_RUNTIME_ASSERT(unspent_outputs.at(asset_id).size() == n);
+
+        // Fetch and clean up the UTXOs, bypassing the sessions UTXO cache
+        const size_t num_fetches = 10;
+        run(prefix + "cleanup_utxos", n, num_fetches, [&] {
+            for (size_t i = 0; i < num_fetches; ++i) {
+                unique_pubkeys_and_scripts_t missing;
+                const auto fetched = impl->get_unspent_outputs(utxo_details, missing);
+                GDK_RUNTIME_ASSERT(fetched.size() == n && missing.empty());
+            }
+        });
+
+        // Pay another wallet address half of the wallets balance, so that
+        // coin selection must choose from many UTXOs and add change
+        const auto wallet_signer = impl->get_signer();
+        const auto pay_to = multisig_address(*impl, n + 2);
+        const auto pay_to_spk = scriptpubkey_p2sh_p2wsh_from_bytes(j_bytesref(pay_to, "script"));
+        auto address = get_address_from_scriptpubkey(net_params, pay_to_spk);
+        if (is_liquid) {
+            const auto blinding_pubkey = wallet_signer->get_blinding_pubkey_from_script(pay_to_spk);
+            address = confidential_addr_from_addr(address, net_params.blinded_prefix(), b2h(blinding_pubkey));
+        }
+        uint64_t total = 0;
+        for (const auto& utxo : unspent_outputs.at(asset_id)) {
+            total += j_amountref(utxo).value();
+        }
+        nlohmann::json addressee = { { "address", address }, { "satoshi", total / 2 } };
+        if (is_liquid) {
+            addressee["asset_id"] = asset_id;
+        }
+        const nlohmann::json create_details = { { "subaccount", 0 }, { "utxos", unspent_outputs },
+            { "fee_rate", 1000 }, { "addressees", nlohmann::json::array({ std::move(addressee) }) } };
+
+        const size_t num_txs = 10;
+        nlohmann::json tx;
+        const auto create_txs = [&] {
+            for (size_t i = 0; i < num_txs; ++i) {
+                auto_auth_handler call(new create_transaction_call(s, create_details));
+                tx = process_auth(call);
+                GDK_RUNTIME_ASSERT_MSG(j_str_is_empty(tx, "error"), j_str_or_empty(tx, "error"));
+            }
+        };
+        if (!run(prefix + "create_transaction", n, num_txs, create_txs)) {
+            create_txs();
+        }
+
+        if (is_liquid) {
+            nlohmann::json blinded;
+            const auto blind_txs = [&] {
+                for (size_t i = 0; i < num_txs; ++i) {
+                    auto_auth_handler call(new blind_transaction_call(s, tx));
+                    blinded = process_auth(call);
+                    GDK_RUNTIME_ASSERT(j_bool_or_false(blinded, "is_blinded"));
+                }
+            };
+            if (!run(prefix + "blind_transaction", n, num_txs, blind_txs)) {
+                blind_txs();
+            }
+            tx = std::move(blinded);
+        }
+
+        const size_t num_inputs = tx.at("transaction_inputs").size();
+        run(prefix + "sign_transaction", num_inputs, num_txs, [&] {
+            for (size_t i = 0; i < num_txs; ++i) {
+                auto_auth_handler call(new sign_transaction_call(s, tx));
+                const auto signed_tx = process_auth(call);
+                GDK_RUNTIME_ASSERT_MSG(j_str_is_empty(signed_tx, "error"), j_str_or_empty(signed_tx, "error"));
+            }
+        });
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::filesystem::remove_all(BENCH_DATADIR);
+    std::filesystem::create_directory(BENCH_DATADIR);
+
+    nlohmann::json init_config;
+    init_config["datadir"] = BENCH_DATADIR;
+    init_config["log_level"] = "none";
+    gdk_init(init_config);
+
+    const network_parameters liquid_params{ network_parameters::get("liquid") };
+
+    const size_t max_txs = envnum("GDK_BENCH_MAX_TXS", 100000);
+    for (size_t n = 1000; n <= max_txs; n *= 10) {
+        bench_cache(liquid_params, n);
+    }
+
+    const size_t num_outputs = envnum("GDK_BENCH_NUM_OUTPUTS", 500);
+    const auto blinding_key = bytes32("blinding_key", 0);
+    const auto blinding_pubkey = ec_public_key_from_private_key(blinding_key);
+    std::vector<blinded_output> outputs;
+    const auto blind_outputs = [&] { outputs = make_blinded_outputs(num_outputs, blinding_pubkey); };
+    if (!run("blind.output", num_outputs, num_outputs, blind_outputs)) {
+        blind_outputs();
+    }
+    bench_unblinding(outputs, blinding_key);
+    bench_auth_handler(liquid_params, outputs);
+    bench_psbt(std::min<size_t>(num_outputs, 100), true, outputs);
+    bench_signing(num_outputs);
+    bench_psbt(100, false, {});
+    bench_client_blob(1000);
+    bench_client_blob(10000);
+
+    const size_t num_utxos = envnum("GDK_BENCH_NUM_UTXOS", 500);
+    bench_multisig_wallet("localtest", num_utxos);
+    bench_multisig_wallet("localtest-liquid", num_utxos);
+
+    std::filesystem::remove_all(BENCH_DATADIR);
+
+    const nlohmann::json output
+        = { { "gdk_commit", GDK_COMMIT }, { "max_txs", max_txs }, { "num_outputs", num_outputs },
+              { "num_utxos", num_utxos }, { "results", std::move(results) } };
+    if (argc > 1) {
+        std::ofstream(argv[1]) << output.dump(2) << std::endl;
+    } else {
+        std::cout << output.dump(2) << std::endl;
+    }
+    return 0;
+}
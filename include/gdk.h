@@ -386,6 +386,22 @@ GDK_API int GA_update_subaccount(struct GA_session* session, GA_json* details, s
  */
 GDK_API int GA_get_transactions(struct GA_session* session, GA_json* details, struct GA_auth_handler** call);
 
+/**
+ * Get a page of the user's transaction history matching the given filters.
+ *
+ * :param session: The session to use.
+ * :param details: :ref:`transactions-query` giving the filters to match.
+ * :param call: Destination for the resulting ``GA_auth_handler`` to perform the query.
+ *
+ * .. note:: The returned ``GA_auth_handler`` should be freed using `GA_destroy_auth_handler`.
+ *
+ * .. note:: ``details`` is emptied when called directly from C or C++.
+ *
+ * .. note:: Matching transactions are returned as :ref:`tx-list`. This call
+ *|     is currently only available for multisig sessions.
+ */
+GDK_API int GA_query_transactions(struct GA_session* session, GA_json* details, struct GA_auth_handler** call);
+
 /**
  * Get a new address to receive coins to.
  *
@@ -502,6 +518,16 @@ GDK_API int GA_get_available_currencies(struct GA_session* session, GA_json** cu
  */
 GDK_API int GA_convert_amount(struct GA_session* session, const GA_json* value_details, GA_json** output);
 
+/**
+ * Convert many satoshi amounts to BTC units and fiat in a single call.
+ *
+ * :param session: The session to use.
+ * :param value_details: :ref:`convert-amounts` giving the values to convert.
+ * :param output: Destination for the converted values :ref:`amounts-data`.
+ *|     Returned GA_json should be freed using `GA_destroy_json`.
+ */
+GDK_API int GA_convert_amounts(struct GA_session* session, const GA_json* value_details, GA_json** output);
+
 /**
  * Encrypt JSON with a server provided key protected by a PIN.
  *
@@ -1137,6 +1163,15 @@ GDK_API int GA_get_networks(GA_json** output);
  */
 GDK_API int GA_get_uniform_uint32_t(uint32_t upper_bound, uint32_t* output);
 
+/**
+ * Get process-wide performance counters and latency histograms.
+ *
+ * :param details: :ref:`get-metrics-details` controlling the metrics returned.
+ * :param output: Destination for the :ref:`metrics`.
+ *|     Returned GA_json should be freed using `GA_destroy_json`.
+ */
+GDK_API int GA_get_metrics(const GA_json* details, GA_json** output);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -7,6 +7,7 @@
 #include "ga_strings.hpp"
 #include "wally_wrapper.h"
 #include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
 #include <nlohmann/json.hpp>
 
 #include "amount.hpp"
@@ -30,10 +31,33 @@ namespace green {
         static const std::vector<std::string> NON_SATOSHI_KEYS{ "btc", "mbtc", "ubtc", "bits", "sats", "fiat",
             "fiat_currency", "fiat_rate", "is_current" };
 
+        // fiat_rate values * satoshi, divided by this, gives fiat cents
+        static const boost::multiprecision::int128_t FIAT_CENTS_DIVISOR("100000000000000");
+
         template <typename T> static std::string fmt(const T& fiat, size_t dp = 2)
         {
             return fiat_type(fiat).str(dp, std::ios_base::fixed | std::ios_base::showpoint);
         }
+
+        // Format the integer 'value' as a decimal with its last 'dp' digits
+        // after the decimal point, e.g. satoshi as BTC with dp=8. This gives
+        // identical output to fmt() for exact values without its overhead.
+        static std::string fmt_fixed(amount::signed_value_type value, size_t dp)
+        {
+            const bool is_negative = value < 0;
+            const auto magnitude = static_cast<amount::value_type>(value);
+            std::string str = std::to_string(is_negative ? 0 - magnitude : magnitude);
+            if (str.size() <= dp) {
+                str.insert(0, dp + 1 - str.size(), '0');
+            }
+            if (dp) {
+                str.insert(str.size() - dp, 1, '.');
+            }
+            if (is_negative) {
+                str.insert(0, 1, '-');
+            }
+            return str;
+        }
     } // namespace
 
     amount::amount(const nlohmann::json& json_value)
@@ -43,6 +67,39 @@ namespace green {
 
     amount::value_type amount::get_max_satoshi() { return SATOSHI_MAX; }
 
+    fiat_rate::fiat_rate(const std::string& rate_str)
+        : m_str(rate_str)
+    {
+        if (!m_str.empty()) {
+            GDK_RUNTIME_ASSERT_MSG(conversion_type(m_str) >= 0, "invalid fiat rate");
+            // Round to 8 DP exactly as format_amount does, i.e. to nearest
+            // with ties to even, then read the digits as a fixed-point value
+            auto rate_8dp = amount::format_amount(m_str, 8);
+            rate_8dp.erase(rate_8dp.size() - 9, 1); // Remove the decimal point
+            m_value = std::stoull(rate_8dp);
+        }
+    }
+
+    std::string fiat_rate::to_fiat(amount::signed_value_type satoshi) const
+    {
+        // Compute in fixed-point, rounding to nearest cent with ties to even
+        // as format_amount does
+        boost::multiprecision::int128_t scaled(satoshi);
+        scaled *= m_value;
+        const bool is_negative = scaled < 0;
+        if (is_negative) {
+            scaled = -scaled;
+        }
+        boost::multiprecision::int128_t cents = scaled / FIAT_CENTS_DIVISOR;
+        const boost::multiprecision::int128_t remainder = (scaled % FIAT_CENTS_DIVISOR) * 2;
+        if (remainder > FIAT_CENTS_DIVISOR || (remainder == FIAT_CENTS_DIVISOR && (cents & 1) != 0)) {
+            ++cents;
+        }
+        const auto fiat = fmt_fixed(cents.convert_to<amount::signed_value_type>(), 2);
+        // Negative amounts which round to zero are returned as "-0.00"
+        return is_negative ? "-" + fiat : fiat;
+    }
+
     // Returns true if "asset_id" is L-BTC for any network
     static bool is_lbtc_asset_id(const std::string& asset_id)
     {
@@ -51,8 +108,19 @@ namespace green {
             || asset_id == "5ac9f65c0efcc4775e0baec4ec03abdde22473cd3cf33c0419ca290e0751b225";
     }
 
+    // Check the upper limit for btc type (ie. non-asset) amounts
+    static void check_btc_limits(amount::signed_value_type satoshi)
+    {
+        if (satoshi > SATOSHI_MAX) {
+            throw user_error(res::id_amount_above_maximum_allowed);
+        }
+        if (satoshi < -SATOSHI_MAX) {
+            throw user_error(res::id_amount_below_minimum_allowed);
+        }
+    }
+
     nlohmann::json amount::convert(
-        const nlohmann::json& amount_json, const std::string& fiat_currency, const std::string& fiat_rate)
+        const nlohmann::json& amount_json, const std::string& fiat_currency, const fiat_rate& rate)
     {
         const auto satoshi_p = amount_json.find("satoshi");
         const auto btc_p = amount_json.find("btc");
@@ -80,13 +148,13 @@ namespace green {
 
         // If either the fiat rate or currency is not available, use any provided values
         // from the amount json instead and indicate that the conversion is out of date
-        const std::string old_fiat_rate = amount_json.value("fiat_rate", std::string());
-        const std::string& fiat_rate_used(fiat_rate.empty() ? old_fiat_rate : fiat_rate);
+        const fiat_rate old_fiat_rate(rate.empty() ? amount_json.value("fiat_rate", std::string()) : std::string());
+        const fiat_rate& fiat_rate_used(rate.empty() ? old_fiat_rate : rate);
 
         const std::string old_fiat_ccy = amount_json.value("fiat_currency", std::string());
         const std::string& fiat_ccy_used(fiat_currency.empty() ? old_fiat_ccy : fiat_currency);
 
-        const bool is_current = !fiat_rate.empty() && !fiat_currency.empty();
+        const bool is_current = !rate.empty() && !fiat_currency.empty();
 
         const conversion_type COIN_VALUE_WITH_PRECISION(std::pow(10, precision));
         signed_value_type satoshi;
@@ -114,26 +182,21 @@ namespace green {
                 throw user_error(res::id_your_favourite_exchange_rate_is);
             }
             const std::string fiat_str = *fiat_p;
-            const conversion_type btc_decimal = conversion_type(fiat_str) / conversion_type(fiat_rate_used);
+            const conversion_type rate_decimal = conversion_type(fiat_rate_used.value()) / COIN_VALUE_DECIMAL;
+            const conversion_type btc_decimal = conversion_type(fiat_str) / rate_decimal;
             satoshi = (btc_type(btc_decimal) * COIN_VALUE_DECIMAL).convert_to<signed_value_type>();
         }
 
         // Check upper limit for btc type (ie. non-asset) inputs
         // Note: an asset_info block indicating btc denomination would have failed key_count check above
         if (!have_asset_info || is_lbtc_asset_id(asset_id)) {
-            if (satoshi > SATOSHI_MAX) {
-                throw user_error(res::id_amount_above_maximum_allowed);
-            }
-            if (satoshi < -SATOSHI_MAX) {
-                throw user_error(res::id_amount_below_minimum_allowed);
-            }
+            check_btc_limits(satoshi);
         }
 
         // Then compute the other denominations and fiat amount
-        const conversion_type satoshi_conv = conversion_type(satoshi);
-        const std::string btc = fmt(btc_type(satoshi_conv / COIN_VALUE_DECIMAL), 8);
-        const std::string mbtc = fmt(btc_type(satoshi_conv / COIN_VALUE_DECIMAL_MBTC), 5);
-        const std::string ubtc = fmt(btc_type(satoshi_conv / COIN_VALUE_DECIMAL_UBTC), 2);
+        const std::string btc = fmt_fixed(satoshi, 8);
+        const std::string mbtc = fmt_fixed(satoshi, 5);
+        const std::string ubtc = fmt_fixed(satoshi, 2);
         const std::string sats = std::to_string(satoshi);
 
         nlohmann::json result = { { "satoshi", satoshi }, { "btc", btc }, { "mbtc", mbtc }, { "ubtc", ubtc },
@@ -141,18 +204,62 @@ namespace green {
             { "fiat_rate", nullptr }, { "is_current", is_current } };
 
         if (!fiat_rate_used.empty()) {
-            result["fiat_rate"] = fiat_rate_used;
-            result["fiat"]
-                = fmt(fiat_type(conversion_type(fiat_rate_used) * conversion_type(satoshi) / COIN_VALUE_DECIMAL));
+            result["fiat_rate"] = fiat_rate_used.str();
+            result["fiat"] = fiat_rate_used.to_fiat(satoshi);
         }
 
         if (have_asset_info) {
-            if (precision == 0) {
-                result[asset_id] = sats;
-            } else {
-                result[asset_id] = fmt(btc_type(satoshi_conv / COIN_VALUE_WITH_PRECISION), precision);
+            result[asset_id] = fmt_fixed(satoshi, precision);
+        }
+        return result;
+    }
+
+    nlohmann::json amount::convert_batch(
+        const nlohmann::json& amounts_json, const std::string& fiat_currency, const fiat_rate& rate)
+    {
+        const auto satoshi_p = amounts_json.find("satoshi");
+        if (satoshi_p == amounts_json.end() || !satoshi_p->is_array()) {
+            throw user_error(res::id_no_amount_specified);
+        }
+
+        // As with convert(), fall back to any provided fiat values
+        const fiat_rate old_fiat_rate(rate.empty() ? amounts_json.value("fiat_rate", std::string()) : std::string());
+        const fiat_rate& fiat_rate_used(rate.empty() ? old_fiat_rate : rate);
+
+        const std::string old_fiat_ccy = amounts_json.value("fiat_currency", std::string());
+        const std::string& fiat_ccy_used(fiat_currency.empty() ? old_fiat_ccy : fiat_currency);
+
+        const bool is_current = !rate.empty() && !fiat_currency.empty();
+        const bool have_fiat = !fiat_rate_used.empty();
+
+        const size_t num_amounts = satoshi_p->size();
+        nlohmann::json::array_t btc, mbtc, ubtc, sats, fiat;
+        btc.reserve(num_amounts);
+        mbtc.reserve(num_amounts);
+        ubtc.reserve(num_amounts);
+        sats.reserve(num_amounts);
+        fiat.reserve(have_fiat ? num_amounts : 0);
+
+        for (const auto& satoshi_json : *satoshi_p) {
+            const auto satoshi = satoshi_json.get<signed_value_type>();
+            check_btc_limits(satoshi);
+            btc.emplace_back(fmt_fixed(satoshi, 8));
+            mbtc.emplace_back(fmt_fixed(satoshi, 5));
+            ubtc.emplace_back(fmt_fixed(satoshi, 2));
+            sats.emplace_back(std::to_string(satoshi));
+            if (have_fiat) {
+                fiat.emplace_back(fiat_rate_used.to_fiat(satoshi));
             }
         }
+
+        nlohmann::json result = { { "satoshi", *satoshi_p }, { "btc", std::move(btc) }, { "mbtc", std::move(mbtc) },
+            { "ubtc", std::move(ubtc) }, { "sats", std::move(sats) }, { "fiat", nullptr },
+            { "fiat_currency", fiat_ccy_used }, { "fiat_rate", nullptr }, { "is_current", is_current } };
+        result["bits"] = result["ubtc"];
+        if (have_fiat) {
+            result["fiat_rate"] = fiat_rate_used.str();
+            result["fiat"] = std::move(fiat);
+        }
         return result;
     }
 
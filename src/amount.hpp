@@ -9,6 +9,8 @@
 
 namespace green {
 
+    class fiat_rate;
+
     class amount final {
     public:
         // Internally, BTC amounts are held as satoshi
@@ -32,7 +34,11 @@ namespace green {
 
         // General purpose conversion to/from fiat
         static nlohmann::json convert(
-            const nlohmann::json& amount_json, const std::string& fiat_currency, const std::string& fiat_rate);
+            const nlohmann::json& amount_json, const std::string& fiat_currency, const fiat_rate& rate);
+
+        // Convert an array of satoshi amounts into arrays of each unit
+        static nlohmann::json convert_batch(
+            const nlohmann::json& amounts_json, const std::string& fiat_currency, const fiat_rate& rate);
 
         // Remove all conversion keys except satoshi
         static void strip_non_satoshi_keys(nlohmann::json& amount_json);
@@ -98,6 +104,28 @@ namespace green {
         value_type m_value;
     };
 
+    // A fiat exchange rate, parsed once into a fixed-point value with 8 DP
+    // so that conversions do not need to re-parse it for every amount.
+    // Rates with more than 8 DP are rounded as amount::format_amount does.
+    class fiat_rate final {
+    public:
+        fiat_rate() = default;
+        explicit fiat_rate(const std::string& rate_str);
+
+        bool empty() const { return m_str.empty(); }
+        // The rate as given when constructed
+        const std::string& str() const { return m_str; }
+        // The rate multiplied by amount::coin_value
+        amount::value_type value() const { return m_value; }
+
+        // Convert a satoshi amount to fiat with 2 DP
+        std::string to_fiat(amount::signed_value_type satoshi) const;
+
+    private:
+        std::string m_str;
+        amount::value_type m_value = 0;
+    };
+
     inline amount operator+(const amount& x, const amount& y)
     {
         amount r = x;
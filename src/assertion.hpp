@@ -3,10 +3,11 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 namespace green {
     [[noreturn]] void runtime_assert_message(const std::string& error_message, const char* file, unsigned int line);
-    [[noreturn]] void throw_user_error(const std::string& error_message);
+    [[noreturn]] void throw_user_error(std::string_view error_message);
 } // namespace green
 
 #ifdef __FILE_NAME__
@@ -20,6 +20,18 @@ namespace green {
         {
             return msg == "Invalid Two Factor Authentication Code";
         }
+
+        // Decode hex into buff, reusing its storage across calls
+        static byte_span_t h2b_reuse(const nlohmann::json& hex, std::vector<unsigned char>& buff)
+        {
+            const auto& hex_str = hex.get_ref<const std::string&>();
+            GDK_RUNTIME_ASSERT(!hex_str.empty() && hex_str.size() % 2 == 0);
+            buff.resize(hex_str.size() / 2);
+            size_t written;
+            GDK_VERIFY(wally_hex_to_bytes(hex_str.c_str(), buff.data(), buff.size(), &written));
+            GDK_RUNTIME_ASSERT(written == buff.size());
+            return buff;
+        }
     } // namespace
 
     //
@@ -242,7 +254,7 @@ namespace green {
             // FIXME: Error if the methods time limit is up or we are rate limited
             if (has_retry_counter() && --m_attempts_remaining == 0) {
                 // No more attempts left, caller should try the action again
-                set_error(res::id_invalid_twofactor_code);
+                set_error(std::string(res::id_invalid_twofactor_code));
             } else {
                 // Caller should try entering the code again
                 m_state = state_type::resolve_code;
@@ -470,8 +482,10 @@ namespace green {
             return false; // Not a HW request, let the caller resolve
         }
 
-        auto status = get_status();
-        auto& required_data = status.at("required_data");
+        // Work on the handlers request data in place rather than on a copy
+        // taken via get_status(): for tx signing and blinding requests this
+        // can be the entire transaction including its inputs and outputs.
+        auto& required_data = handler->get_twofactor_data();
         const bool have_master_blinding_key = signer->has_master_blinding_key();
         // The internal software wallet must have a master blinding key
         GDK_RUNTIME_ASSERT(!signer->is_liquid() || have_master_blinding_key || is_hardware);
@@ -489,23 +503,32 @@ namespace green {
             }
         } else if (have_master_blinding_key && request == hw_request::get_blinding_public_keys) {
             // Host unblinding: generate pubkeys
-            auto& blinding_public_keys = result["public_keys"];
-            for (const auto& script : required_data.at("scripts")) {
-                blinding_public_keys.push_back(b2h(signer->get_blinding_pubkey_from_script(h2b(script))));
+            const auto& scripts = j_arrayref(required_data, "scripts");
+            nlohmann::json::array_t blinding_public_keys;
+            blinding_public_keys.reserve(scripts.size());
+            std::vector<unsigned char> script;
+            for (const auto& script_hex : scripts) {
+                const auto pubkey = signer->get_blinding_pubkey_from_script(h2b_reuse(script_hex, script));
+                blinding_public_keys.emplace_back(b2h(pubkey));
             }
+            result.emplace("public_keys", std::move(blinding_public_keys));
             handler->resolve_hw_reply(std::move(result));
             return true;
         } else if (have_master_blinding_key && request == hw_request::get_blinding_nonces) {
             // Host unblinding: generate nonces
             // As we have the master blinding key, we should not be asked for blinding keys
             GDK_RUNTIME_ASSERT(!required_data.at("blinding_keys_required"));
-            const auto& public_keys = required_data.at("public_keys");
-            const auto& scripts = required_data.at("scripts");
-            auto& nonces = result["nonces"];
+            const auto& public_keys = j_arrayref(required_data, "public_keys");
+            const auto& scripts = j_arrayref(required_data, "scripts", public_keys.size());
+            nlohmann::json::array_t nonces;
+            nonces.reserve(public_keys.size());
+            std::vector<unsigned char> script;
             for (size_t i = 0; i < public_keys.size(); ++i) {
-                const auto blinding_key = signer->get_blinding_key_from_script(h2b(scripts.at(i)));
-                nonces.push_back(b2h(sha256(ecdh(h2b(public_keys.at(i)), blinding_key))));
+                const auto blinding_key = signer->get_blinding_key_from_script(h2b_reuse(scripts[i], script));
+                const auto public_key = h2b<EC_PUBLIC_KEY_LEN>(public_keys[i].get_ref<const std::string&>());
+                nonces.emplace_back(b2h(sha256(ecdh(public_key, blinding_key))));
             }
+            result.emplace("nonces", std::move(nonces));
             handler->resolve_hw_reply(std::move(result));
             return true;
         } else if (have_master_blinding_key && request == hw_request::get_blinding_factors) {
@@ -567,7 +590,7 @@ namespace green {
             const Tx tx(required_data.at("transaction").get<std::string>(), signer->is_liquid());
             result["signatures"] = sign_transaction(get_session(), tx, required_data.at("transaction_inputs"));
         } else {
-            GDK_LOG(warning) << "Unknown hardware request " << status.dump();
+            GDK_LOG(warning) << "Unknown hardware request " << required_data.dump();
             GDK_RUNTIME_ASSERT_MSG(false, "Unknown hardware request");
         }
         handler->resolve_hw_reply(std::move(result));
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <boost/algorithm/string/trim.hpp>
 
 #include "client_blob.hpp"
@@ -27,14 +29,27 @@ namespace green {
         static const std::array<unsigned char, 4> PREFIX{ 1, 0, 0, 0 };
 
         // Increment the blob version number. Returns true as the blob has changed.
-        static bool increment_version(nlohmann::json& data)
+        static bool increment_version(nlohmann::json& version)
         {
-            auto& p = data[USER_VERSION];
-            uint64_t version = p;
-            p = version + 1;
+            version = version.get<uint64_t>() + 1;
             return true;
         }
 
+        // Append a msgpack array header for an array of num_items elements
+        static void append_msgpack_array_header(std::vector<unsigned char>& out, size_t num_items)
+        {
+            if (num_items <= 15) {
+                out.push_back(static_cast<unsigned char>(0x90 | num_items)); // fixarray
+            } else {
+                GDK_RUNTIME_ASSERT(num_items <= 0xffffffff);
+                const int num_bytes = num_items <= 0xffff ? 2 : 4;
+                out.push_back(num_bytes == 2 ? 0xdc : 0xdd); // array 16/array 32
+                for (int shift = (num_bytes - 1) * 8; shift >= 0; shift -= 8) {
+                    out.push_back(static_cast<unsigned char>((num_items >> shift) & 0xff));
+                }
+            }
+        }
+
         // Set a value to a JSON object if it is non-default, otherwise remove any existing value.
         // This saves space storing the value if a default value is returned when its fetched.
         // Returns true if the JSON object was changed.
@@ -78,6 +93,9 @@ namespace green {
         m_key.reset();
         m_hmac_key.reset();
         m_hmac.clear();
+        invalidate_sections();
+        m_unsynced.clear();
+        m_synced_version = 0;
         m_is_outdated = false;
         m_is_modified = false;
         m_requires_merge = false;
@@ -128,6 +146,29 @@ namespace green {
         return false;
     }
 
+    nlohmann::json& client_blob::get_section(uint32_t key)
+    {
+        if (key < m_sections.size()) {
+            bzero_and_free(m_sections[key]); // Must be re-serialized when next saved
+        }
+        return m_data[key];
+    }
+
+    void client_blob::invalidate_sections() const
+    {
+        for (auto& section : m_sections) {
+            bzero_and_free(section);
+        }
+        m_sections.clear();
+    }
+
+    void client_blob::unset_requires_merge()
+    {
+        m_requires_merge = false;
+        m_unsynced.clear(); // Our local changes are now on the server
+        m_synced_version = get_user_version();
+    }
+
     bool client_blob::is_key_encrypted(uint32_t key) const
     {
         const auto& parent = m_data[ENCRYPTED];
@@ -138,7 +179,7 @@ namespace green {
         return false;
     }
 
-    void client_blob::set_user_version(uint64_t version) { m_data[USER_VERSION] = version; }
+    void client_blob::set_user_version(uint64_t version) { get_section(USER_VERSION) = version; }
 
     uint64_t client_blob::get_user_version() const { return m_data[USER_VERSION]; }
 
@@ -153,15 +194,21 @@ namespace green {
         for (const auto& sa : subaccounts.items()) {
             if (auto name = j_str(sa.value(), "name"); name.has_value()) {
                 GDK_RUNTIME_ASSERT_MSG(is_valid_utf8(name.value()), "Subaccount name is not a valid utf-8 string");
-                changed |= json_add_non_default(m_data[SA_NAMES], sa.key(), name.value());
+                if (json_add_non_default(get_section(SA_NAMES), sa.key(), name.value())) {
+                    m_unsynced[SA_NAMES].insert(sa.key());
+                    changed = true;
+                }
             }
             if (auto is_hidden = j_bool(sa.value(), "hidden"); is_hidden.has_value()) {
-                changed |= json_add_non_default(m_data[SA_HIDDEN], sa.key(), is_hidden.value());
+                if (json_add_non_default(get_section(SA_HIDDEN), sa.key(), is_hidden.value())) {
+                    m_unsynced[SA_HIDDEN].insert(sa.key());
+                    changed = true;
+                }
             }
         }
         // Update the subaccount xpubs
         changed |= merge_xpubs(xpubs);
-        return changed ? increment_version(m_data) : changed;
+        return changed ? increment_version(get_section(USER_VERSION)) : changed;
     }
 
     nlohmann::json client_blob::get_subaccounts_data() const
@@ -206,8 +253,11 @@ namespace green {
             throw user_error("Client too old. Please upgrade your app!"); // TODO: i18n
         }
         const std::string trimmed = boost::algorithm::trim_copy(memo);
-        bool changed = json_add_non_default(m_data[TX_MEMOS], txhash_hex, trimmed);
-        return changed ? increment_version(m_data) : changed;
+        bool changed = json_add_non_default(get_section(TX_MEMOS), txhash_hex, trimmed);
+        if (changed) {
+            m_unsynced[TX_MEMOS].insert(txhash_hex);
+        }
+        return changed ? increment_version(get_section(USER_VERSION)) : changed;
     }
 
     bool client_blob::update_tx_memos(const nlohmann::json& memos)
@@ -241,10 +291,10 @@ namespace green {
 
     bool client_blob::set_master_blinding_key(const std::string& master_blinding_key_hex)
     {
-        auto& unblinder = m_data[SLIP77KEY];
+        auto& unblinder = get_section(SLIP77KEY);
         bool changed = json_add_non_default(unblinder, "key", master_blinding_key_hex);
         changed |= json_add_non_default(unblinder, "denied", master_blinding_key_hex.empty());
-        return changed ? increment_version(m_data) : changed;
+        return changed ? increment_version(get_section(USER_VERSION)) : changed;
     }
 
     std::string client_blob::get_master_blinding_key() const
@@ -261,15 +311,15 @@ namespace green {
 
     bool client_blob::set_wo_data(const std::string& username, const nlohmann::json& xpubs)
     {
-        bool changed = json_add_non_default(m_data[WATCHONLY], "username", username);
+        bool changed = json_add_non_default(get_section(WATCHONLY), "username", username);
         changed |= merge_xpubs(xpubs);
-        return changed ? increment_version(m_data) : changed;
+        return changed ? increment_version(get_section(USER_VERSION)) : changed;
     }
 
     bool client_blob::merge_xpubs(const nlohmann::json& xpubs)
     {
         bool changed = false;
-        auto& dest = m_data[WATCHONLY]["xpubs"];
+        auto& dest = get_section(WATCHONLY)["xpubs"];
         for (const auto& xpub : xpubs.items()) {
             if (!dest.contains(xpub.key())) {
                 dest.emplace(xpub.key(), xpub.value());
@@ -282,7 +332,7 @@ namespace green {
     bool client_blob::set_xpubs(const nlohmann::json& xpubs)
     {
         bool changed = merge_xpubs(xpubs);
-        return changed ? increment_version(m_data) : changed;
+        return changed ? increment_version(get_section(USER_VERSION)) : changed;
     }
 
     std::string client_blob::get_watch_only_username() const
@@ -346,9 +396,12 @@ namespace green {
         bzero_and_free(decompressed);
 
         // Check that the new blob has a higher version number:
-        // This check prevents the server maliciously returning an old blob
+        // This check prevents the server maliciously returning an old blob.
+        // Compare against the last version synced with the server, since
+        // our local version also counts any changes we have not yet synced,
+        // which another session's newer blob cannot know about.
         const uint64_t new_version = new_data[USER_VERSION];
-        const uint64_t current_version = get_user_version();
+        const uint64_t current_version = m_synced_version;
         GDK_LOG(info) << "Load blob ver " << new_version << " over " << current_version;
         if (m_server_is_mandatory) {
             // Check that the client version doesn't regress. This can only
@@ -358,21 +411,39 @@ namespace green {
             GDK_RUNTIME_ASSERT_MSG(is_newer, "Server returned an outdated client blob");
         }
 
+        m_synced_version = new_version;
         if (!m_requires_merge) {
             m_data.swap(new_data);
+            invalidate_sections();
+            m_unsynced.clear();
             m_hmac = hmac;
             m_is_modified = false;
             return;
         }
-        // Merge the existing metadata into the current blob
-        auto subaccounts_data = get_subaccounts_data();
+        // Merge our unsynced local changes into the new blob section by
+        // section. Only the entries we changed locally are re-applied, so
+        // changes made to other entries by other sessions are preserved.
+        bool changed = false;
+        for (const auto& [key, items] : m_unsynced) {
+            const auto& ours = m_data[key];
+            auto& theirs = new_data[key];
+            for (const auto& item : items) {
+                const auto ours_p = ours.find(item);
+                if (ours_p == ours.end()) {
+                    // We removed this entry
+                    changed |= theirs.is_object() && theirs.erase(item) != 0;
+                } else if (!theirs.contains(item) || theirs[item] != *ours_p) {
+                    theirs[item] = *ours_p;
+                    changed = true;
+                }
+            }
+        }
         auto xpubs = get_xpubs();
-        auto tx_memos = get_tx_memos();
-        const auto version = get_user_version();
+        const auto version = std::max(get_user_version(), new_version);
         m_data.swap(new_data);
-        update_subaccounts_data(subaccounts_data, xpubs);
-        update_tx_memos(tx_memos);
-        m_is_modified = version != get_user_version();
+        invalidate_sections();
+        changed |= merge_xpubs(xpubs);
+        m_is_modified = changed;
         if (m_is_modified) {
             set_user_version(version + 1);
         }
@@ -384,8 +455,25 @@ namespace green {
     {
         GDK_RUNTIME_ASSERT(m_key.has_value());
 
-        // Dump out data to msgpack format and compress it, prepending PREFIX
-        auto msgpack_data{ nlohmann::json::to_msgpack(m_data) };
+        // Dump out data to msgpack format and compress it, prepending PREFIX.
+        // The blob is a msgpack array of sections: only sections changed
+        // since our last save are re-serialized.
+        GDK_RUNTIME_ASSERT(m_data.is_array());
+        const size_t num_sections = m_data.size();
+        m_sections.resize(num_sections);
+        size_t total_size = 5; // Largest msgpack array header
+        for (size_t i = 0; i < num_sections; ++i) {
+            if (m_sections[i].empty()) {
+                m_sections[i] = nlohmann::json::to_msgpack(m_data[i]);
+            }
+            total_size += m_sections[i].size();
+        }
+        std::vector<unsigned char> msgpack_data;
+        msgpack_data.reserve(total_size);
+        append_msgpack_array_header(msgpack_data, num_sections);
+        for (const auto& section : m_sections) {
+            msgpack_data.insert(msgpack_data.end(), section.begin(), section.end());
+        }
         auto compressed{ compress(PREFIX, msgpack_data) };
 
         // Clear and free the uncompressed representation immediately
@@ -9,6 +9,8 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
+#include <vector>
 
 #include "ga_wally.hpp"
 #include <nlohmann/json.hpp>
@@ -59,7 +61,7 @@ namespace green {
 
         bool get_requires_merge() const { return m_requires_merge; }
         void set_requires_merge() { m_requires_merge = true; }
-        void unset_requires_merge() { m_requires_merge = false; }
+        void unset_requires_merge();
 
         // Mark the blob outdated if the new_hmac is not our current hmac.
         bool on_update(const std::string& new_hmac);
@@ -97,11 +99,24 @@ namespace green {
         nlohmann::json::array_t get_bip329() const;
 
     private:
+        // Return a section of the blob for modification
+        nlohmann::json& get_section(uint32_t key);
+        void invalidate_sections() const;
+
         bool is_key_encrypted(uint32_t key) const;
 
         bool merge_xpubs(const nlohmann::json& xpubs);
 
         nlohmann::json m_data;
+        // Cached msgpack serialization of each section of m_data. Empty
+        // if the section has been modified since it was last serialized.
+        mutable std::vector<std::vector<unsigned char>> m_sections;
+        // Keys of section entries changed locally since our last sync with
+        // the server, re-applied when merging a newer server blob.
+        std::map<uint32_t, std::set<std::string>> m_unsynced;
+        // The version of the blob last synced with the server. Server blobs
+        // older than this are rejected, whatever our unsynced local version.
+        uint64_t m_synced_version;
         // Client id for talking to a blobserver
         std::string m_client_id;
         // Key for encrypting the client blob contents
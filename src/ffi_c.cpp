@@ -10,6 +10,7 @@
 #include "ga_auth_handlers.hpp"
 #include "gdk.h"
 #include "json_utils.hpp"
+#include "metrics.hpp"
 #include "network_parameters.hpp"
 #include "redeposit_auth_handlers.hpp"
 #include "session.hpp"
@@ -410,6 +411,10 @@ GDK_DEFINE_C_FUNCTION_3(GA_update_subaccount, struct GA_session*, session, GA_js
 GDK_DEFINE_C_FUNCTION_3(GA_get_transactions, struct GA_session*, session, GA_json*, details, struct GA_auth_handler**,
     call, { *call = make_call(new green::get_transactions_call(*session, json_move(details))); })
 
+GDK_DEFINE_C_FUNCTION_3(GA_query_transactions, struct GA_session*, session, GA_json*, details,
+    struct GA_auth_handler**, call,
+    { *call = make_call(new green::query_transactions_call(*session, json_move(details))); })
+
 GDK_DEFINE_C_FUNCTION_3(GA_get_receive_address, struct GA_session*, session, GA_json*, details,
     struct GA_auth_handler**, call,
     { *call = make_call(new green::get_receive_address_call(*session, json_move(details))); })
@@ -442,6 +447,9 @@ GDK_DEFINE_C_FUNCTION_2(GA_get_available_currencies, struct GA_session*, session
 GDK_DEFINE_C_FUNCTION_3(GA_convert_amount, struct GA_session*, session, const GA_json*, value_details, GA_json**,
     output, { *json_cast(output) = new nlohmann::json(session->convert_amount(*json_cast(value_details))); })
 
+GDK_DEFINE_C_FUNCTION_3(GA_convert_amounts, struct GA_session*, session, const GA_json*, value_details, GA_json**,
+    output, { *json_cast(output) = new nlohmann::json(session->convert_amounts(*json_cast(value_details))); })
+
 GDK_DEFINE_C_FUNCTION_3(GA_encrypt_with_pin, struct GA_session*, session, GA_json*, details, struct GA_auth_handler**,
     call, { *call = make_call(new green::encrypt_with_pin_call(*session, json_move(details))); })
 
@@ -468,6 +476,11 @@ GDK_DEFINE_C_FUNCTION_1(GA_get_networks, GA_json**, output,
 GDK_DEFINE_C_FUNCTION_2(GA_get_uniform_uint32_t, uint32_t, upper_bound, uint32_t*, output,
     { *output = green::get_uniform_uint32_t(upper_bound); })
 
+GDK_DEFINE_C_FUNCTION_2(GA_get_metrics, const GA_json*, details, GA_json**, output, {
+    const bool reset = green::j_bool_or_false(*json_cast(details), "reset");
+    *json_cast(output) = new nlohmann::json(green::metrics::get(reset));
+})
+
 GDK_DEFINE_C_FUNCTION_2(GA_auth_handler_request_code, struct GA_auth_handler*, call, const char*, method,
     { auth_cast(call)->request_code(method); })
 
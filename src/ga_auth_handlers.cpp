@@ -13,6 +13,7 @@
 #include "json_utils.hpp"
 #include "logging.hpp"
 #include "memory.hpp"
+#include "metrics.hpp"
 #include "session.hpp"
 #include "session_impl.hpp"
 #include "signer.hpp"
@@ -1278,17 +1279,19 @@ namespace green {
     //
     // Get transactions
     //
-    get_transactions_call::get_transactions_call(session& session, nlohmann::json details)
-        : auth_handler_impl(session, "get_transactions")
+    get_transactions_call::get_transactions_call(session& session, nlohmann::json details, const std::string& name)
+        : auth_handler_impl(session, name.empty() ? "get_transactions" : name)
         , m_details(std::move(details))
     {
     }
 
+    nlohmann::json get_transactions_call::get_cached_transactions() { return m_session->get_transactions(m_details); }
+
     auth_handler::state_type get_transactions_call::call_impl()
     {
         if (m_net_params.is_electrum()) {
             // FIXME: Move rust to ga_session interface
-            auto txs = m_session->get_transactions(m_details);
+            auto txs = get_cached_transactions();
             m_session->postprocess_transactions(txs);
             m_result = { { "transactions", std::move(txs) } };
             return state_type::done;
@@ -1310,10 +1313,21 @@ namespace green {
             // We have finished iterating and caching the server results,
             // return the txs the user asked for
             m_details["sync_ts"] = m_result["sync_ts"];
-            auto txs = m_session->get_transactions(m_details);
+            auto txs = get_cached_transactions();
             if (!txs.is_boolean()) {
                 m_session->postprocess_transactions(txs);
+                const auto sort_by = j_str(m_details, "sort_by").value_or("newest");
+                const bool is_time_ordered = sort_by == "newest" || sort_by == "oldest";
+                const bool is_full_page = !txs.empty() && txs.size() == j_uint32(m_details, "count").value_or(30);
+                std::string cursor;
+                if (is_time_ordered && is_full_page) {
+                    // Return a cursor to fetch the next page without skipping rows
+                    cursor = std::to_string(txs.back().at("created_at_ts").get<uint64_t>());
+                }
                 m_result = { { "transactions", std::move(txs) } };
+                if (!cursor.empty()) {
+                    m_result["cursor"] = std::move(cursor);
+                }
                 return state_type::done;
             }
             // Otherwise the cache was invalidated, continue on to resync
@@ -1334,6 +1348,19 @@ namespace green {
         return state_type::make_call;
     }
 
+    //
+    // Query transactions
+    //
+    query_transactions_call::query_transactions_call(session& session, nlohmann::json details)
+        : get_transactions_call(session, std::move(details), "query_transactions")
+    {
+    }
+
+    nlohmann::json query_transactions_call::get_cached_transactions()
+    {
+        return m_session->query_transactions(m_details);
+    }
+
     struct utxo_sorter {
         enum class sort_by_t : size_t { OLDEST = 0, NEWEST, LARGEST, SMALLEST };
 
@@ -1400,10 +1427,10 @@ namespace green {
             return;
         }
         auto p = m_session->get_cached_utxos(j_uint32ref(m_details, "subaccount"), num_confs);
+        metrics::count(p ? "utxo_cache.hits" : "utxo_cache.misses");
         if (p) {
             // Return the cached result, after filtering it
-            m_result = *p;
-            filter_result(false);
+            filter_result(std::move(p));
             m_state = state_type::done;
             return;
         }
@@ -1418,7 +1445,7 @@ namespace green {
             // Encache and return them
             m_session->process_unspent_outputs(utxos);
             m_result["unspent_outputs"].swap(utxos);
-            filter_result(true);
+            encache_result();
             m_state = state_type::done;
             return;
         }
@@ -1445,107 +1472,107 @@ namespace green {
         m_result.swap(utxos);
         m_session->process_unspent_outputs(utxos);
         m_result["unspent_outputs"].swap(utxos);
-        filter_result(true);
+        encache_result();
         return state_type::done;
     }
 
-    template <typename T> static void filter_utxos(nlohmann::json& outputs, T&& filter)
+    void get_unspent_outputs_call::encache_result()
     {
-        for (auto& asset : outputs.items()) {
-            if (asset.key() != "error") {
-                auto& utxos = asset.value();
-                utxos.erase(std::remove_if(utxos.begin(), utxos.end(), filter), utxos.end());
-            }
+        if (m_net_params.is_electrum()) {
+            // Not cached: take ownership of the results for filtering
+            filter_result(std::make_shared<const nlohmann::json>(std::move(m_result)));
+            return;
         }
+        // Encache the unfiltered results, and filter the shared cache entry
+        filter_result(m_session->set_cached_utxos(
+            j_uint32ref(m_details, "subaccount"), j_uint32ref(m_details, "num_confs"), m_result));
     }
 
-    void get_unspent_outputs_call::filter_result(bool encache)
+    void get_unspent_outputs_call::filter_result(std::shared_ptr<const nlohmann::json> utxos)
     {
-        if (encache && !m_net_params.is_electrum()) {
-            // Encache the unfiltered results, and set our result to a copy
-            // for filtering.
-            auto p = m_session->set_cached_utxos(
-                j_uint32ref(m_details, "subaccount"), j_uint32ref(m_details, "num_confs"), m_result);
-            m_result = *p;
-        }
-
-        auto& outputs = m_result.at("unspent_outputs");
-        if (outputs.is_null() || outputs.empty()) {
-            // Nothing to filter, return an empty json object
-            outputs = nlohmann::json::object();
-            return;
-        }
+        // The UTXOs may be shared with the cache and other callers, so are
+        // never modified. Instead, only those passing the users filters are
+        // copied into the result.
+        const auto& outputs = utxos->at("unspent_outputs");
 
         const auto address_type = j_str_or_empty(m_details, "address_type");
-        if (!address_type.empty()) {
-            // The user only wants a particular address type, filter out others
-            filter_utxos(
-                outputs, [&address_type](const auto& u) { return j_strref(u, "address_type") != address_type; });
-        }
+        // Whether the user only wants confidential UTXOs
+        const bool confidential_only = m_net_params.is_liquid() && j_bool_or_false(m_details, "confidential");
+        // Whether the user requested frozen UTXOs
+        const bool all_coins = j_bool_or_false(m_details, "all_coins");
 
-        const bool is_liquid = m_net_params.is_liquid();
-        if (is_liquid && j_bool_or_false(m_details, "confidential")) {
-            // The user only wants confidential UTXOs, filter out non-confidential
-            filter_utxos(outputs, [](const auto& u) { return !j_bool_or_false(u, "is_blinded"); });
+        const auto expired_at = j_uint32(m_details, "expired_at");
+        const auto expires_in = j_uint32(m_details, "expires_in");
+        std::optional<uint64_t> expiry_height;
+        if (expired_at && expires_in) {
+            throw user_error("Only one of \"expired_at\" or \"expires_in\" may be given");
         }
-
-        if (!j_bool_or_false(m_details, "all_coins")) {
-            // User did not request frozen UTXOs, filter them out
-            filter_utxos(outputs, [](const auto& u) {
-                return j_uint32(u, "user_status").value_or(USER_STATUS_DEFAULT) == USER_STATUS_FROZEN;
-            });
+        if (expired_at) {
+            // Use the absolute expiry height given
+            expiry_height = *expired_at;
+        } else if (expires_in) {
+            // Add the number of relative blocks to the current block height
+            expiry_height = m_session->get_block_height() + *expires_in;
         }
 
-        const auto expired_at = j_uint32(m_details, "expired_at");
-        const auto expires_in = j_uint32(m_details, "expires_in");
-        if (expired_at || expires_in) {
-            uint64_t expiry_height;
-            if (expired_at && expires_in) {
-                throw user_error("Only one of \"expired_at\" or \"expires_in\" may be given");
-            }
-            if (expired_at) {
-                // Use the absolute expiry height given
-                expiry_height = *expired_at;
-            } else {
-                // Add the number of relative blocks to the current block height
-                expiry_height = m_session->get_block_height() + *expires_in;
+        // If the user passed a dust limit, filter UTXOs that are below it
+        const auto dust_limit = j_amount_or_zero(m_details, "dust_limit");
+
+        auto&& is_wanted = [&](const nlohmann::json& u) -> bool {
+            if (!address_type.empty() && j_strref(u, "address_type") != address_type) {
+                return false;
+            }
+            if (confidential_only && !j_bool_or_false(u, "is_blinded")) {
+                return false;
+            }
+            if (!all_coins && j_uint32(u, "user_status").value_or(USER_STATUS_DEFAULT) == USER_STATUS_FROZEN) {
+                return false;
             }
             // Return only UTXOs that have expired as at block number 'expiry_height'.
             // A UTXO is expired if its nlocktime has been reached; i.e. its
             // nlocktime is less than or equal to the block number in
             // 'expiry_height'. Therefore we filter out UTXOs where nlocktime
             // is greater than 'expiry_height', or not present (i.e. non-expiring UTXOs)
-            filter_utxos(outputs,
-                [expiry_height](const auto& u) { return j_uint32_or_zero(u, "expiry_height") > expiry_height; });
-        }
-
-        const auto dust_limit = j_amount_or_zero(m_details, "dust_limit");
-        if (dust_limit.value()) {
-            // The user passed a dust limit, filter UTXOs that are below it
-            filter_utxos(outputs, [dust_limit](const auto& u) { return j_amountref(u) <= dust_limit; });
-        }
-
-        // Remove any keys that have become empty
-        for (auto asset = outputs.begin(); asset != outputs.end(); /* no-op */) {
-            if (asset.value().empty()) {
-                // Use post increment to increment the iterator before it
-                // is invalidated, passing the current value to erase()
-                outputs.erase(asset++);
-            } else {
-                ++asset;
+            if (expiry_height && j_uint32_or_zero(u, "expiry_height") > *expiry_height) {
+                return false;
             }
+            if (dust_limit.value() && j_amountref(u) <= dust_limit) {
+                return false;
+            }
+            return true;
+        };
+
+        if (outputs.is_null()) {
+            set_filtered_result(nlohmann::json::object(), is_wanted);
+        } else {
+            set_filtered_result(outputs, is_wanted);
         }
+    }
 
-        // Sort the results
+    void get_unspent_outputs_call::set_filtered_result(const nlohmann::json& outputs, const utxo_filter_t& is_wanted)
+    {
+        nlohmann::json result = nlohmann::json::object();
         if (!outputs.empty()) {
             const utxo_sorter sorter(get_sort_by());
-            for (auto& asset : outputs.items()) {
-                if (asset.key() != "error") {
-                    auto& utxos = asset.value();
+            for (const auto& asset : outputs.items()) {
+                if (asset.key() == "error") {
+                    result.emplace(asset.key(), asset.value());
+                    continue;
+                }
+                nlohmann::json::array_t utxos;
+                for (const auto& utxo : asset.value()) {
+                    if (is_wanted(utxo)) {
+                        utxos.push_back(utxo);
+                    }
+                }
+                // Omit any assets that have become empty, and sort the rest
+                if (!utxos.empty()) {
                     std::sort(utxos.begin(), utxos.end(), sorter);
+                    result.emplace(asset.key(), std::move(utxos));
                 }
             }
         }
+        m_result = { { "unspent_outputs", std::move(result) } };
     }
 
     std::string get_unspent_outputs_call::get_sort_by() const
@@ -1592,32 +1619,29 @@ namespace green {
     {
     }
 
-    auth_handler::state_type get_balance_call::call_impl()
+    void get_balance_call::set_filtered_result(const nlohmann::json& outputs, const utxo_filter_t& is_wanted)
     {
-        auto state = get_unspent_outputs_call::call_impl(); // Get UTXOs using parent call
-        if (state == state_type::done) {
-            compute_balance();
-        }
-        return state;
-    }
-
-    void get_balance_call::compute_balance()
-    {
-        // Compute the balance data from returned UTXOs
+        // Compute the balance data directly from the UTXOs, without copying them
         nlohmann::json balance({ { m_net_params.get_policy_asset(), 0 } });
 
-        for (const auto& asset : m_result["unspent_outputs"].items()) {
+        for (const auto& asset : outputs.items()) {
             if (asset.key() == "error") {
                 // TODO: Should we return whether an unblinding error occurred
                 // when computing the balance?
                 continue;
             }
             amount::value_type satoshi = 0;
+            bool have_utxos = false;
             for (const auto& utxo : asset.value()) {
-                GDK_RUNTIME_ASSERT(!utxo.contains("error"));
-                satoshi += j_amountref(utxo).value();
+                if (is_wanted(utxo)) {
+                    GDK_RUNTIME_ASSERT(!utxo.contains("error"));
+                    satoshi += j_amountref(utxo).value();
+                    have_utxos = true;
+                }
+            }
+            if (have_utxos) {
+                balance[asset.key()] = satoshi;
             }
-            balance[asset.key()] = satoshi;
         }
         m_result.swap(balance); // Return balance data to caller
     }
@@ -1761,7 +1785,7 @@ namespace green {
                 // server.
                 // FIXME: Allow the user to specify their own seed in the future.
                 if (data != j_str_or_empty(current_subconfig, "data")) {
-                    set_error(res::id_inconsistent_data_provided_for);
+                    set_error(std::string(res::id_inconsistent_data_provided_for));
                     return;
                 }
             }
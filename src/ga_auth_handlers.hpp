@@ -4,6 +4,8 @@
 
 #include "auth_handler.hpp"
 
+#include <functional>
+
 namespace green {
 
     class Psbt;
@@ -198,12 +200,24 @@ namespace green {
 
     class get_transactions_call : public auth_handler_impl {
     public:
-        get_transactions_call(session& session, nlohmann::json details);
+        get_transactions_call(session& session, nlohmann::json details, const std::string& name = std::string());
+
+    protected:
+        // Fetch the txs to return from the (synced) tx cache
+        virtual nlohmann::json get_cached_transactions();
+
+        nlohmann::json m_details;
 
     private:
         state_type call_impl() override;
+    };
 
-        nlohmann::json m_details;
+    class query_transactions_call : public get_transactions_call {
+    public:
+        query_transactions_call(session& session, nlohmann::json details);
+
+    private:
+        nlohmann::json get_cached_transactions() override;
     };
 
     class get_unspent_outputs_call : public auth_handler_impl {
@@ -211,11 +225,16 @@ namespace green {
         get_unspent_outputs_call(session& session, nlohmann::json details, const std::string& name = std::string());
 
     protected:
+        using utxo_filter_t = std::function<bool(const nlohmann::json&)>;
+
         state_type call_impl() override;
+        // Set m_result from the UTXOs in "outputs" that pass "is_wanted"
+        virtual void set_filtered_result(const nlohmann::json& outputs, const utxo_filter_t& is_wanted);
 
     private:
         void initialize();
-        void filter_result(bool encache);
+        void encache_result();
+        void filter_result(std::shared_ptr<const nlohmann::json> utxos);
         std::string get_sort_by() const;
 
         nlohmann::json m_details;
@@ -238,8 +257,7 @@ namespace green {
         get_balance_call(session& session, nlohmann::json details);
 
     private:
-        state_type call_impl() override;
-        void compute_balance();
+        void set_filtered_result(const nlohmann::json& outputs, const utxo_filter_t& is_wanted) override;
     };
 
     class set_unspent_outputs_status_call : public auth_handler_impl {
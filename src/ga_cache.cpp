@@ -1,6 +1,8 @@
 #include <algorithm>
 #include <array>
 #include <fstream>
+#include <set>
+#include <variant>
 #include <vector>
 
 #include "assertion.hpp"
@@ -8,6 +10,7 @@
 #include "json_utils.hpp"
 #include "logging.hpp"
 #include "memory.hpp"
+#include "metrics.hpp"
 #include "network_parameters.hpp"
 #include "session.hpp"
 #include "signer.hpp"
@@ -25,10 +28,13 @@ namespace green {
         constexpr uint32_t CT_WO = 2; // Watch-only wallet cache
 
         constexpr int VERSION = 1;
-        constexpr int MINOR_VERSION = 0x3;
+        constexpr int MINOR_VERSION = 0x4;
         constexpr const char* KV_SELECT = "SELECT value FROM KeyValue WHERE key = ?1;";
         constexpr const char* TX_SELECT = "SELECT timestamp, txid, block, spent, spv_status, data FROM Tx "
                                           "WHERE subaccount = ?1 ORDER BY timestamp DESC LIMIT ?2 OFFSET ?3;";
+        constexpr const char* TX_SELECT_BEFORE = "SELECT timestamp, txid, block, spent, spv_status, data FROM Tx "
+                                                 "WHERE subaccount = ?1 AND timestamp < ?2 "
+                                                 "ORDER BY timestamp DESC LIMIT ?3;";
         constexpr const char* TXID_SELECT = "SELECT timestamp, txid, block, spent, spv_status, data FROM Tx "
                                             "WHERE subaccount = ?1 AND txid = ?2;";
         constexpr const char* TX_LATEST = "SELECT MAX(timestamp) FROM Tx WHERE subaccount = ?1;";
@@ -38,12 +44,27 @@ namespace green {
             = "SELECT MIN(timestamp) FROM Tx WHERE subaccount = ?1 AND block >= ?2;";
         constexpr const char* TX_UPSERT = "INSERT INTO Tx(subaccount, timestamp, txid, block, spent, spv_status, data) "
                                           "VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7) "
-                                          "ON CONFLICT(subaccount, timestamp) DO UPDATE SET data = ?4;";
+                                          "ON CONFLICT(subaccount, timestamp) DO UPDATE SET block = ?4, data = ?7;";
         constexpr const char* TX_SPV_UPDATE = "UPDATE Tx SET spv_status = ?1 WHERE txid = ?2;";
         constexpr const char* TX_DELETE_ALL = "DELETE FROM Tx WHERE subaccount = ?1 AND timestamp >= ?2;";
         constexpr const char* TXDATA_INSERT = "INSERT INTO TxData(txid, rawtx) VALUES (?1, ?2) "
                                               "ON CONFLICT(txid) DO NOTHING;";
         constexpr const char* TXDATA_SELECT = "SELECT rawtx FROM TxData WHERE txid = ?1;";
+        constexpr const char* SPV_BLOCK_SELECT = "SELECT block, block_hash FROM SpvVerified WHERE txid = ?1;";
+        constexpr const char* SPV_BLOCK_UPSERT = "INSERT INTO SpvVerified(txid, block, block_hash) VALUES (?1, ?2, ?3) "
+                                                 "ON CONFLICT(txid) DO UPDATE SET block = ?2, block_hash = ?3;";
+        constexpr const char* TXQUERY_UPSERT
+            = "INSERT OR REPLACE INTO TxQuery(subaccount, timestamp, type, memo) VALUES (?1, ?2, ?3, ?4);";
+        constexpr const char* TXASSET_UPSERT
+            = "INSERT OR REPLACE INTO TxAsset(subaccount, timestamp, asset, satoshi) VALUES (?1, ?2, ?3, ?4);";
+        constexpr const char* TXADDRESS_UPSERT
+            = "INSERT OR REPLACE INTO TxAddress(subaccount, timestamp, address) VALUES (?1, ?2, ?3);";
+        constexpr const char* TX_QUERY_CLEAN
+            = "BEGIN "
+              "DELETE FROM TxQuery WHERE subaccount = OLD.subaccount AND timestamp = OLD.timestamp; "
+              "DELETE FROM TxAsset WHERE subaccount = OLD.subaccount AND timestamp = OLD.timestamp; "
+              "DELETE FROM TxAddress WHERE subaccount = OLD.subaccount AND timestamp = OLD.timestamp; "
+              "END;";
 
         static auto get_new_memory_db()
         {
@@ -80,6 +101,10 @@ namespace green {
                 "CREATE TABLE IF NOT EXISTS Tx(subaccount INTEGER NOT NULL, timestamp INTEGER NOT NULL, txid BLOB "
                 "NOT NULL, block INTEGER NOT NULL, spent INTEGER NOT NULL, spv_status INTEGER NOT NULL, "
                 "data BLOB NOT NULL, PRIMARY KEY(subaccount, timestamp));");
+            // Index txs by txid for SPV updates and tx notifications, and by
+            // block for reorg handling. Existing caches are indexed on load
+            exec_check("CREATE INDEX IF NOT EXISTS TxTxid ON Tx(txid, subaccount);");
+            exec_check("CREATE INDEX IF NOT EXISTS TxBlock ON Tx(subaccount, block);");
 
             exec_check(
                 "CREATE TABLE IF NOT EXISTS TxData(txid BLOB NOT NULL, rawtx BLOB NOT NULL, PRIMARY KEY(txid));");
@@ -93,14 +118,60 @@ namespace green {
                        "script_type INTEGER NOT NULL,"
                        "PRIMARY KEY(scriptpubkey),"
                        "UNIQUE(subaccount, pointer DESC));");
+
+            exec_check("CREATE TABLE IF NOT EXISTS SpvVerified(txid BLOB NOT NULL, block INTEGER NOT NULL, "
+                       "block_hash BLOB NOT NULL, PRIMARY KEY(txid));");
+
+            // Tx query index tables, keyed by the Tx table primary key.
+            // Rows are removed by trigger when their Tx row changes
+            exec_check("CREATE TABLE IF NOT EXISTS TxQuery(subaccount INTEGER NOT NULL, timestamp INTEGER NOT NULL, "
+                       "type TEXT NOT NULL, memo TEXT NOT NULL, PRIMARY KEY(subaccount, timestamp));");
+            exec_check("CREATE INDEX IF NOT EXISTS TxQueryType ON TxQuery(subaccount, type);");
+
+            exec_check("CREATE TABLE IF NOT EXISTS TxAsset(subaccount INTEGER NOT NULL, timestamp INTEGER NOT NULL, "
+                       "asset TEXT NOT NULL, satoshi INTEGER NOT NULL, PRIMARY KEY(subaccount, timestamp, asset));");
+            exec_check("CREATE INDEX IF NOT EXISTS TxAssetAmount ON TxAsset(subaccount, asset, satoshi);");
+
+            exec_check("CREATE TABLE IF NOT EXISTS TxAddress(subaccount INTEGER NOT NULL, timestamp INTEGER NOT NULL, "
+                       "address TEXT NOT NULL, PRIMARY KEY(subaccount, timestamp, address));");
+            exec_check("CREATE INDEX IF NOT EXISTS TxAddressLookup ON TxAddress(subaccount, address);");
+
+            const std::string on_tx = std::string(" ON Tx ") + TX_QUERY_CLEAN;
+            exec_check(("CREATE TRIGGER IF NOT EXISTS TxQueryCleanDelete AFTER DELETE" + on_tx).c_str());
+            exec_check(("CREATE TRIGGER IF NOT EXISTS TxQueryCleanUpdate AFTER UPDATE OF data" + on_tx).c_str());
             return db;
         }
 
+        // SQL function txid_in(txid, txids): 1 if txid is in txids, a blob of
+        // sorted txids, else 0. This allows matching any number of txids with
+        // one bound parameter, since SQLITE_MAX_VARIABLE_NUMBER limits an IN list
+        static void sql_txid_in(sqlite3_context* ctx, int /*argc*/, sqlite3_value** argv)
+        {
+            const auto txid_p = static_cast<const unsigned char*>(sqlite3_value_blob(argv[0]));
+            const size_t txid_len = sqlite3_value_bytes(argv[0]);
+            const auto txids_p = static_cast<const unsigned char*>(sqlite3_value_blob(argv[1]));
+            const size_t txids_len = sqlite3_value_bytes(argv[1]);
+            bool found = false;
+            if (txid_p && txids_p && txid_len == SHA256_LEN && txids_len % SHA256_LEN == 0) {
+                using txid_t = std::array<unsigned char, SHA256_LEN>;
+                const auto begin = reinterpret_cast<const txid_t*>(txids_p);
+                const auto end = begin + txids_len / SHA256_LEN;
+                const auto& txid = *reinterpret_cast<const txid_t*>(txid_p);
+                found = std::binary_search(begin, end, txid);
+            }
+            sqlite3_result_int(ctx, found ? 1 : 0);
+        }
+
         static auto get_db()
         {
             // Verify thread safety in the event that sqlite has been upgraded
             GDK_RUNTIME_ASSERT(sqlite3_threadsafe());
-            return create_db_schema(get_new_memory_db());
+            auto db = create_db_schema(get_new_memory_db());
+            constexpr int flags = SQLITE_UTF8 | SQLITE_DETERMINISTIC;
+            const int rc
+                = sqlite3_create_function(db.get(), "txid_in", 2, flags, nullptr, sql_txid_in, nullptr, nullptr);
+            GDK_RUNTIME_ASSERT(rc == SQLITE_OK);
+            return db;
         }
 
         static const char* db_log_error(sqlite3* db) noexcept
@@ -379,6 +450,20 @@ namespace green {
             }
         }
 
+        static void bind_signed_int(cache::sqlite3_stmt_ptr& stmt, int column, int64_t value)
+        {
+            if (sqlite3_bind_int64(stmt.get(), column, value) != SQLITE_OK) {
+                GDK_RUNTIME_ASSERT_MSG(false, db_log_error(stmt));
+            }
+        }
+
+        static void bind_text(cache::sqlite3_stmt_ptr& stmt, int column, const std::string& text)
+        {
+            if (sqlite3_bind_text(stmt.get(), column, text.data(), text.size(), SQLITE_STATIC) != SQLITE_OK) {
+                GDK_RUNTIME_ASSERT_MSG(false, db_log_error(stmt));
+            }
+        }
+
         static void bind_blobs(cache::sqlite3_stmt_ptr& stmt, byte_span_t blob1, byte_span_t blob2)
         {
             bind_blob(stmt, 1, blob1);
@@ -412,6 +497,7 @@ namespace green {
         , m_stmt_key_value_search(get_stmt(true, m_db, KV_SELECT))
         , m_stmt_key_value_delete(get_stmt(true, m_db, "DELETE FROM KeyValue WHERE key = ?1;"))
         , m_stmt_tx_search(get_stmt(true, m_db, TX_SELECT))
+        , m_stmt_tx_search_before(get_stmt(true, m_db, TX_SELECT_BEFORE))
         , m_stmt_txid_search(get_stmt(true, m_db, TXID_SELECT))
         , m_stmt_tx_latest_search(get_stmt(true, m_db, TX_LATEST))
         , m_stmt_tx_earliest_mempool_search(get_stmt(true, m_db, TX_EARLIEST_MEMPOOL))
@@ -421,8 +507,13 @@ namespace green {
         , m_stmt_tx_delete_all(get_stmt(true, m_db, TX_DELETE_ALL))
         , m_stmt_txdata_insert(get_stmt(true, m_db, TXDATA_INSERT))
         , m_stmt_txdata_search(get_stmt(true, m_db, TXDATA_SELECT))
-        , m_stmt_scriptpubkey_search(get_stmt(true, m_db,
-              "SELECT subaccount, branch, pointer, subtype, script_type FROM ScriptPubKey WHERE scriptpubkey = ?1;"))
+        , m_stmt_spv_block_search(get_stmt(true, m_db, SPV_BLOCK_SELECT))
+        , m_stmt_spv_block_upsert(get_stmt(true, m_db, SPV_BLOCK_UPSERT))
+        , m_stmt_tx_query_upsert(get_stmt(true, m_db, TXQUERY_UPSERT))
+        , m_stmt_tx_asset_upsert(get_stmt(true, m_db, TXASSET_UPSERT))
+        , m_stmt_tx_address_upsert(get_stmt(true, m_db, TXADDRESS_UPSERT))
+        , m_stmt_scriptpubkey_load(get_stmt(true, m_db,
+              "SELECT scriptpubkey, subaccount, branch, pointer, subtype, script_type FROM ScriptPubKey;"))
         , m_stmt_scriptpubkey_insert(get_stmt(true, m_db,
               "INSERT OR IGNORE INTO ScriptPubKey (scriptpubkey, subaccount, branch, pointer, subtype, script_type) "
               "VALUES (?1, ?2, ?3, ?4, ?5, ?6);"))
@@ -447,6 +538,7 @@ namespace green {
         if (m_db_name.empty() || !m_require_write) {
             return;
         }
+        metrics::scoped_timer timer("cache.save_db");
         sqlite3_int64 db_size;
         void* db = sqlite3_serialize(m_db.get(), "main", &db_size, 0);
         const auto _stmt_clean = gsl::finally([&db] { sqlite3_free(db); });
@@ -457,6 +549,7 @@ namespace green {
         const auto path = get_persistent_storage_file(m_data_dir, m_db_name, VERSION);
         save_db_file(m_encryption_key, data, path);
         m_require_write = false;
+        metrics::count("cache.bytes_saved", data.size());
     }
 
     std::tuple<std::string, uint32_t, std::array<unsigned char, SHA256_LEN>> cache::get_name_type_and_key(
@@ -476,7 +569,9 @@ namespace green {
 
     void cache::load_db(byte_span_t encryption_key, std::shared_ptr<signer> signer)
     {
+        metrics::scoped_timer timer("cache.load_db");
         std::tie(m_db_name, m_type, m_encryption_key) = get_name_type_and_key(encryption_key, m_network_name, signer);
+        m_scriptpubkey_index.reset(); // Re-read from the loaded DB on next lookup
 
         const auto path = get_persistent_storage_file(m_data_dir, m_db_name, VERSION);
         if (!load_db_impl(m_encryption_key, path, m_db)) {
@@ -540,8 +635,9 @@ namespace green {
                 exec_sql(m_db, "DELETE FROM LiquidOutput;");
                 exec_sql(m_db, "DELETE FROM LiquidBlindingNonce;");
             }
-            if (ver < 3) {
-                // Delete pre-v3 tx's
+            if (ver < 4) {
+                // Delete pre-v4 tx's. v4 adds the tx query index tables,
+                // which are populated as the deleted txs are re-synced
                 exec_sql(m_db, "DELETE FROM Tx;");
             }
 
@@ -593,6 +689,18 @@ namespace green {
         }
     }
 
+    void cache::get_transactions_before(
+        uint32_t subaccount, uint64_t before_ts, size_t count, const cache::get_transactions_fn& callback)
+    {
+        const auto _{ stmt_clean(m_stmt_tx_search_before) };
+        bind_int(m_stmt_tx_search_before, 1, subaccount);
+        bind_int(m_stmt_tx_search_before, 2, before_ts);
+        bind_int(m_stmt_tx_search_before, 3, count);
+        while (get_tx(m_stmt_tx_search_before, callback)) {
+            // No-op
+        }
+    }
+
     void cache::get_transaction(
         uint32_t subaccount, const std::string& txhash_hex, const cache::get_transactions_fn& callback)
     {
@@ -665,9 +773,179 @@ namespace green {
         bind_int(m_stmt_tx_upsert, 6, 3); // SPV_STATUS_DISABLED
         bind_blob(m_stmt_tx_upsert, 7, tx_data);
         step_final(m_stmt_tx_upsert);
+        insert_transaction_query_data(subaccount, timestamp, tx_json);
         m_require_write = true;
     }
 
+    void cache::insert_transaction_query_data(uint32_t subaccount, uint64_t timestamp, const nlohmann::json& tx_json)
+    {
+        {
+            const auto type = j_str_or_empty(tx_json, "type");
+            const auto memo = j_str_or_empty(tx_json, "memo");
+            const auto _{ stmt_clean(m_stmt_tx_query_upsert) };
+            bind_int(m_stmt_tx_query_upsert, 1, subaccount);
+            bind_int(m_stmt_tx_query_upsert, 2, timestamp);
+            bind_text(m_stmt_tx_query_upsert, 3, type);
+            bind_text(m_stmt_tx_query_upsert, 4, memo);
+            step_final(m_stmt_tx_query_upsert);
+        }
+        if (const auto satoshi_p = tx_json.find("satoshi"); satoshi_p != tx_json.end()) {
+            for (const auto& item : satoshi_p->items()) {
+                const auto _{ stmt_clean(m_stmt_tx_asset_upsert) };
+                bind_int(m_stmt_tx_asset_upsert, 1, subaccount);
+                bind_int(m_stmt_tx_asset_upsert, 2, timestamp);
+                bind_text(m_stmt_tx_asset_upsert, 3, item.key());
+                bind_signed_int(m_stmt_tx_asset_upsert, 4, item.value().get<int64_t>());
+                step_final(m_stmt_tx_asset_upsert);
+            }
+        }
+        std::set<std::string> addresses;
+        for (const auto* key : { "inputs", "outputs" }) {
+            if (const auto eps_p = tx_json.find(key); eps_p != tx_json.end()) {
+                for (const auto& ep : *eps_p) {
+                    for (const auto* addr_key : { "address", "unconfidential_address" }) {
+                        if (auto address = j_str_or_empty(ep, addr_key); !address.empty()) {
+                            addresses.emplace(std::move(address));
+                        }
+                    }
+                }
+            }
+        }
+        for (const auto& address : addresses) {
+            const auto _{ stmt_clean(m_stmt_tx_address_upsert) };
+            bind_int(m_stmt_tx_address_upsert, 1, subaccount);
+            bind_int(m_stmt_tx_address_upsert, 2, timestamp);
+            bind_text(m_stmt_tx_address_upsert, 3, address);
+            step_final(m_stmt_tx_address_upsert);
+        }
+    }
+
+    void cache::query_transactions(const nlohmann::json& query, const cache::get_transactions_fn& callback)
+    {
+        // Build a statement using only the filters given, so that SQLite can
+        // choose the most selective index for each query
+        using param_t = std::variant<int64_t, std::string, std::vector<unsigned char>>;
+        std::vector<param_t> params;
+        const auto param = [&params](param_t p) {
+            params.emplace_back(std::move(p));
+            return "?" + std::to_string(params.size());
+        };
+        const auto join = [](const char* table) {
+            return std::string(" JOIN ") + table + " ON " + table + ".subaccount = Tx.subaccount AND " + table
+                + ".timestamp = Tx.timestamp";
+        };
+        const auto get_int = [&query](const char* key) {
+            const auto it = query.find(key);
+            return it == query.end() ? std::optional<int64_t>() : std::optional<int64_t>(it->get<int64_t>());
+        };
+
+        std::string sql = "SELECT Tx.timestamp, Tx.txid, Tx.block, Tx.spent, Tx.spv_status, Tx.data FROM Tx";
+        std::string where = " WHERE Tx.subaccount = " + param(int64_t{ j_uint32ref(query, "subaccount") });
+
+        const auto asset_id = j_str(query, "asset_id");
+        if (asset_id.has_value()) {
+            sql += join("TxAsset");
+            where += " AND TxAsset.asset = " + param(*asset_id);
+            if (const auto min_satoshi = get_int("min_satoshi"); min_satoshi.has_value()) {
+                where += " AND abs(TxAsset.satoshi) >= " + param(*min_satoshi);
+            }
+            if (const auto max_satoshi = get_int("max_satoshi"); max_satoshi.has_value()) {
+                where += " AND abs(TxAsset.satoshi) <= " + param(*max_satoshi);
+            }
+        }
+
+        const auto type = j_str(query, "type");
+        const auto memo_txids_p = query.find("memo_txids");
+        if (type.has_value() || memo_txids_p != query.end()) {
+            sql += join("TxQuery");
+        }
+        if (type.has_value()) {
+            where += " AND TxQuery.type = " + param(*type);
+        }
+        if (memo_txids_p != query.end()) {
+            // Match either the memo the tx was cached with, or
+            // any of the given txids resolved by the caller
+            std::vector<std::string> matches;
+            if (auto memo = j_str(query, "memo"); memo.has_value()) {
+                matches.emplace_back("instr(lower(TxQuery.memo), lower(" + param(std::move(*memo)) + ")) > 0");
+            }
+            if (!memo_txids_p->empty()) {
+                std::vector<std::array<unsigned char, SHA256_LEN>> txids;
+                txids.reserve(memo_txids_p->size());
+                for (const auto& txid : *memo_txids_p) {
+                    txids.emplace_back(h2b_rev<SHA256_LEN>(txid.get<std::string>()));
+                }
+                std::sort(txids.begin(), txids.end());
+                std::vector<unsigned char> txids_blob;
+                txids_blob.reserve(txids.size() * SHA256_LEN);
+                for (const auto& txid : txids) {
+                    txids_blob.insert(txids_blob.end(), txid.begin(), txid.end());
+                }
+                matches.emplace_back("txid_in(Tx.txid, " + param(std::move(txids_blob)) + ")");
+            }
+            if (matches.empty()) {
+                where += " AND 0"; // Nothing can match
+            } else {
+                where += " AND (" + matches.front() + (matches.size() > 1 ? " OR " + matches.back() : "") + ")";
+            }
+        }
+
+        if (const auto address = j_str(query, "address"); address.has_value()) {
+            where += " AND Tx.timestamp IN (SELECT timestamp FROM TxAddress WHERE subaccount = ?1 AND address = "
+                + param(*address) + ")";
+        }
+        if (const auto start_ts = get_int("start_ts"); start_ts.has_value()) {
+            where += " AND Tx.timestamp >= " + param(*start_ts);
+        }
+        if (const auto end_ts = get_int("end_ts"); end_ts.has_value()) {
+            where += " AND Tx.timestamp <= " + param(*end_ts);
+        }
+        if (const auto before_ts = get_int("before_ts"); before_ts.has_value()) {
+            where += " AND Tx.timestamp < " + param(*before_ts);
+        }
+        if (const auto after_ts = get_int("after_ts"); after_ts.has_value()) {
+            where += " AND Tx.timestamp > " + param(*after_ts);
+        }
+        if (const auto min_block = get_int("min_block_height"); min_block.has_value()) {
+            where += " AND Tx.block >= " + param(std::max(*min_block, int64_t{ 1 }));
+        }
+        if (const auto max_block = get_int("max_block_height"); max_block.has_value()) {
+            // Mempool txs (block 0) are never below a maximum height
+            where += " AND Tx.block > 0 AND Tx.block <= " + param(*max_block);
+        }
+
+        const auto sort_by = j_str(query, "sort_by").value_or("newest");
+        std::string order = " ORDER BY Tx.timestamp DESC";
+        if (sort_by == "oldest") {
+            order = " ORDER BY Tx.timestamp ASC";
+        } else if (sort_by == "largest" || sort_by == "smallest") {
+            GDK_RUNTIME_ASSERT(asset_id.has_value());
+            order = std::string(" ORDER BY abs(TxAsset.satoshi) ") + (sort_by == "largest" ? "DESC" : "ASC")
+                + ", Tx.timestamp DESC";
+        } else {
+            GDK_RUNTIME_ASSERT(sort_by == "newest");
+        }
+        const auto count = param(get_int("count").value_or(30));
+        const auto first = param(get_int("first").value_or(0));
+        sql += where + order + " LIMIT " + count + " OFFSET " + first + ";";
+
+        auto stmt = get_stmt(true, m_db, sql.c_str());
+        const auto _{ stmt_clean(stmt) };
+        for (size_t i = 0; i < params.size(); ++i) {
+            const int column = static_cast<int>(i) + 1;
+            if (const auto* i64 = std::get_if<int64_t>(&params[i])) {
+                bind_signed_int(stmt, column, *i64);
+            } else if (const auto* text = std::get_if<std::string>(&params[i])) {
+                bind_text(stmt, column, *text);
+            } else {
+                bind_blob(stmt, column, std::get<std::vector<unsigned char>>(params[i]));
+            }
+        }
+        while (get_tx(stmt, callback)) {
+            // No-op
+        }
+    }
+
     void cache::set_transaction_spv_verified(const std::string& txhash_hex)
     {
         const auto txid = h2b_rev(txhash_hex);
@@ -678,6 +956,37 @@ namespace green {
         check_db_changed();
     }
 
+    std::optional<std::pair<uint32_t, std::string>> cache::get_transaction_spv_block(const std::string& txhash_hex)
+    {
+        const auto txid = h2b_rev(txhash_hex);
+        const auto _{ stmt_clean(m_stmt_spv_block_search) };
+        bind_blob(m_stmt_spv_block_search, 1, txid);
+        const int rc = sqlite3_step(m_stmt_spv_block_search.get());
+        if (rc == SQLITE_DONE) {
+            return {};
+        }
+        GDK_RUNTIME_ASSERT(rc == SQLITE_ROW);
+        const uint32_t block = get_uint32(m_stmt_spv_block_search, 0);
+        const auto hash = reinterpret_cast<const unsigned char*>(sqlite3_column_blob(m_stmt_spv_block_search.get(), 1));
+        const size_t hash_len = sqlite3_column_bytes(m_stmt_spv_block_search.get(), 1);
+        auto block_hash_hex = b2h({ hash, hash_len });
+        step_final(m_stmt_spv_block_search);
+        return std::make_pair(block, std::move(block_hash_hex));
+    }
+
+    void cache::set_transaction_spv_block(
+        const std::string& txhash_hex, uint32_t block, const std::string& block_hash_hex)
+    {
+        const auto txid = h2b_rev(txhash_hex);
+        const auto block_hash = h2b(block_hash_hex);
+        const auto _{ stmt_clean(m_stmt_spv_block_upsert) };
+        bind_blob(m_stmt_spv_block_upsert, 1, txid);
+        bind_int(m_stmt_spv_block_upsert, 2, block);
+        bind_blob(m_stmt_spv_block_upsert, 3, block_hash);
+        step_final(m_stmt_spv_block_upsert);
+        check_db_changed();
+    }
+
     void cache::delete_transactions(uint32_t subaccount, uint64_t start_ts)
     {
         const auto _{ stmt_clean(m_stmt_tx_delete_all) };
@@ -871,32 +1180,72 @@ namespace green {
 
         step_final(m_stmt_scriptpubkey_insert);
         m_require_write = true;
+        if (m_scriptpubkey_index) {
+            // Keep the index in sync; INSERT OR IGNORE keeps any existing row
+            const auto script_type = address_type_to_script_type(addr_type);
+            m_scriptpubkey_index->emplace(std::string(scriptpubkey.begin(), scriptpubkey.end()),
+                scriptpubkey_data_t{ subaccount, branch, pointer, subtype, script_type });
+        }
     }
 
-    nlohmann::json cache::get_scriptpubkey_data(byte_span_t scriptpubkey)
+    const cache::scriptpubkey_index_t& cache::get_scriptpubkey_index()
+    {
+        if (m_scriptpubkey_index) {
+            return *m_scriptpubkey_index;
+        }
+        // Load every cached scriptpubkey in one pass. Lookups are then served
+        // from memory, and new scriptpubkeys are added as they are inserted
+        GDK_RUNTIME_ASSERT(m_stmt_scriptpubkey_load.get());
+        const auto _{ stmt_clean(m_stmt_scriptpubkey_load) };
+        scriptpubkey_index_t index;
+        int rc;
+        while ((rc = sqlite3_step(m_stmt_scriptpubkey_load.get())) == SQLITE_ROW) {
+            const auto spk = reinterpret_cast<const char*>(sqlite3_column_blob(m_stmt_scriptpubkey_load.get(), 0));
+            const auto spk_len = sqlite3_column_bytes(m_stmt_scriptpubkey_load.get(), 0);
+            index.emplace(std::string(spk, spk_len),
+                scriptpubkey_data_t{ get_uint32(m_stmt_scriptpubkey_load, 1), get_uint32(m_stmt_scriptpubkey_load, 2),
+                    get_uint32(m_stmt_scriptpubkey_load, 3), get_uint32(m_stmt_scriptpubkey_load, 4),
+                    get_uint32(m_stmt_scriptpubkey_load, 5) });
+        }
+        GDK_RUNTIME_ASSERT(rc == SQLITE_DONE);
+        GDK_LOG(debug) << "Loaded " << index.size() << " cached scriptpubkeys";
+        m_scriptpubkey_index = std::move(index);
+        return *m_scriptpubkey_index;
+    }
+
+    nlohmann::json cache::find_scriptpubkey_data(const scriptpubkey_index_t& index, byte_span_t scriptpubkey)
     {
         nlohmann::json utxo;
 
         GDK_RUNTIME_ASSERT(!scriptpubkey.empty());
-        GDK_RUNTIME_ASSERT(m_stmt_scriptpubkey_search.get());
-        const auto _{ stmt_clean(m_stmt_scriptpubkey_search) };
-        bind_blob(m_stmt_scriptpubkey_search, 1, scriptpubkey);
-        const int rc = sqlite3_step(m_stmt_scriptpubkey_search.get());
-        if (rc == SQLITE_DONE) {
+        const auto p = index.find(std::string(scriptpubkey.begin(), scriptpubkey.end()));
+        if (p == index.end()) {
             return utxo;
         }
-        GDK_RUNTIME_ASSERT(rc == SQLITE_ROW);
-        utxo["subaccount"] = get_uint32(m_stmt_scriptpubkey_search, 0);
-        utxo["branch"] = get_uint32(m_stmt_scriptpubkey_search, 1);
-        utxo["pointer"] = get_uint32(m_stmt_scriptpubkey_search, 2);
-        utxo["subtype"] = get_uint32(m_stmt_scriptpubkey_search, 3);
-        const auto script_type = get_uint32(m_stmt_scriptpubkey_search, 4);
-        utxo["address_type"] = address_type_from_script_type(script_type);
-
-        step_final(m_stmt_scriptpubkey_search);
+        utxo["subaccount"] = p->second.subaccount;
+        utxo["branch"] = p->second.branch;
+        utxo["pointer"] = p->second.pointer;
+        utxo["subtype"] = p->second.subtype;
+        utxo["address_type"] = address_type_from_script_type(p->second.script_type);
         return utxo;
     }
 
+    nlohmann::json cache::get_scriptpubkey_data(byte_span_t scriptpubkey)
+    {
+        return find_scriptpubkey_data(get_scriptpubkey_index(), scriptpubkey);
+    }
+
+    nlohmann::json cache::get_scriptpubkeys_data(gsl::span<const byte_span_t> scriptpubkeys)
+    {
+        const auto& index = get_scriptpubkey_index();
+        nlohmann::json::array_t ret;
+        ret.reserve(scriptpubkeys.size());
+        for (const auto& scriptpubkey : scriptpubkeys) {
+            ret.emplace_back(find_scriptpubkey_data(index, scriptpubkey));
+        }
+        return ret;
+    }
+
     uint32_t cache::get_latest_scriptpubkey_pointer(uint32_t subaccount)
     {
         const auto _{ stmt_clean(m_stmt_scriptpubkey_latest_search) };
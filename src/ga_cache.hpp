@@ -7,6 +7,7 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 #include <tuple>
+#include <unordered_map>
 
 struct sqlite3;
 struct sqlite3_stmt;
@@ -51,12 +52,21 @@ namespace green {
             get_transactions_fn;
         void get_transactions(
             uint32_t subaccount, uint64_t start_ts, size_t count, const get_transactions_fn& callback);
+        // Get up to count txs older than before_ts, newest first
+        void get_transactions_before(
+            uint32_t subaccount, uint64_t before_ts, size_t count, const get_transactions_fn& callback);
         void get_transaction(
             uint32_t subaccount, const std::string& txhash_hex, const cache::get_transactions_fn& callback);
+        // Get txs matching a query built by the session, see GA_query_transactions
+        void query_transactions(const nlohmann::json& query, const get_transactions_fn& callback);
         uint64_t get_latest_transaction_timestamp(uint32_t subaccount);
         void insert_transaction(
             uint32_t subaccount, uint64_t timestamp, const std::string& txhash_hex, const nlohmann::json& tx_json);
         void set_transaction_spv_verified(const std::string& txhash_hex);
+        // Get/set the height and hash of the block a tx was SPV verified in
+        std::optional<std::pair<uint32_t, std::string>> get_transaction_spv_block(const std::string& txhash_hex);
+        void set_transaction_spv_block(
+            const std::string& txhash_hex, uint32_t block, const std::string& block_hash_hex);
         void delete_transactions(uint32_t subaccount, uint64_t start_ts = 0);
         bool delete_mempool_txs(uint32_t subaccount);
         bool delete_block_txs(uint32_t subaccount, uint32_t start_block);
@@ -65,6 +75,7 @@ namespace green {
         void insert_transaction_data(const std::string& txhash_hex, byte_span_t value);
 
         nlohmann::json get_scriptpubkey_data(byte_span_t scriptpubkey);
+        nlohmann::json get_scriptpubkeys_data(gsl::span<const byte_span_t> scriptpubkeys);
         void insert_scriptpubkey_data(byte_span_t scriptpubkey, uint32_t subaccount, uint32_t branch, uint32_t pointer,
             uint32_t subtype, const std::string& addr_type);
         uint32_t get_latest_scriptpubkey_pointer(uint32_t subaccount);
@@ -76,6 +87,19 @@ namespace green {
 
     private:
         bool check_db_changed();
+        void insert_transaction_query_data(uint32_t subaccount, uint64_t timestamp, const nlohmann::json& tx_json);
+
+        // In-memory index over the ScriptPubKey table, keyed by raw script
+        struct scriptpubkey_data_t {
+            uint32_t subaccount;
+            uint32_t branch;
+            uint32_t pointer;
+            uint32_t subtype;
+            uint32_t script_type;
+        };
+        using scriptpubkey_index_t = std::unordered_map<std::string, scriptpubkey_data_t>;
+        const scriptpubkey_index_t& get_scriptpubkey_index();
+        static nlohmann::json find_scriptpubkey_data(const scriptpubkey_index_t& index, byte_span_t scriptpubkey);
 
         const std::string m_network_name;
         const std::string m_data_dir;
@@ -95,6 +119,7 @@ namespace green {
         sqlite3_stmt_ptr m_stmt_key_value_search;
         sqlite3_stmt_ptr m_stmt_key_value_delete;
         sqlite3_stmt_ptr m_stmt_tx_search;
+        sqlite3_stmt_ptr m_stmt_tx_search_before;
         sqlite3_stmt_ptr m_stmt_txid_search;
         sqlite3_stmt_ptr m_stmt_tx_latest_search;
         sqlite3_stmt_ptr m_stmt_tx_earliest_mempool_search;
@@ -104,9 +129,15 @@ namespace green {
         sqlite3_stmt_ptr m_stmt_tx_delete_all;
         sqlite3_stmt_ptr m_stmt_txdata_insert;
         sqlite3_stmt_ptr m_stmt_txdata_search;
-        sqlite3_stmt_ptr m_stmt_scriptpubkey_search;
+        sqlite3_stmt_ptr m_stmt_spv_block_search;
+        sqlite3_stmt_ptr m_stmt_spv_block_upsert;
+        sqlite3_stmt_ptr m_stmt_tx_query_upsert;
+        sqlite3_stmt_ptr m_stmt_tx_asset_upsert;
+        sqlite3_stmt_ptr m_stmt_tx_address_upsert;
+        sqlite3_stmt_ptr m_stmt_scriptpubkey_load;
         sqlite3_stmt_ptr m_stmt_scriptpubkey_insert;
         sqlite3_stmt_ptr m_stmt_scriptpubkey_latest_search;
+        std::optional<scriptpubkey_index_t> m_scriptpubkey_index; // Loaded on first lookup
     };
 
 } // namespace green
@@ -9,6 +9,7 @@
 #include "utils.hpp"
 #include "xpub_hdkey.hpp"
 
+#include <limits>
 #include <nlohmann/json.hpp>
 
 #include <wally_psbt.h>
@@ -58,6 +59,8 @@ namespace green {
         constexpr uint32_t out_blind_value_proof = 0x09;
         constexpr uint32_t out_blind_asset_proof = 0x0a;
 
+        constexpr size_t NO_SCRIPTPUBKEY = std::numeric_limits<size_t>::max();
+
         using optional_bytes_t = std::optional<gsl::span<const unsigned char>>;
 
         static void set_field(struct wally_map& m, uint32_t k, byte_span_t value)
@@ -562,6 +565,19 @@ namespace green {
 
         nlohmann::json::array_t outputs;
         outputs.resize(get_num_outputs());
+
+        // Look up all output scriptpubkeys in one call, rather than per-output
+        std::vector<byte_span_t> scriptpubkeys;
+        std::vector<size_t> scriptpubkey_indices(outputs.size(), NO_SCRIPTPUBKEY);
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            const auto& txout = get_output(i);
+            if (txout.script && txout.script_len) {
+                scriptpubkey_indices[i] = scriptpubkeys.size();
+                scriptpubkeys.emplace_back(txout.script, txout.script_len);
+            }
+        }
+        auto outputs_data = session.get_scriptpubkeys_data(scriptpubkeys);
+
         for (size_t i = 0; i < outputs.size(); ++i) {
             const auto& txout = get_output(i);
             auto& jsonout = outputs[i];
@@ -598,7 +614,8 @@ namespace green {
                 GDK_RUNTIME_ASSERT(txout.script);
                 jsonout["scriptpubkey"] = b2h({ txout.script, txout.script_len });
             }
-            auto output_data = session.get_scriptpubkey_data({ txout.script, txout.script_len });
+            GDK_RUNTIME_ASSERT(scriptpubkey_indices[i] != NO_SCRIPTPUBKEY);
+            auto& output_data = outputs_data.at(scriptpubkey_indices[i]);
             const bool is_wallet_output = !output_data.empty();
             if (!is_wallet_output) {
                 jsonout["address"] = get_address_from_scriptpubkey(net_params, { txout.script, txout.script_len });
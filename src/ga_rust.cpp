@@ -17,6 +17,7 @@
 #include "json_utils.hpp"
 #include "logging.hpp"
 #include "memory.hpp"
+#include "network_cache.hpp"
 #include "session.hpp"
 #include "signer.hpp"
 #include "transaction_utils.hpp"
@@ -583,8 +584,15 @@ namespace green {
     Tx ga_rust::get_raw_transaction_details(const std::string& txhash_hex) const
     {
         try {
+            auto& net_cache = get_network_cache();
+            const auto txid = h2b_rev<WALLY_TXHASH_LEN>(txhash_hex);
+            if (const auto shared_tx = net_cache.get_raw_tx(txid); shared_tx) {
+                return Tx(*shared_tx, m_net_params.is_liquid());
+            }
             const std::string tx_hex = rust_call("get_transaction_hex", nlohmann::json(txhash_hex), m_session);
-            return Tx(tx_hex, m_net_params.is_liquid());
+            Tx tx(tx_hex, m_net_params.is_liquid());
+            net_cache.set_raw_tx(txid, tx);
+            return tx;
         } catch (const std::exception& e) {
             GDK_LOG(warning) << "Error fetching " << txhash_hex << " : " << e.what();
             throw user_error("Transaction not found");
@@ -600,6 +608,17 @@ namespace green {
         }
     }
 
+    nlohmann::json ga_rust::get_scriptpubkeys_data(gsl::span<const byte_span_t> scriptpubkeys)
+    {
+        nlohmann::json::array_t scriptpubkeys_hex;
+        scriptpubkeys_hex.reserve(scriptpubkeys.size());
+        for (const auto& scriptpubkey : scriptpubkeys) {
+            scriptpubkeys_hex.emplace_back(b2h(scriptpubkey));
+        }
+        // Returns null elements for non-wallet scriptpubkeys
+        return rust_call("get_scriptpubkeys_data", scriptpubkeys_hex, m_session);
+    }
+
     nlohmann::json ga_rust::send_transaction(const nlohmann::json& details, const nlohmann::json& /*twofactor_data*/)
     {
         return broadcast_transaction(details);
@@ -666,37 +685,50 @@ namespace green {
         throw std::runtime_error("ack_system_message not implemented");
     }
 
-    nlohmann::json ga_rust::convert_amount(const nlohmann::json& amount_json) const
+    std::pair<std::string, fiat_rate> ga_rust::get_fiat_currency_and_rate(const nlohmann::json& details) const
     {
         nlohmann::json pricing;
 
-        auto param_pricing = amount_json.value("pricing", nlohmann::json::object());
+        auto param_pricing = details.value("pricing", nlohmann::json::object());
         if (param_pricing.empty()) {
             pricing = get_settings().value("pricing", nlohmann::json({ { "currency", "" }, { "exchange", "" } }));
         } else {
             pricing = param_pricing;
         }
 
-        std::string currency = amount_json.value("fiat_currency", pricing["currency"]);
+        std::string currency = details.value("fiat_currency", pricing["currency"]);
         std::string exchange = pricing["exchange"];
 
-        std::string fiat_rate;
+        std::string rate;
 
         if (!currency.empty() && !exchange.empty()) {
             auto currency_query = nlohmann::json({ { "currencies", currency } });
             currency_query["price_url"] = m_net_params.get_price_url();
-            currency_query["fallback_rate"] = amount_json.value("fiat_rate", "");
+            currency_query["fallback_rate"] = details.value("fiat_rate", "");
             currency_query["exchange"] = exchange;
 
             try {
                 auto xrates = rust_call("exchange_rates", currency_query, m_session)["currencies"];
-                fiat_rate = xrates.value(currency, "");
+                rate = xrates.value(currency, "");
             } catch (const std::exception& ex) {
                 GDK_LOG(warning) << "cannot fetch exchange rate " << ex.what();
             }
         }
 
-        return amount::convert(amount_json, currency, fiat_rate);
+        return { std::move(currency), fiat_rate(rate) };
+    }
+
+    nlohmann::json ga_rust::convert_amount(const nlohmann::json& amount_json) const
+    {
+        const auto [currency, rate] = get_fiat_currency_and_rate(amount_json);
+        return amount::convert(amount_json, currency, rate);
+    }
+
+    nlohmann::json ga_rust::convert_amounts(const nlohmann::json& amounts_json) const
+    {
+        // Fetch the rate once for all amounts
+        const auto [currency, rate] = get_fiat_currency_and_rate(amounts_json);
+        return amount::convert_batch(amounts_json, currency, rate);
     }
 
     amount ga_rust::get_min_fee_rate() const
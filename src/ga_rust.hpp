@@ -92,6 +92,7 @@ namespace green {
         Tx get_raw_transaction_details(const std::string& txhash_hex) const;
 
         nlohmann::json get_scriptpubkey_data(byte_span_t scriptpubkey);
+        nlohmann::json get_scriptpubkeys_data(gsl::span<const byte_span_t> scriptpubkeys);
         nlohmann::json send_transaction(const nlohmann::json& details, const nlohmann::json& twofactor_data);
         nlohmann::json broadcast_transaction(const nlohmann::json& details);
 
@@ -108,6 +109,7 @@ namespace green {
         void ack_system_message(const std::string& message_hash_hex, const std::string& sig_der_hex);
 
         nlohmann::json convert_amount(const nlohmann::json& amount_json) const;
+        nlohmann::json convert_amounts(const nlohmann::json& amounts_json) const;
 
         void upload_confidential_addresses(uint32_t subaccount, const std::vector<std::string>& confidential_addresses);
 
@@ -132,6 +134,7 @@ namespace green {
         void on_post_login();
 
         nlohmann::json get_local_subaccounts_data();
+        std::pair<std::string, fiat_rate> get_fiat_currency_and_rate(const nlohmann::json& details) const;
 
         void* m_session;
     };
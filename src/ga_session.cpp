@@ -32,6 +32,8 @@
 #include "json_utils.hpp"
 #include "logging.hpp"
 #include "memory.hpp"
+#include "metrics.hpp"
+#include "network_cache.hpp"
 #include "signer.hpp"
 #include "threading.hpp"
 #include "transaction_utils.hpp"
@@ -266,6 +268,25 @@ namespace green {
             }
             return ret;
         }
+
+        // Parse a page cursor as returned by GA_get_transactions/GA_query_transactions
+        static std::optional<uint64_t> get_tx_cursor(const nlohmann::json& details)
+        {
+            const auto cursor = j_str(details, "cursor");
+            if (!cursor.has_value()) {
+                return {};
+            }
+            try {
+                size_t parsed = 0;
+                const uint64_t timestamp = std::stoull(*cursor, &parsed);
+                if (parsed == cursor->size() && timestamp) {
+                    return timestamp;
+                }
+            } catch (const std::exception&) {
+                // Fall through
+            }
+            throw user_error("invalid \"cursor\" value");
+        }
     } // namespace
 
     ga_session::ga_session(network_parameters&& net_params)
@@ -273,6 +294,7 @@ namespace green {
         , m_spv_enabled(m_net_params.is_spv_enabled())
         , m_min_fee_rate(m_net_params.is_liquid() ? DEFAULT_MIN_FEE_LIQUID : DEFAULT_MIN_FEE)
         , m_earliest_block_time(0)
+        , m_address_pool_generation(0)
         , m_next_subaccount(0)
         , m_fee_estimates_ts(std::chrono::system_clock::now())
         , m_system_message_id(0)
@@ -284,12 +306,13 @@ namespace green {
         , m_user_agent(std::string(GDK_COMMIT) + " " + m_net_params.user_agent())
         , m_spv_thread_done(false)
         , m_spv_thread_stop(false)
+        , m_spv_sync_requested(false)
     {
         m_user_pubkeys = std::make_unique<green_user_pubkeys>(m_net_params);
 
         constexpr bool is_mandatory = true;
         m_wamp = std::make_shared<wamp_transport>(
-            m_net_params, *session_impl::m_strand,
+            m_net_params, m_io->get_wamp_io_context(), *session_impl::m_strand,
             [this](nlohmann::json details, bool async) { emit_notification(std::move(details), async); }, "wamp",
             is_mandatory);
         m_wamp_connections.push_back(m_wamp);
@@ -299,6 +322,9 @@ namespace green {
 
     ga_session::~ga_session()
     {
+        if (m_login_reconcile.valid()) {
+            no_std_exception_escape([this] { m_login_reconcile.wait(); });
+        }
         m_wamp.reset();
         m_notify = false;
         no_std_exception_escape([this] { reset_all_session_data(true); });
@@ -630,6 +656,7 @@ namespace green {
         }
 
         set_fee_estimates(locker, m_login_data["fee_estimates"]);
+        get_network_cache().set_fee_estimates(m_login_data["fee_estimates"]);
 
         // Notify the caller of their settings / 2fa reset status
         auto settings = get_settings(locker);
@@ -673,13 +700,14 @@ namespace green {
         GDK_RUNTIME_ASSERT(locker.owns_lock());
         // TODO: Remove None check when backends are fixed
         if (rate_str.empty() || rate_str == "None") {
-            m_fiat_rate.clear(); // No rate available
+            m_fiat_rate = fiat_rate(); // No rate available
             return;
         }
         try {
-            m_fiat_rate = amount::format_amount(rate_str, 8);
+            // Parse the rate once here rather than in every conversion
+            m_fiat_rate = fiat_rate(amount::format_amount(rate_str, 8));
         } catch (const std::exception& e) {
-            m_fiat_rate.clear();
+            m_fiat_rate = fiat_rate();
             GDK_LOG(error) << "failed to update fiat rate from string '" << rate_str << "': " << e.what();
         }
     }
@@ -925,10 +953,9 @@ namespace green {
                 reorg_block = last_seen_block_height - num_reorg_blocks;
                 GDK_LOG(debug) << "Tx sync: removing " << num_reorg_blocks << " blocks from cache tip "
                                << last_seen_block_height;
-
-                // We can't trust the SPV state of any txs younger than the
-                // max reorg depth, so clear them.
-                m_spv_verified_txs.clear();
+                // Note that SPV results for txs younger than the max reorg
+                // depth are re-checked against their block hash when next
+                // returned (see postprocess_transactions)
             }
 
             // Update the tx cache.
@@ -957,6 +984,7 @@ namespace green {
             last = details;
             m_cache->set_latest_block(last["block_height"]);
             m_cache->save_db();
+            get_network_cache().on_new_block(last.value("block_hash", std::string()));
 
             // Start syncing headers for SPV (if enabled)
             constexpr bool do_start = true;
@@ -1051,8 +1079,16 @@ namespace green {
 
     nlohmann::json ga_session::authenticate(const std::string& sig_der_hex, std::shared_ptr<signer> signer)
     {
+        if (m_login_reconcile.valid()) {
+            // Wait for any previous optimistic login to finish refreshing
+            m_login_reconcile.wait();
+        }
+
         locker_t locker(m_mutex);
         const bool is_relogin = set_signer(locker, signer);
+        // Optimistic logins use our cached data even if it is out of date,
+        // and refresh it from the server after login completes
+        const bool is_optimistic = !is_relogin && m_net_params.is_optimistic_login();
 
         constexpr bool minimal = true; // Don't return balance/nlocktime info
         const std::string id; // Device id, no longer used
@@ -1121,7 +1157,7 @@ namespace green {
             }
         }
 
-        get_cached_local_client_blob(locker, server_hmac);
+        get_cached_local_client_blob(locker, server_hmac, is_optimistic && is_blob_on_server);
 
         if (is_blob_on_server) {
             // The server has a blob for this wallet. If we haven't got an
@@ -1144,7 +1180,39 @@ namespace green {
         m_cache->save_db();
 
         constexpr bool watch_only = false;
-        return on_post_login(locker, login_data, m_signer->get_master_bip32_xpub(), watch_only, is_relogin);
+        auto ret = on_post_login(locker, login_data, m_signer->get_master_bip32_xpub(), watch_only, is_relogin);
+        if (is_optimistic) {
+            // Note that locker is unlocked at this point
+            m_login_reconcile = std::async(std::launch::async, [this] {
+                no_std_exception_escape([this] { reconcile_optimistic_login(); }, "login reconcile");
+            });
+        }
+        return ret;
+    }
+
+    void ga_session::reconcile_optimistic_login()
+    {
+        std::vector<uint32_t> updated;
+        {
+            locker_t locker(m_mutex);
+            if (!m_signer) {
+                return; // Logged out before we started
+            }
+            std::map<uint32_t, nlohmann::json> cached;
+            for (const auto& sa : m_subaccounts) {
+                cached.emplace(sa.first, m_blob->get_subaccount_data(sa.first));
+            }
+            sync_client_blob(locker);
+            for (const auto& sa : cached) {
+                if (m_blob->get_subaccount_data(sa.first) != sa.second) {
+                    updated.push_back(sa.first);
+                }
+            }
+        }
+        for (const auto pointer : updated) {
+            nlohmann::json ntf = { { "pointer", pointer }, { "event_type", "updated" } };
+            emit_notification({ { "event", "subaccount" }, { "subaccount", std::move(ntf) } }, false);
+        }
     }
 
     void ga_session::subscribe_all(session_impl::locker_t& locker)
@@ -1178,7 +1246,8 @@ namespace green {
         m_wamp->subscribe("com.greenaddress.blocks", [this](nlohmann::json event) { on_new_block(event, false); });
     }
 
-    void ga_session::get_cached_local_client_blob(session_impl::locker_t& locker, const std::string& server_hmac)
+    void ga_session::get_cached_local_client_blob(
+        session_impl::locker_t& locker, const std::string& server_hmac, bool allow_stale)
     {
         GDK_RUNTIME_ASSERT(locker.owns_lock());
         if (m_blob->get_hmac().empty()) {
@@ -1187,7 +1256,7 @@ namespace green {
             if (m_watch_only) {
                 db_hmac = m_cache->get_key_value_string("client_blob_hmac");
             }
-            m_cache->get_key_value("client_blob", { [this, &db_hmac, &server_hmac](const auto& db_blob) {
+            m_cache->get_key_value("client_blob", { [this, &db_hmac, &server_hmac, allow_stale](const auto& db_blob) {
                 if (db_blob.has_value()) {
                     GDK_RUNTIME_ASSERT(m_watch_only || m_blob->has_hmac_key());
                     if (!m_watch_only) {
@@ -1196,6 +1265,10 @@ namespace green {
                     if (db_hmac == server_hmac) {
                         // Cached blob is current, load it
                         m_blob->load(*db_blob, server_hmac);
+                    } else if (allow_stale && !db_hmac.empty()) {
+                        // Load our out of date blob; it is re-synced on first use
+                        m_blob->load(*db_blob, db_hmac);
+                        m_blob->set_is_outdated();
                     }
                 }
             } });
@@ -1268,6 +1341,8 @@ namespace green {
         GDK_RUNTIME_ASSERT(locker.owns_lock());
         swap_with_default(m_tx_notifications);
         m_nlocktimes.reset();
+        m_address_pool.clear();
+        ++m_address_pool_generation;
     }
 
     void ga_session::reset_all_session_data(bool in_dtor)
@@ -1282,6 +1357,8 @@ namespace green {
             swap_with_default(m_limits_data);
             swap_with_default(m_twofactor_config);
             swap_with_default(m_subaccounts);
+            m_address_pool.clear();
+            ++m_address_pool_generation;
             m_green_pubkeys.reset();
             m_user_pubkeys->clear();
             m_recovery_pubkeys.reset();
@@ -1507,6 +1584,11 @@ namespace green {
             m_signer->set_master_blinding_key(blinding_key_hex);
         }
 
+        if (!is_relogin) {
+            m_cache->update_to_latest_minor_version();
+        }
+        m_cache->save_db();
+
         constexpr bool watch_only = true;
         auto ret = on_post_login(locker, login_data, root_bip32_xpub, watch_only, is_relogin);
 
@@ -1546,10 +1628,16 @@ namespace green {
         locker_t locker(m_mutex);
 
         if (now < m_fee_estimates_ts || now - m_fee_estimates_ts > 120s) {
-            // Time adjusted or more than 2 minutes old: Update
-            constexpr bool return_min = true;
-            auto fee_estimates = m_wamp->call(locker, "login.get_fee_estimates", return_min);
-            set_fee_estimates(locker, wamp_cast_json(fee_estimates));
+            // Time adjusted or more than 2 minutes old: Update, using the
+            // estimates fetched by another session on this network if recent
+            auto& net_cache = get_network_cache();
+            auto fee_estimates = net_cache.get_fee_estimates(120s);
+            if (fee_estimates.is_null()) {
+                constexpr bool return_min = true;
+                fee_estimates = wamp_cast_json(m_wamp->call(locker, "login.get_fee_estimates", return_min));
+                net_cache.set_fee_estimates(fee_estimates);
+            }
+            set_fee_estimates(locker, fee_estimates);
         }
 
         // TODO: augment with last_updated, user preference for display?
@@ -1619,6 +1707,12 @@ namespace green {
         return amount::convert(amount_json, m_fiat_currency, m_fiat_rate);
     }
 
+    nlohmann::json ga_session::convert_amounts(const nlohmann::json& amounts_json) const
+    {
+        locker_t locker(m_mutex);
+        return amount::convert_batch(amounts_json, m_fiat_currency, m_fiat_rate);
+    }
+
     nlohmann::json ga_session::convert_fiat_cents(session_impl::locker_t& locker, amount::value_type fiat_cents) const
     {
         GDK_RUNTIME_ASSERT(locker.owns_lock());
@@ -1892,6 +1986,7 @@ namespace green {
         unique_pubkeys_and_scripts_t& missing)
     {
         GDK_RUNTIME_ASSERT(locker.owns_lock());
+        metrics::scoped_timer timer("unblind_utxo");
         amount::value_type value;
 
         if (boost::conversion::try_lexical_convert(j_str_or_empty(utxo, "value"), value)) {
@@ -1926,8 +2021,14 @@ namespace green {
         const auto script = j_bytesref(utxo, "script");
         const bool has_address = !j_str_is_empty(utxo, "address");
 
+        // Note the cache is keyed by the txhash in display order
+        std::optional<txid_t> txhash_bin;
         if (!txhash.empty()) {
-            const auto cached = m_cache->get_liquid_output(h2b(txhash), pt_idx);
+            txhash_bin = h2b<WALLY_TXHASH_LEN>(txhash);
+        }
+
+        if (txhash_bin) {
+            const auto cached = m_cache->get_liquid_output(*txhash_bin, pt_idx);
             if (!cached.empty()) {
                 utxo.update(cached.begin(), cached.end());
                 constexpr bool mark_unconfidential = true;
@@ -1986,8 +2087,8 @@ namespace green {
         remove_utxo_proofs(utxo, mark_unconfidential);
 
         bool updated_blinding_cache = false;
-        if (!txhash.empty()) {
-            m_cache->insert_liquid_output(h2b(txhash), pt_idx, utxo);
+        if (txhash_bin) {
+            m_cache->insert_liquid_output(*txhash_bin, pt_idx, utxo);
             updated_blinding_cache = true;
         }
 
@@ -2158,9 +2259,8 @@ namespace green {
             const std::string txhash = tx_details["txhash"];
             const uint32_t tx_block_height = tx_details["block_height"];
 
-            std::map<std::string, int64_t> totals; /* Note: signed */
+            asset_id_map_t<int64_t> totals; /* Note: signed */
             std::map<uint32_t, nlohmann::json> in_map, out_map;
-            std::set<std::string> unique_asset_ids;
 
             if (is_liquid) {
                 // Ublind, clean up and categorize the endpoints
@@ -2172,8 +2272,7 @@ namespace green {
                 const bool is_relevant = ep.at("is_relevant");
 
                 if (is_relevant && ep.find("error") == ep.end()) {
-                    const auto asset_id = j_assetref(is_liquid, ep);
-                    unique_asset_ids.emplace(asset_id);
+                    const auto asset_id = j_asset_idref(is_liquid, ep);
 
                     // Compute the effect of the input/output on the wallets balance
                     // TODO: Figure out what redeemable value for social payments is about
@@ -2210,24 +2309,24 @@ namespace green {
             tx_details.erase("eps");
 
             if (!is_liquid) {
-                GDK_RUNTIME_ASSERT(unique_asset_ids.size() == 1 && *unique_asset_ids.begin() == "btc");
+                GDK_RUNTIME_ASSERT(totals.size() == 1 && asset_id_to_json(totals.begin()->first) == "btc");
             }
 
             // TODO: improve the detection of tx type.
             bool seen_positive = false, seen_negative = false;
 
-            for (const auto& asset_id : unique_asset_ids) {
-                const auto& total = totals[asset_id];
+            auto& tx_satoshi = tx_details["satoshi"];
+            for (const auto& [asset_id, total] : totals) {
                 seen_positive |= total > 0;
                 seen_negative |= total < 0;
-                tx_details["satoshi"][asset_id] = total;
+                tx_satoshi[asset_id_to_json(asset_id)] = total;
             }
 
             const bool is_confirmed = tx_block_height != 0;
             bool can_rbf = false, can_cpfp = false;
 
             std::string tx_type;
-            if (is_liquid && unique_asset_ids.empty()) {
+            if (is_liquid && totals.empty()) {
                 // Failed to unblind all relevant inputs and outputs. This
                 // might be a spam transaction.
                 tx_type = "not unblindable";
@@ -2301,6 +2400,7 @@ namespace green {
         const uint32_t current_block = m_last_block_notification["block_height"];
         const uint32_t num_reorg_blocks = std::min(m_net_params.get_max_reorg_blocks(), current_block);
         const uint32_t reorg_block = current_block - num_reorg_blocks;
+        const auto current_block_hash = m_last_block_notification.value("block_hash", std::string());
         bool are_downloading = false;
 
         nlohmann::json spv_params;
@@ -2309,6 +2409,33 @@ namespace green {
             spv_params = get_net_call_params(locker, timeout_secs);
         }
 
+        const auto set_spv_status = [&](nlohmann::json& tx_details, std::string spv_status,
+                                        const std::string& block_hash, bool can_cache) {
+            const uint32_t tx_block_height = tx_details["block_height"];
+            const std::string& txhash_hex = j_strref(tx_details, "txhash");
+            GDK_LOG(debug) << txhash_hex << " status " << spv_status;
+            if (!are_downloading && spv_status == "in_progress") {
+                // Start syncing headers for SPV if we aren't already doing it
+                constexpr bool do_start = true;
+                download_headers_ctl(locker, do_start);
+                are_downloading = true;
+            }
+            if (can_cache && spv_status == "verified") {
+                if (!block_hash.empty()) {
+                    // Persist the block we verified in, so the tx can be
+                    // re-checked cheaply if it is within the reorg depth
+                    m_cache->set_transaction_spv_block(txhash_hex, tx_block_height, block_hash);
+                }
+                if (tx_block_height < reorg_block) {
+                    // Verified and committed beyond our reorg depth, update the cache
+                    m_cache->set_transaction_spv_verified(txhash_hex);
+                }
+            }
+            tx_details["spv_verified"] = std::move(spv_status);
+        };
+
+        std::vector<nlohmann::json*> unverified;
+        nlohmann::json::array_t verify_txs;
         for (auto& tx_details : tx_list) {
             const uint32_t tx_block_height = tx_details["block_height"];
             auto& spv_verified = tx_details["spv_verified"];
@@ -2325,34 +2452,43 @@ namespace green {
                 continue; // Need to be confirmed before we can verify
             }
 
-            const std::string txhash_hex = tx_details["txhash"];
-            spv_params["txid"] = txhash_hex;
-            spv_params["height"] = tx_block_height;
-
-            std::string spv_status;
-            if (m_spv_verified_txs.count(txhash_hex)) {
-                GDK_LOG(debug) << txhash_hex << " cached as verified";
-                spv_status = "verified"; // Previously verified
-            } else {
-                spv_status = spv_get_status_string(spv_verify_tx(spv_params));
-                GDK_LOG(debug) << txhash_hex << " status " << spv_status;
-            }
-            if (!are_downloading && spv_status == "in_progress") {
-                // Start syncing headers for SPV if we aren't already doing it
-                constexpr bool do_start = true;
-                download_headers_ctl(locker, do_start);
-                are_downloading = true;
-            }
-            if (spv_status == "verified") {
+            const std::string& txhash_hex = j_strref(tx_details, "txhash");
+            nlohmann::json verify_tx = { { "txid", txhash_hex }, { "height", tx_block_height } };
+            const auto spv_block = m_cache->get_transaction_spv_block(txhash_hex);
+            if (spv_block.has_value() && spv_block->first == tx_block_height) {
+                // Previously verified in a block at the same height
                 if (tx_block_height < reorg_block) {
-                    // Verified and committed beyond our reorg depth, update the cache
-                    m_cache->set_transaction_spv_verified(txhash_hex);
-                } else {
-                    // Not committed beyond reorg depth: cache in memory only
-                    m_spv_verified_txs.insert(txhash_hex);
+                    // The block is now beyond our reorg depth and can't change
+                    GDK_LOG(debug) << txhash_hex << " cached as verified";
+                    constexpr bool can_cache = true;
+                    set_spv_status(tx_details, "verified", spv_block->second, can_cache);
+                    continue;
                 }
+                // Only needs re-verifying if its block hash has changed
+                verify_tx["block_hash"] = spv_block->second;
+            }
+            // Needs verifying
+            verify_txs.push_back(std::move(verify_tx));
+            unverified.push_back(&tx_details);
+        }
+
+        if (!unverified.empty()) {
+            // Verify all unverified txs in one call, without holding the lock
+            spv_params["txs"] = std::move(verify_txs);
+            nlohmann::json spv_results;
+            {
+                unique_unlock unlocker(locker);
+                spv_results = spv_verify_txs(spv_params);
+            }
+            // If the chain tip changed while we were unlocked, the results
+            // are still valid to return, but may not be safe to cache
+            const bool can_cache = m_last_block_notification.value("block_hash", std::string()) == current_block_hash;
+            for (size_t i = 0; i < unverified.size(); ++i) {
+                const auto& spv_result = spv_results.at(i);
+                const auto spv_status = spv_get_status_string(j_uint32ref(spv_result, "spv_status"));
+                const auto block_hash = j_str_or_empty(spv_result, "block_hash");
+                set_spv_status(*unverified[i], spv_status, block_hash, can_cache);
             }
-            spv_verified = std::move(spv_status);
         }
         m_cache->save_db(); // No-op if unchanged
     }
@@ -2360,7 +2496,8 @@ namespace green {
     nlohmann::json ga_session::get_transactions(const nlohmann::json& details)
     {
         const uint32_t subaccount = details.at("subaccount");
-        const uint32_t first = details.at("first");
+        const auto cursor = get_tx_cursor(details);
+        const uint32_t first = cursor.has_value() ? 0 : j_uint32ref(details, "first");
         const uint32_t count = details.at("count");
         nlohmann::json::array_t result;
         result.reserve(std::min(count, 1000u)); // Prevent reallocs for reasonable fetches
@@ -2375,11 +2512,106 @@ namespace green {
             return nlohmann::json(false);
         }
 
-        m_cache->get_transactions(subaccount, first, count,
+        const cache::get_transactions_fn fn = [&result](uint64_t /*ts*/, const std::string& /*txhash*/,
+                                                  uint32_t /*block*/, uint32_t /*spent*/, uint32_t spv_status,
+                                                  nlohmann::json& tx_json) {
+            // TODO: Remove transaction_size.erase when cache version
+            // is upgraded beyond 1.3 and clears transactions.
+            tx_json.erase("transaction_size");
+            tx_json["spv_verified"] = spv_get_status_string(spv_status);
+            result.emplace_back(std::move(tx_json));
+        };
+        if (cursor.has_value()) {
+            // Seek directly to the txs older than the previous page
+            m_cache->get_transactions_before(subaccount, *cursor, count, fn);
+        } else {
+            m_cache->get_transactions(subaccount, first, count, fn);
+        }
+
+        return nlohmann::json(std::move(result));
+    }
+
+    nlohmann::json ga_session::query_transactions(const nlohmann::json& details)
+    {
+        const bool is_liquid = m_net_params.is_liquid();
+        const uint32_t subaccount = details.at("subaccount");
+        const auto cursor = get_tx_cursor(details);
+        const uint32_t first = cursor.has_value() ? 0 : j_uint32_or_zero(details, "first");
+        const uint32_t count = j_uint32(details, "count").value_or(30);
+
+        // Validate the query and convert it into the form the cache expects
+        nlohmann::json query = { { "subaccount", subaccount }, { "first", first }, { "count", count } };
+        for (const auto key : { "start_ts", "end_ts", "min_block_height", "max_block_height", "min_satoshi",
+                 "max_satoshi" }) {
+            if (const auto value_p = details.find(key); value_p != details.end()) {
+                if (!value_p->is_number_unsigned()) {
+                    throw user_error(std::string("invalid \"") + key + "\" value");
+                }
+                query[key] = *value_p;
+            }
+        }
+        if (auto type = j_str(details, "type"); type.has_value()) {
+            static const std::array<std::string, 5> TX_TYPES
+                = { "incoming", "outgoing", "redeposit", "mixed", "not unblindable" };
+            if (std::find(TX_TYPES.begin(), TX_TYPES.end(), *type) == TX_TYPES.end()) {
+                throw user_error("invalid \"type\" value");
+            }
+            query["type"] = std::move(*type);
+        }
+        if (auto address = j_str(details, "address"); address.has_value()) {
+            query["address"] = std::move(*address);
+        }
+        auto sort_by = j_str(details, "sort_by").value_or("newest");
+        const bool sort_by_amount = sort_by == "largest" || sort_by == "smallest";
+        if (!sort_by_amount && sort_by != "newest" && sort_by != "oldest") {
+            throw user_error("invalid \"sort_by\" value");
+        }
+        if (cursor.has_value()) {
+            if (sort_by_amount) {
+                throw user_error("\"cursor\" cannot be used when sorting by amount");
+            }
+            // Seek directly to the txs following the previous page
+            query[sort_by == "newest" ? "before_ts" : "after_ts"] = *cursor;
+        }
+        query["sort_by"] = std::move(sort_by);
+        if (details.contains("asset_id")) {
+            // Txs are indexed by the keys of their "satoshi" map
+            query["asset_id"] = j_assetref(is_liquid, details);
+        } else if (sort_by_amount || query.contains("min_satoshi") || query.contains("max_satoshi")) {
+            // Amount filters and sorting apply to the policy asset by default
+            query["asset_id"] = is_liquid ? m_net_params.get_policy_asset() : std::string("btc");
+        }
+
+        nlohmann::json::array_t result;
+        result.reserve(std::min(count, 1000u)); // Prevent reallocs for reasonable fetches
+        locker_t locker(m_mutex);
+        const auto timestamp = m_cache->get_latest_transaction_timestamp(subaccount);
+        if (details["sync_ts"] != timestamp) {
+            GDK_LOG(debug) << "Tx sync(" << subaccount << ") disrupted before query: " << details["sync_ts"]
+                           << " != " << timestamp;
+            return nlohmann::json(false);
+        }
+
+        if (const auto memo = j_str_or_empty(details, "memo"); !memo.empty()) {
+            // Memos are held in the client blob, which the cache can't search.
+            // Resolve the txids with matching memos and pass them to the cache
+            sync_client_blob(locker);
+            nlohmann::json::array_t memo_txids;
+            for (const auto& item : m_blob->get_tx_memos().items()) {
+                if (boost::algorithm::icontains(item.value().get_ref<const std::string&>(), memo)) {
+                    memo_txids.emplace_back(item.key());
+                }
+            }
+            query["memo_txids"] = std::move(memo_txids);
+            if (!m_blobserver) {
+                // Without a blobserver, memos stored by the Green backend take precedence
+                query["memo"] = memo;
+            }
+        }
+
+        m_cache->query_transactions(query,
             { [&result](uint64_t /*ts*/, const std::string& /*txhash*/, uint32_t /*block*/, uint32_t /*spent*/,
                   uint32_t spv_status, nlohmann::json& tx_json) {
-                // TODO: Remove transaction_size.erase when cache version
-                // is upgraded beyond 1.3 and clears transactions.
                 tx_json.erase("transaction_size");
                 tx_json["spv_verified"] = spv_get_status_string(spv_status);
                 result.emplace_back(std::move(tx_json));
@@ -2418,16 +2650,18 @@ namespace green {
         }
         do {
             const nlohmann::json result = get_previous_addresses(details);
-            for (auto& address : result.at("list")) {
-                const bool allow_unconfidential = true;
-                const auto spk = scriptpubkey_from_address(m_net_params, address.at("address"), allow_unconfidential);
+            // Insert the scriptpubkeys for each page of addresses in one batch.
+            // update_address_info has already computed each scriptpubkey.
+            locker_t locker(m_mutex);
+            for (const auto& address : result.at("list")) {
                 const uint32_t branch = j_uint32(address, "branch").value_or(1);
                 const uint32_t pointer = j_uint32ref(address, "pointer");
                 const uint32_t subtype = j_uint32_or_zero(address, "subtype");
                 const auto& addr_type = j_strref(address, "address_type");
-                locker_t locker(m_mutex);
-                m_cache->insert_scriptpubkey_data(spk, subaccount, branch, pointer, subtype, addr_type);
+                m_cache->insert_scriptpubkey_data(
+                    j_bytesref(address, "scriptpubkey"), subaccount, branch, pointer, subtype, addr_type);
             }
+            locker.unlock();
             if (result.contains("last_pointer")) {
                 details["last_pointer"] = result.at("last_pointer");
                 current_last_pointer = details["last_pointer"];
@@ -2446,6 +2680,12 @@ namespace green {
         return m_cache->get_scriptpubkey_data(scriptpubkey);
     }
 
+    nlohmann::json ga_session::get_scriptpubkeys_data(gsl::span<const byte_span_t> scriptpubkeys)
+    {
+        locker_t locker(m_mutex);
+        return m_cache->get_scriptpubkeys_data(scriptpubkeys);
+    }
+
     nlohmann::json ga_session::get_unspent_outputs(const nlohmann::json& details, unique_pubkeys_and_scripts_t& missing)
     {
         const auto subaccount = j_uint32ref(details, "subaccount");
@@ -2517,16 +2757,22 @@ namespace green {
         }
 
         // Return the UTXOs grouped by asset id
-        // FIXME: Move the results from utxos instead of copying
-        nlohmann::json asset_utxos;
-        for (const auto& utxo : utxos) {
+        asset_id_map_t<nlohmann::json::array_t> grouped;
+        nlohmann::json::array_t errors;
+        for (auto& utxo : utxos) {
             if (utxo.contains("error")) {
-                asset_utxos["error"].emplace_back(utxo);
+                errors.emplace_back(std::move(utxo));
             } else {
-                const auto utxo_asset_id = j_assetref(is_liquid, utxo);
-                asset_utxos[utxo_asset_id].emplace_back(utxo);
+                grouped[j_asset_idref(is_liquid, utxo)].emplace_back(std::move(utxo));
             }
         }
+        nlohmann::json asset_utxos;
+        for (auto& [asset_id, asset_id_utxos] : grouped) {
+            asset_utxos.emplace(asset_id_to_json(asset_id), std::move(asset_id_utxos));
+        }
+        if (!errors.empty()) {
+            asset_utxos.emplace("error", std::move(errors));
+        }
         utxos.swap(asset_utxos);
     }
 
@@ -2544,27 +2790,43 @@ namespace green {
     Tx ga_session::get_raw_transaction_details(const std::string& txhash_hex) const
     {
         try {
+            // First, try the shared network cache
+            auto& net_cache = get_network_cache();
+            const auto txid = h2b_rev<WALLY_TXHASH_LEN>(txhash_hex);
+            if (const auto shared_tx = net_cache.get_raw_tx(txid); shared_tx) {
+                metrics::count("raw_tx.network_cache_hits");
+                return Tx(*shared_tx, m_net_params.is_liquid());
+            }
+
             std::vector<unsigned char> tx_bin;
             locker_t locker(m_mutex);
-            // First, try the local cache
+            // Next, try the local cache
             m_cache->get_transaction_data(txhash_hex, { [&tx_bin](const auto& db_blob) {
                 if (db_blob.has_value()) {
                     tx_bin.assign(db_blob.value().begin(), db_blob.value().end());
                 }
             } });
-            if (!tx_bin.empty()) {
+            const bool is_cached = !tx_bin.empty();
+            if (is_cached) {
                 GDK_LOG(debug) << "Tx cache using cached " << txhash_hex;
+                metrics::count("raw_tx.cache_hits");
             } else {
                 // Not found, ask the server
+                metrics::count("raw_tx.cache_misses");
                 auto server_tx_hex = wamp_cast(m_wamp->call(locker, "txs.get_raw_output", txhash_hex));
                 if (server_tx_hex.empty()) {
                     throw user_error("Transaction not found");
                 }
                 tx_bin = h2b(server_tx_hex);
+            }
+            Tx tx(tx_bin, m_net_params.is_liquid());
+            // Throws if the tx returned doesn't have the txid we asked for
+            net_cache.set_raw_tx(txid, tx);
+            if (!is_cached) {
                 // Cache the result
                 m_cache->insert_transaction_data(txhash_hex, tx_bin);
             }
-            return Tx(tx_bin, m_net_params.is_liquid());
+            return tx;
         } catch (const std::exception& e) {
             GDK_LOG(warning) << "Error fetching " << txhash_hex << " : " << e.what();
             throw user_error("Transaction not found");
@@ -2665,6 +2927,9 @@ namespace green {
 
         GDK_RUNTIME_ASSERT_MSG(addr_type == p2sh || addr_type == p2wsh || addr_type == csv, "Unknown address type");
 
+        if (m_net_params.get_address_pool_size()) {
+            return get_pooled_receive_address(subaccount, addr_type);
+        }
         constexpr bool return_pointer = true;
         auto address = wamp_cast_json(m_wamp->call("vault.fund", subaccount, return_pointer, addr_type));
         update_address_info(address, false);
@@ -2672,6 +2937,73 @@ namespace green {
         return address;
     }
 
+    nlohmann::json ga_session::get_pooled_receive_address(uint32_t subaccount, const std::string& addr_type)
+    {
+        const auto pool_key = std::make_pair(subaccount, addr_type);
+        const size_t pool_size = m_net_params.get_address_pool_size();
+        constexpr bool return_pointer = true;
+        constexpr size_t max_attempts = 2; // Retry once if invalidated during a refill
+
+        std::vector<nlohmann::json> addresses;
+        locker_t locker(m_mutex, std::defer_lock);
+        for (size_t attempt = 0;; ++attempt) {
+            locker.lock();
+            if (auto& pool = m_address_pool[pool_key]; !pool.empty()) {
+                auto address = std::move(pool.front());
+                pool.pop_front();
+                return address;
+            }
+            const uint32_t pool_generation = m_address_pool_generation;
+            locker.unlock();
+
+            // The pool is empty: fetch a block of new addresses from the server
+            // in one round trip, then verify them locally in parallel
+            const auto results = m_wamp->call_many(pool_size, "vault.fund", subaccount, return_pointer, addr_type);
+            addresses.assign(results.size(), nlohmann::json());
+            parallel_for_each_index(results.size(), [this, &results, &addresses, &addr_type](size_t i) {
+                auto& address = addresses[i];
+                address = wamp_cast_json(results[i]);
+                update_address_info(address, false);
+                GDK_RUNTIME_ASSERT(j_strref(address, "address_type") == addr_type);
+            });
+            std::sort(addresses.begin(), addresses.end(), [](const auto& lhs, const auto& rhs) {
+                return j_uint32ref(lhs, "pointer") < j_uint32ref(rhs, "pointer");
+            });
+
+            locker.lock();
+            if (pool_generation == m_address_pool_generation) {
+                break;
+            }
+            // The pool was invalidated (e.g. the csv time changed or the
+            // session was reset) while we were fetching: the addresses may
+            // be stale, so fetch again
+            locker.unlock();
+            GDK_RUNTIME_ASSERT_MSG(attempt + 1 < max_attempts, "Address pool invalidated during refill");
+            GDK_LOG(info) << "Address pool invalidated during refill, retrying";
+        }
+        GDK_RUNTIME_ASSERT(!addresses.empty());
+        // Cache the scriptpubkeys for the block if it follows on from the
+        // cached addresses, so that it leaves no gaps for a later sync to fill
+        uint32_t next_pointer = m_cache->get_latest_scriptpubkey_pointer(subaccount) + 1;
+        bool is_contiguous = true;
+        for (const auto& address : addresses) {
+            is_contiguous &= j_uint32ref(address, "pointer") == next_pointer++;
+        }
+        if (is_contiguous) {
+            for (const auto& address : addresses) {
+                const uint32_t branch = j_uint32(address, "branch").value_or(1);
+                m_cache->insert_scriptpubkey_data(j_bytesref(address, "scriptpubkey"), subaccount, branch,
+                    j_uint32ref(address, "pointer"), j_uint32_or_zero(address, "subtype"), addr_type);
+            }
+            m_cache->save_db();
+        }
+        // Return the first address, and pool the remainder
+        auto& pool = m_address_pool[pool_key];
+        pool.insert(pool.end(), std::make_move_iterator(addresses.begin() + 1),
+            std::make_move_iterator(addresses.end()));
+        return std::move(addresses.front());
+    }
+
     // Idempotent
     nlohmann::json ga_session::get_available_currencies() const
     {
@@ -3120,6 +3452,13 @@ namespace green {
         auto result = m_wamp->call(locker, "login.set_csvtime", csv_blocks, mp_cast(twofactor_data).get());
         GDK_RUNTIME_ASSERT(wamp_cast<bool>(result));
         m_csv_blocks = csv_blocks;
+        // Pooled csv addresses were created with the old csv time
+        ++m_address_pool_generation;
+        for (auto& pool : m_address_pool) {
+            if (pool.first.second == address_type::csv) {
+                pool.second.clear();
+            }
+        }
     }
 
     void ga_session::set_nlocktime(const nlohmann::json& locktime_details, const nlohmann::json& twofactor_data)
@@ -3144,23 +3483,30 @@ namespace green {
             if (!m_spv_thread_done) {
                 // Thread is still running
                 if (do_start) {
-                    // Let the existing thread continue running
+                    // Wake the existing thread to sync to the current block
+                    m_spv_sync_requested = true;
+                    m_spv_cv.notify_one();
                     return;
                 }
-                // Ask and wait for the thread to die
+                // Ask the thread to stop
                 m_spv_thread_stop = true;
-                while (!m_spv_thread_done) {
-                    unique_unlock unlocker(locker);
-                    std::this_thread::sleep_for(100ms);
-                }
+                m_spv_cv.notify_one();
+            }
+            // Wait for the thread to finish, then delete it
+            auto thread = std::move(m_spv_thread);
+            {
+                unique_unlock unlocker(locker);
+                thread->join();
+            }
+            if (m_spv_thread) {
+                // Another caller started a new thread while we were unlocked
+                return download_headers_ctl(locker, do_start);
             }
-            // Thread is finished, join and delete it
-            m_spv_thread->join();
-            m_spv_thread.reset();
         }
 
         m_spv_thread_done = false;
         m_spv_thread_stop = false;
+        m_spv_sync_requested = do_start;
 
         if (do_start) {
             // Start up a new sync thread
@@ -3174,40 +3520,43 @@ namespace green {
         nlohmann::json spv_params;
         uint32_t last_fetched_height = 0;
 
-        // Loop downloading block headers until we are caught up, then exit
-        GDK_LOG(info) << "spv_download_headers: starting sync";
-        for (;;) {
+        // Sync block headers whenever a sync is requested (on new blocks, or
+        // when a tx needs headers we don't have yet), sleeping in between.
+        GDK_LOG(info) << "spv_download_headers: starting";
+        locker_t locker(m_mutex);
+        while (!m_spv_thread_stop) {
+            if (!m_spv_sync_requested) {
+                m_spv_cv.wait(locker);
+                continue;
+            }
+            m_spv_sync_requested = false;
+            const uint32_t block_height = m_last_block_notification["block_height"];
+            if (spv_params.empty()) {
+                constexpr uint32_t timeout_secs = 10;
+                spv_params = get_net_call_params(locker, timeout_secs);
+            }
+
+            unique_unlock unlocker(locker);
             try {
-                uint32_t block_height;
-                {
-                    locker_t locker(m_mutex);
-                    if (m_spv_thread_stop) {
-                        GDK_LOG(info) << "spv_download_headers: exit requested";
-                        break; // We have been asked to terminate; do so
+                // Fetch batches of headers back-to-back until we reach the
+                // current block, or the server has no more headers to give us
+                while (!m_spv_thread_stop) {
+                    const auto ret = rust_call("spv_download_headers", spv_params);
+                    const uint32_t fetched_height = ret.at("height");
+                    GDK_LOG(debug) << "spv_download_headers:" << fetched_height << '/' << block_height;
+                    if (fetched_height >= block_height || fetched_height == last_fetched_height) {
+                        break; // Caught up: wait for the next request
                     }
-                    block_height = m_last_block_notification["block_height"];
-                    if (spv_params.empty()) {
-                        constexpr uint32_t timeout_secs = 10;
-                        spv_params = get_net_call_params(locker, timeout_secs);
-                    }
-                }
-                const auto ret = rust_call("spv_download_headers", spv_params);
-                const auto fetched_height = ret.at("height");
-                GDK_LOG(debug) << "spv_download_headers:" << fetched_height << '/' << block_height;
-                if (fetched_height == block_height) {
-                    break; // Caught up, exit
+                    last_fetched_height = fetched_height;
                 }
-                // Use a short delay for initial header loading, longer
-                // if we are waiting for the current block.
-                const auto delay_ms = fetched_height == last_fetched_height ? 1000ms : 50ms;
-                last_fetched_height = fetched_height;
-                std::this_thread::sleep_for(delay_ms);
             } catch (const std::exception& e) {
                 GDK_LOG(warning) << "spv_download_headers exception:" << e.what();
-                break; // Exception, exit
+                break; // Exception, exit. The next request will restart us
             }
         }
-        locker_t locker(m_mutex);
+        if (m_spv_thread_stop) {
+            GDK_LOG(info) << "spv_download_headers: exit requested";
+        }
         m_spv_thread_done = true;
     }
 
@@ -4,6 +4,9 @@
 
 #include <array>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <map>
 #include <optional>
 #include <string>
@@ -111,11 +114,13 @@ namespace green {
         void ack_system_message(const std::string& message_hash_hex, const std::string& sig_der_hex);
 
         nlohmann::json convert_amount(const nlohmann::json& amount_json) const;
+        nlohmann::json convert_amounts(const nlohmann::json& amounts_json) const;
 
         bool encache_blinding_data(const std::string& pubkey_hex, const std::string& script_hex,
             const std::string& nonce_hex, const std::string& blinding_pubkey_hex);
         void encache_new_scriptpubkeys(uint32_t subaccount);
         nlohmann::json get_scriptpubkey_data(byte_span_t scriptpubkey);
+        nlohmann::json get_scriptpubkeys_data(gsl::span<const byte_span_t> scriptpubkeys);
 
         amount get_min_fee_rate() const;
         amount get_default_fee_rate() const;
@@ -132,6 +137,7 @@ namespace green {
         void store_transactions(uint32_t subaccount, nlohmann::json& txs);
         void postprocess_transactions(nlohmann::json& tx_list);
         nlohmann::json get_transactions(const nlohmann::json& details);
+        nlohmann::json query_transactions(const nlohmann::json& details);
 
     private:
         void reset_cached_session_data(locker_t& locker);
@@ -143,7 +149,9 @@ namespace green {
         nlohmann::json load_client_blob_impl(locker_t& locker);
         nlohmann::json save_client_blob_impl(
             locker_t& locker, const std::string& old_hmac, const std::string& blob_b64, const std::string& hmac);
-        void get_cached_local_client_blob(locker_t& locker, const std::string& server_hmac);
+        void get_cached_local_client_blob(
+            locker_t& locker, const std::string& server_hmac, bool allow_stale = false);
+        void reconcile_optimistic_login();
         void encache_local_client_blob(
             locker_t& locker, std::string data_b64, byte_span_t data, const std::string& hmac);
 
@@ -199,6 +207,7 @@ namespace green {
         nlohmann::json refresh_http_data(const std::string& page, const std::string& key, bool refresh);
 
         void update_address_info(nlohmann::json& address, bool is_historic);
+        nlohmann::json get_pooled_receive_address(uint32_t subaccount, const std::string& addr_type);
         std::shared_ptr<nlocktime_t> update_nlocktime_info(session_impl::locker_t& locker);
 
         void save_cache();
@@ -219,7 +228,7 @@ namespace green {
         nlohmann::json m_twofactor_config;
         amount::value_type m_min_fee_rate;
         std::string m_fiat_source;
-        std::string m_fiat_rate;
+        fiat_rate m_fiat_rate;
         std::string m_fiat_currency;
         uint64_t m_earliest_block_time;
         uint64_t m_nlocktime;
@@ -228,6 +237,10 @@ namespace green {
         nlohmann::json m_assets;
 
         std::map<uint32_t, nlohmann::json> m_subaccounts; // Includes 0 for main
+        // Pre-fetched, verified receive addresses by subaccount and address type
+        std::map<std::pair<uint32_t, std::string>, std::deque<nlohmann::json>> m_address_pool;
+        // Bumped whenever pooled addresses are invalidated, to discard in-flight refills
+        uint32_t m_address_pool_generation;
         uint32_t m_next_subaccount;
         std::vector<uint32_t> m_fee_estimates;
         std::chrono::system_clock::time_point m_fee_estimates_ts;
@@ -246,13 +259,15 @@ namespace green {
         std::set<uint32_t> m_synced_subaccounts;
         const std::string m_user_agent;
         std::shared_ptr<wamp_transport> m_wamp;
+        // Background refresh of cached login data after an optimistic login
+        std::future<void> m_login_reconcile;
 
         // SPV header downloading
         std::shared_ptr<std::thread> m_spv_thread; // Header download thread
         std::atomic_bool m_spv_thread_done; // True when m_spv_thread has exited
         std::atomic_bool m_spv_thread_stop; // True when we want m_spv_thread to stop
-        // Txs that are SPV verified but not yet confirmed beyond the reorg limit
-        std::set<std::string> m_spv_verified_txs;
+        bool m_spv_sync_requested; // True when m_spv_thread should sync to the current block
+        std::condition_variable m_spv_cv; // Wakes m_spv_thread to sync or stop
     };
 
 } // namespace green
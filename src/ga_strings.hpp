@@ -1,1416 +1,2172 @@
-
 // THIS IS A GENERATED FILE, DO NOT EDIT
 #ifndef GA_SDK_GA_STRINGS_HPP
 #define GA_SDK_GA_STRINGS_HPP
 #pragma once
 
-#include <string>
+#include <string_view>
 
 namespace green {
 
     namespace res {
 
-        extern const std::string id_1030_minutes;
-        extern const std::string id_12_confirmations;
-        extern const std::string id_12_months_51840_blocks;
-        extern const std::string id_12_words;
-        extern const std::string id_15_months_65535_blocks;
-        extern const std::string id_1_double_check_all_of_your;
-        extern const std::string id_1d_2s_ago;
-        extern const std::string id_1d_minutes;
-        extern const std::string id_1s_blocks_left_2d;
-        extern const std::string id_1s_twofactor_setup;
-        extern const std::string id_24_words;
-        extern const std::string id_2_hours;
-        extern const std::string id_2fa_dispute_in_progress;
-        extern const std::string id_2fa_expired;
-        extern const std::string id_2fa_expiry;
-        extern const std::string id_2fa_isnt_set_up_yetnnyou_can;
-        extern const std::string id_2fa_methods;
-        extern const std::string id_2fa_protected;
-        extern const std::string id_2fa_reset_in_progress;
-        extern const std::string id_2fa_shield;
-        extern const std::string id_2fa_shield_account;
-        extern const std::string id_2fa_threshold;
-        extern const std::string id_2of2;
-        extern const std::string id_2of3;
-        extern const std::string id_2of3_account;
-        extern const std::string id_2of3_with_2fa;
-        extern const std::string id_2of3_with_2fa_shield;
-        extern const std::string id_4_hours;
-        extern const std::string id_5_seconds_minimum;
-        extern const std::string id_6_months_25920_blocks;
-        extern const std::string id_a_2of3_account_requires_two_out;
-        extern const std::string id_a_funding_fee_of_s_minimum_s_is;
-        extern const std::string id_a_new_transaction_has_just;
-        extern const std::string id_a_newer_version_of_blockstream;
-        extern const std::string id_a_powerful_hardware_wallet_for;
-        extern const std::string id_a_screen_lock_must_be_enabled;
-        extern const std::string id_a_set_up_funding_fee_of_s_s;
-        extern const std::string id_a_wallet_is_detected_on_this;
-        extern const std::string id_about;
-        extern const std::string id_accept;
-        extern const std::string id_access;
-        extern const std::string id_account;
-        extern const std::string id_account__asset;
-        extern const std::string id_account_address;
-        extern const std::string id_account_archived;
-        extern const std::string id_account_balance;
-        extern const std::string id_account_extended_public_keys;
-        extern const std::string id_account_for_special_assets;
-        extern const std::string id_account_has_been_archived;
-        extern const std::string id_account_has_been_removed;
-        extern const std::string id_account_id;
-        extern const std::string id_account_name;
-        extern const std::string id_account_type;
-        extern const std::string id_accounts;
-        extern const std::string id_accounts_summary;
-        extern const std::string id_action_canceled;
-        extern const std::string id_actions;
-        extern const std::string id_add_2fa_account;
-        extern const std::string id_add_a_note_only_you_can_see_it;
-        extern const std::string id_add_a_pgp_public_key_to_receive;
-        extern const std::string id_add_amount;
-        extern const std::string id_add_amount_optional;
-        extern const std::string id_add_an_amp_wallet;
-        extern const std::string id_add_another_wallet;
-        extern const std::string id_add_custom_network_by_qr_code;
-        extern const std::string id_add_custom_network_by_url;
-        extern const std::string id_add_new_account;
-        extern const std::string id_add_note;
-        extern const std::string id_add_recipient;
-        extern const std::string id_add_wallet;
-        extern const std::string id_adding_a_2fa;
-        extern const std::string id_additional_networks;
-        extern const std::string id_additional_security;
-        extern const std::string id_address;
-        extern const std::string id_address_1s;
-        extern const std::string id_address_copied_to_clipboard;
-        extern const std::string id_address_to_receive;
-        extern const std::string id_address_type;
-        extern const std::string id_address_verified;
-        extern const std::string id_address_was_filled_by_a_payment;
-        extern const std::string id_addresses;
-        extern const std::string id_advanced;
-        extern const std::string id_advanced_network_settings;
-        extern const std::string id_advanced_options;
-        extern const std::string id_advanced_options_for_your_third;
-        extern const std::string id_all;
-        extern const std::string id_all_assets;
-        extern const std::string id_all_coins;
-        extern const std::string id_all_networks;
-        extern const std::string id_all_of_the_accounts_in_your;
-        extern const std::string id_all_the_coins_received_or;
-        extern const std::string id_all_wallets;
-        extern const std::string id_allow_collection;
-        extern const std::string id_allow_data_collection;
-        extern const std::string id_allows_you_to_quickly_check;
-        extern const std::string id_always;
-        extern const std::string id_always_ask;
-        extern const std::string id_amount;
-        extern const std::string id_amount_above_maximum_allowed;
-        extern const std::string id_amount_below_minimum_allowed;
-        extern const std::string id_amount_below_the_dust_threshold;
-        extern const std::string id_amount_in_s;
-        extern const std::string id_amount_must_be_at_least_s;
-        extern const std::string id_amount_must_be_at_most_s;
-        extern const std::string id_amount_to_receive;
-        extern const std::string id_amp;
-        extern const std::string id_amp_account;
-        extern const std::string id_amp_accounts_are_only_available;
-        extern const std::string id_amp_id;
-        extern const std::string id_amp_wallet;
-        extern const std::string id_an_unidentified_error_occurred;
-        extern const std::string id_another_2fa_method_is_already;
-        extern const std::string id_any_wallet_found_will_be;
-        extern const std::string id_app_settings;
-        extern const std::string id_archive;
-        extern const std::string id_archive_account;
-        extern const std::string id_archived;
-        extern const std::string id_archived_account;
-        extern const std::string id_archived_accounts;
-        extern const std::string id_are_you_sure_you_want_to_delete;
-        extern const std::string id_are_you_sure_you_want_to_remove;
-        extern const std::string id_are_you_sure_you_want_to_view;
-        extern const std::string id_as_easy_as_snapping_a_photo;
-        extern const std::string id_asset;
-        extern const std::string id_asset_details;
-        extern const std::string id_asset_icons_are_missing_try;
-        extern const std::string id_asset_id;
-        extern const std::string id_asset_name;
-        extern const std::string id_assets;
-        extern const std::string id_assets_cannot_be_used_on_bitcoin;
-        extern const std::string id_at_least_8_characters_required;
-        extern const std::string id_attempts_remaining_d;
-        extern const std::string id_authenticate;
-        extern const std::string id_authenticate_address;
-        extern const std::string id_authenticate_to_view_the;
-        extern const std::string id_authentication_error_s;
-        extern const std::string id_authentication_failed;
-        extern const std::string id_authentication_successful;
-        extern const std::string id_authenticator_app;
-        extern const std::string id_authenticator_qr_code;
-        extern const std::string id_authenticator_secret_key;
-        extern const std::string id_auto_logout_timeout;
-        extern const std::string id_auto_logout_timeout_expired;
-        extern const std::string id_autolock_after;
-        extern const std::string id_available;
-        extern const std::string id_available_funds_s;
-        extern const std::string id_back;
-        extern const std::string id_back_up_recovery_phrase;
-        extern const std::string id_backup_recovery_phrase;
-        extern const std::string id_backup_the_recovery_mnemonic;
-        extern const std::string id_backup_your_mnemonic_before;
-        extern const std::string id_be_aware_other_apps_can_read_or;
-        extern const std::string id_be_sure_your_recovery_phrase_is;
-        extern const std::string id_before_you_backup;
-        extern const std::string id_biometric_login_is_disabled;
-        extern const std::string id_biometric_login_is_enabled;
-        extern const std::string id_biometrics_authentication;
-        extern const std::string id_bip39_passphrase;
-        extern const std::string id_bip39_passphrase_login;
-        extern const std::string id_bip49_accounts_allow_you_to;
-        extern const std::string id_bip84_accounts_allow_you_to;
-        extern const std::string id_bitcoin_and_liquid;
-        extern const std::string id_bitcoin_denomination;
-        extern const std::string id_bitcoin_electrum_server;
-        extern const std::string id_bitcoin_is_the_worlds_leading;
-        extern const std::string id_bitcoin_testnet_and_liquid;
-        extern const std::string id_bitcoin_wallet;
-        extern const std::string id_bitcoin_wallets;
-        extern const std::string id_block;
-        extern const std::string id_block_d;
-        extern const std::string id_block_height;
-        extern const std::string id_block_height_1d;
-        extern const std::string id_blocks;
-        extern const std::string id_blocks_confirmed;
-        extern const std::string id_blockstream_devices;
-        extern const std::string id_blockstream_does_not_have;
-        extern const std::string id_blockstream_green_needs_access;
-        extern const std::string id_blockstream_green_supports_both;
-        extern const std::string id_blockstream_greennsimple_and;
-        extern const std::string id_blockstream_store;
-        extern const std::string id_bluetooth;
-        extern const std::string id_btchip_is_not_set_up_please_set;
-        extern const std::string id_by_proceeding_to_the_next_steps;
-        extern const std::string id_cable;
-        extern const std::string id_call;
-        extern const std::string id_camera_problem;
-        extern const std::string id_cancel;
-        extern const std::string id_cancel_2fa_reset;
-        extern const std::string id_cancel_a_reset_to_unlock_your;
-        extern const std::string id_cancel_twofactor_reset;
-        extern const std::string id_cannot_remove_enabled_network;
-        extern const std::string id_cant_connect_to_this_url;
-        extern const std::string id_change;
-        extern const std::string id_change_address;
-        extern const std::string id_change_pin;
-        extern const std::string id_change_speed;
-        extern const std::string id_changing_reference_exchange;
-        extern const std::string id_channel_closure_initiated_you;
-        extern const std::string id_cheaper_and_more_private;
-        extern const std::string id_cheaper_singlesig_option;
-        extern const std::string id_check_device;
-        extern const std::string id_check_for_updates;
-        extern const std::string id_check_for_updates_on_startup;
-        extern const std::string id_check_our_6_easy_steps_to_be;
-        extern const std::string id_check_your_backup;
-        extern const std::string id_check_your_device;
-        extern const std::string id_choose;
-        extern const std::string id_choose_a_name_for_your_new;
-        extern const std::string id_choose_a_name_for_your_wallet;
-        extern const std::string id_choose_a_swap_option;
-        extern const std::string id_choose_a_usb_or_bluetooth;
-        extern const std::string id_choose_bluetooth_connection_on;
-        extern const std::string id_choose_method_to_authorize_the;
-        extern const std::string id_choose_recovery_phrase_length;
-        extern const std::string id_choose_security_policy;
-        extern const std::string id_choose_the_electrum_servers_you;
-        extern const std::string id_choose_the_security_policy_that;
-        extern const std::string id_choose_the_security_policy_you;
-        extern const std::string id_choose_this_version_to_connect;
-        extern const std::string id_choose_this_version_to_disable;
-        extern const std::string id_choose_twofactor_authentication;
-        extern const std::string id_choose_watchonly;
-        extern const std::string id_choose_your_network;
-        extern const std::string id_clear;
-        extern const std::string id_clear_cache;
-        extern const std::string id_click_to_copy;
-        extern const std::string id_click_to_receive_an_email_with;
-        extern const std::string id_close;
-        extern const std::string id_close_channel;
-        extern const std::string id_code;
-        extern const std::string id_coin;
-        extern const std::string id_coins;
-        extern const std::string id_coins_for_which_2fa_protection;
-        extern const std::string id_coins_locked;
-        extern const std::string id_coins_protected_by_the_legacy;
-        extern const std::string id_coins_protected_by_the_new;
-        extern const std::string id_coins_received_or_created;
-        extern const std::string id_coins_unlocked;
-        extern const std::string id_coins_whose_asset_and_amount;
-        extern const std::string id_coins_with_a_value_lower_than;
-        extern const std::string id_collapse_sidebar;
-        extern const std::string id_coming_soon;
-        extern const std::string id_communication_timed_out_make;
-        extern const std::string id_completed;
-        extern const std::string id_confidential;
-        extern const std::string id_confidential_transaction;
-        extern const std::string id_confirm;
-        extern const std::string id_confirm_action;
-        extern const std::string id_confirm_by_typing_the_wallet;
-        extern const std::string id_confirm_code;
-        extern const std::string id_confirm_coin_selection;
-        extern const std::string id_confirm_on_your_device;
-        extern const std::string id_confirm_passphrase;
-        extern const std::string id_confirm_refund;
-        extern const std::string id_confirm_swap;
-        extern const std::string id_confirm_transaction;
-        extern const std::string id_confirm_transaction_details_on;
-        extern const std::string id_confirm_update_on_your_jade;
-        extern const std::string id_confirm_version_on_jade;
-        extern const std::string id_confirm_via_2fa_that_you;
-        extern const std::string id_confirm_your_new_pin;
-        extern const std::string id_confirmation_in_d_blocks;
-        extern const std::string id_confirmation_time;
-        extern const std::string id_confirmations;
-        extern const std::string id_confirming_your_transaction;
-        extern const std::string id_congratulations;
-        extern const std::string id_connect_a_different_hardware;
-        extern const std::string id_connect_hardware_wallet;
-        extern const std::string id_connect_jade;
-        extern const std::string id_connect_jade_with_a_usb_cable;
-        extern const std::string id_connect_through_a_proxy;
-        extern const std::string id_connect_usb_cable_or_enable;
-        extern const std::string id_connect_using_usb_or_bluetooth;
-        extern const std::string id_connect_with_bluetooth;
-        extern const std::string id_connect_with_tor;
-        extern const std::string id_connect_your_jade_to_use_it;
-        extern const std::string id_connect_your_ledger_to_use_it;
-        extern const std::string id_connected_to_jade;
-        extern const std::string id_connected_wallets;
-        extern const std::string id_connecting;
-        extern const std::string id_connecting_through_tor;
-        extern const std::string id_connecting_to_a_trusted_node;
-        extern const std::string id_connecting_to_peers;
-        extern const std::string id_connecting_to_tor_onion_nodes;
-        extern const std::string id_connecting_to_your_device;
-        extern const std::string id_connection;
-        extern const std::string id_connection_failed;
-        extern const std::string id_connection_to_device_failed;
-        extern const std::string id_contact_support_at_s_or_visit_s;
-        extern const std::string id_continue;
-        extern const std::string id_continue_with_1s;
-        extern const std::string id_copied_to_clipboard;
-        extern const std::string id_copy;
-        extern const std::string id_copy_address;
-        extern const std::string id_copy_details;
-        extern const std::string id_copy_device_id;
-        extern const std::string id_copy_id;
-        extern const std::string id_copy_raw_transaction;
-        extern const std::string id_copy_support_id;
-        extern const std::string id_copy_swap_proposal;
-        extern const std::string id_copy_to_clipboard;
-        extern const std::string id_copy_transaction_id;
-        extern const std::string id_copy_unblinded_link;
-        extern const std::string id_copy_unblinding_data;
-        extern const std::string id_copy_uri;
-        extern const std::string id_copy_xpub;
-        extern const std::string id_correct_order;
-        extern const std::string id_could_not_recognized_qr_code;
-        extern const std::string id_country;
-        extern const std::string id_create;
-        extern const std::string id_create_a_new_proposal;
-        extern const std::string id_create_a_new_swap;
-        extern const std::string id_create_a_pin;
-        extern const std::string id_create_a_pin_to_access_your;
-        extern const std::string id_create_a_wallet_for_bitcoin;
-        extern const std::string id_create_account;
-        extern const std::string id_create_invoice;
-        extern const std::string id_create_new_account;
-        extern const std::string id_create_new_wallet;
-        extern const std::string id_create_temporary_wallet;
-        extern const std::string id_create_wallet;
-        extern const std::string id_create_your_first_account_to;
-        extern const std::string id_creating_wallet;
-        extern const std::string id_creating_your_s_account;
-        extern const std::string id_csv;
-        extern const std::string id_currency;
-        extern const std::string id_current_version;
-        extern const std::string id_custom;
-        extern const std::string id_custom_network_added_enable_it;
-        extern const std::string id_custom_network_not_found;
-        extern const std::string id_custom_network_with_this_name;
-        extern const std::string id_custom_servers_and_validation;
-        extern const std::string id_customize_2fa_expiration_of;
-        extern const std::string id_d6_confirmations;
-        extern const std::string id_d_asset_in_this_account;
-        extern const std::string id_d_assets;
-        extern const std::string id_d_assets_in_this_account;
-        extern const std::string id_d_assets_in_total;
-        extern const std::string id_d_coins_selected;
-        extern const std::string id_d_words;
-        extern const std::string id_data_directory;
-        extern const std::string id_date;
-        extern const std::string id_day;
-        extern const std::string id_days;
-        extern const std::string id_days_remaining_s;
-        extern const std::string id_default_custom_fee_rate;
-        extern const std::string id_default_transaction_priority;
-        extern const std::string id_delete;
-        extern const std::string id_delete_credentials;
-        extern const std::string id_delete_permanently_your_wallet;
-        extern const std::string id_delete_s_twofactor;
-        extern const std::string id_delete_wallet;
-        extern const std::string id_deleting_your_pin_will_remove;
-        extern const std::string id_denomination;
-        extern const std::string id_denomination__exchange_rate;
-        extern const std::string id_deposit;
-        extern const std::string id_description;
-        extern const std::string id_descriptor;
-        extern const std::string id_details;
-        extern const std::string id_device;
-        extern const std::string id_devices;
-        extern const std::string id_different_passphrases_generate;
-        extern const std::string id_digital_wallets;
-        extern const std::string id_disable;
-        extern const std::string id_disable_authenticator;
-        extern const std::string id_disable_pin_access;
-        extern const std::string id_disable_pin_access_for_this;
-        extern const std::string id_disable_s_twofactor;
-        extern const std::string id_disabled;
-        extern const std::string id_disconnect;
-        extern const std::string id_display_values_in_s_and;
-        extern const std::string id_displays_the_progress_of_spv;
-        extern const std::string id_dispute_twofactor_reset;
-        extern const std::string id_disputed;
-        extern const std::string id_distributed_under_the_s_see;
-        extern const std::string id_do_you_have_the_backup;
-        extern const std::string id_domain;
-        extern const std::string id_done;
-        extern const std::string id_dont_ask_me_again;
-        extern const std::string id_dont_collect_data;
-        extern const std::string id_dont_have_a_jade_check_our_store;
-        extern const std::string id_dont_show_this_again;
-        extern const std::string id_dont_store_your_recovery_phrase;
-        extern const std::string id_dont_take_screenshots_of_your;
-        extern const std::string id_double_check_spv_with_other;
-        extern const std::string id_double_spend;
-        extern const std::string id_double_spend_by;
-        extern const std::string id_download_finished;
-        extern const std::string id_dust;
-        extern const std::string id_edit;
-        extern const std::string id_edit_fee;
-        extern const std::string id_email;
-        extern const std::string id_email_address;
-        extern const std::string id_emergency_recovery_phrase;
-        extern const std::string id_empty;
-        extern const std::string id_enable;
-        extern const std::string id_enable_2fa;
-        extern const std::string id_enable_bluetooth;
-        extern const std::string id_enable_bluetooth_from_system;
-        extern const std::string id_enable_custom_networks_debug;
-        extern const std::string id_enable_email_notifications_to;
-        extern const std::string id_enable_experimental_features;
-        extern const std::string id_enable_face_id;
-        extern const std::string id_enable_limited_usage_data;
-        extern const std::string id_enable_location_services;
-        extern const std::string id_enable_or_change_your_pin_to;
-        extern const std::string id_enable_spv;
-        extern const std::string id_enable_spv_and_modify_spv;
-        extern const std::string id_enable_testnet;
-        extern const std::string id_enable_testnet_in_app_settings;
-        extern const std::string id_enable_touch_id;
-        extern const std::string id_enable_twofactor_authentication;
-        extern const std::string id_enabled;
-        extern const std::string id_enabled_1s;
-        extern const std::string id_encryption_passphrase;
-        extern const std::string id_enhance_security;
-        extern const std::string id_enhanced_privacy;
-        extern const std::string id_enter;
-        extern const std::string id_enter_a_pgp_public_key_to_have;
-        extern const std::string id_enter_a_private_key_to_sweep;
-        extern const std::string id_enter_a_valid_onion_or_ip;
-        extern const std::string id_enter_a_valid_username;
-        extern const std::string id_enter_amount_in;
-        extern const std::string id_enter_an_address;
-        extern const std::string id_enter_an_address_or_sweep_paper;
-        extern const std::string id_enter_and_confirm_a_unique_pin;
-        extern const std::string id_enter_new_email;
-        extern const std::string id_enter_phone_number;
-        extern const std::string id_enter_pin;
-        extern const std::string id_enter_pin_on_jade;
-        extern const std::string id_enter_the_email_for_which_you;
-        extern const std::string id_enter_the_matching_words;
-        extern const std::string id_enter_the_pin_for_your_hardware;
-        extern const std::string id_enter_your_12_24_or_27_words;
-        extern const std::string id_enter_your_24_or_27_words;
-        extern const std::string id_enter_your_27_words_recovery;
-        extern const std::string id_enter_your_6digit_pin_to_access;
-        extern const std::string id_enter_your_email_address;
-        extern const std::string id_enter_your_pin;
-        extern const std::string id_enter_your_recovery_phrase;
-        extern const std::string id_enter_your_s_wallet_mnemonic;
-        extern const std::string id_enter_your_wallet_mnemonic;
-        extern const std::string id_enter_your_xpub;
-        extern const std::string id_enter_your_xpub_to_add_a;
-        extern const std::string id_enter_yournrecovery_phrase;
-        extern const std::string id_entity;
-        extern const std::string id_ephemeral_wallets;
-        extern const std::string id_error;
-        extern const std::string id_error_logging_in_with_hardware;
-        extern const std::string id_error_nfc_tag_not_writable;
-        extern const std::string id_error_nfc_tag_too_small;
-        extern const std::string id_error_passphrases_do_not_match;
-        extern const std::string id_error_setting_fee_rate;
-        extern const std::string id_establishing_session;
-        extern const std::string id_estimated_blocks_until;
-        extern const std::string id_everything_you_need_to_take;
-        extern const std::string id_example_89014283334011612858333;
-        extern const std::string id_exchange_rate;
-        extern const std::string id_existing_recovery_phrase;
-        extern const std::string id_existing_wallets;
-        extern const std::string id_exit_guide;
-        extern const std::string id_expand_sidebar;
-        extern const std::string id_experimental;
-        extern const std::string id_experimental_feature;
-        extern const std::string id_experimental_features_might;
-        extern const std::string id_expiration;
-        extern const std::string id_explore_your_wallet;
-        extern const std::string id_export;
-        extern const std::string id_export_transactions_to_csv_file;
-        extern const std::string id_exports_an_accounts_extended;
-        extern const std::string id_extended_public_key;
-        extern const std::string id_extended_public_keys;
-        extern const std::string id_face_id;
-        extern const std::string id_failed_to_load_asset_icons;
-        extern const std::string id_failed_to_load_asset_registry;
-        extern const std::string id_fast;
-        extern const std::string id_fast_transactions_on_the;
-        extern const std::string id_faster_more_confidential;
-        extern const std::string id_fastest;
-        extern const std::string id_fee;
-        extern const std::string id_fee_amount_size_fee_rate;
-        extern const std::string id_fee_rate;
-        extern const std::string id_fee_rate_is_above_maximum;
-        extern const std::string id_fee_rate_is_below_minimum;
-        extern const std::string id_fee_rate_must_be_at_least_s;
-        extern const std::string id_fee_rate_s;
-        extern const std::string id_fee_s__s;
-        extern const std::string id_feedback;
-        extern const std::string id_fees_are_collected_by_bitcoin;
-        extern const std::string id_fees_are_too_low;
-        extern const std::string id_fetching_new_firmware;
-        extern const std::string id_filters;
-        extern const std::string id_finishing_up;
-        extern const std::string id_firmware;
-        extern const std::string id_firmware_update;
-        extern const std::string id_firmware_update_completed;
-        extern const std::string id_firmware_upgrade;
-        extern const std::string id_firmware_version_s;
-        extern const std::string id_follow_the_instructions_of_your;
-        extern const std::string id_follow_the_instructions_on_jade;
-        extern const std::string id_follow_the_instructions_on_your;
-        extern const std::string id_for_investors;
-        extern const std::string id_for_long_term_storage;
-        extern const std::string id_for_more_information_read_more;
-        extern const std::string id_for_most_users;
-        extern const std::string id_from;
-        extern const std::string id_funds_received;
-        extern const std::string id_funds_received_in_this;
-        extern const std::string id_general;
-        extern const std::string id_generate;
-        extern const std::string id_generate_a_new_recovery_phrase;
-        extern const std::string id_generate_new_address;
-        extern const std::string id_get_code;
-        extern const std::string id_get_id;
-        extern const std::string id_get_jade;
-        extern const std::string id_give_bluetooth_permissions;
-        extern const std::string id_give_us_your_feedback;
-        extern const std::string id_go_to_account;
-        extern const std::string id_go_to_receive_to_get_your;
-        extern const std::string id_go_to_wallet;
-        extern const std::string id_got_it_written_down_great_you;
-        extern const std::string id_green_is_a_noncustodial_wallet;
-        extern const std::string id_green_logo;
-        extern const std::string id_green_mnemonic_qr_code;
-        extern const std::string id_green_only_supports_one_pin_for;
-        extern const std::string id_green_only_supports_one_pin_per;
-        extern const std::string id_green_uses_biometric;
-        extern const std::string id_green_uses_bluetooth_for;
-        extern const std::string id_green_uses_bluetooth_to_connect;
-        extern const std::string id_green_uses_multisig_with_one;
-        extern const std::string id_hardware_devices;
-        extern const std::string id_hardware_security;
-        extern const std::string id_hardware_wallet;
-        extern const std::string id_hardware_wallet_support_for;
-        extern const std::string id_hardware_wallets;
-        extern const std::string id_hash;
-        extern const std::string id_hash_s;
-        extern const std::string id_help;
-        extern const std::string id_help_green_improve;
-        extern const std::string id_here;
-        extern const std::string id_hex;
-        extern const std::string id_hide_advanced_options;
-        extern const std::string id_hide_amounts;
-        extern const std::string id_hide_assets;
-        extern const std::string id_hide_details;
-        extern const std::string id_high;
-        extern const std::string id_hold_button_to_send;
-        extern const std::string id_hold_the_green_button_on_the;
-        extern const std::string id_hold_your_nfc_tag_close_to_the;
-        extern const std::string id_home;
-        extern const std::string id_hour;
-        extern const std::string id_hours;
-        extern const std::string id_how_to_stop_this_reset;
-        extern const std::string id_i_agree_to_the;
-        extern const std::string id_i_agree_to_the_terms_of_service;
-        extern const std::string id_i_confirm_i_have_read_and;
-        extern const std::string id_i_confirm_i_want_to_delete_this;
-        extern const std::string id_i_confirm_i_want_to_disable_pin;
-        extern const std::string id_i_forgot_my_password;
-        extern const std::string id_i_fund_via_an_onchain_bitcoin;
-        extern const std::string id_i_lost_my_2fa;
-        extern const std::string id_i_secured_the_mnemonic_and_i;
-        extern const std::string id_i_typed_all_my_recovery_phrase;
-        extern const std::string id_i_understand_amounts_could_be;
-        extern const std::string id_id;
-        extern const std::string id_if_for_any_reason_you_cant;
-        extern const std::string id_if_you_agree_green_will_collect;
-        extern const std::string id_if_you_are_the_rightful_owner;
-        extern const std::string id_if_you_did_not_request_the;
-        extern const std::string id_if_you_forget_it_or_lose_it;
-        extern const std::string id_if_you_have_access_to_a;
-        extern const std::string id_if_you_have_some_coins_on_the;
-        extern const std::string id_if_you_initiated_the_2fa_reset;
-        extern const std::string id_import;
-        extern const std::string id_import_a_multisig_shield_wallet;
-        extern const std::string id_import_a_wallet_created_on;
-        extern const std::string id_import_a_wallet_created_with;
-        extern const std::string id_import_from_file;
-        extern const std::string id_in_progress;
-        extern const std::string id_inbound_liquidity;
-        extern const std::string id_incoming;
-        extern const std::string id_inconsistent_data_provided_for;
-        extern const std::string id_increase_fee;
-        extern const std::string id_increase_inbound_capacity_now;
-        extern const std::string id_increase_security;
-        extern const std::string id_increase_the_security_of_your;
-        extern const std::string id_information_not_available;
-        extern const std::string id_initialize_and_create_wallet;
-        extern const std::string id_initialize_jade_for_testnet;
-        extern const std::string id_initialized;
-        extern const std::string id_initializing_tor;
-        extern const std::string id_insert_your_email_to_receive;
-        extern const std::string id_insert_your_phone_number_to;
-        extern const std::string id_install_version_s;
-        extern const std::string id_instant;
-        extern const std::string id_insufficient_funds;
-        extern const std::string id_insufficient_lbtc_for_fees;
-        extern const std::string id_insufficient_lbtc_to_send_a;
-        extern const std::string id_invalid_address;
-        extern const std::string id_invalid_amount;
-        extern const std::string id_invalid_asset_id;
-        extern const std::string id_invalid_clipboard_contents;
-        extern const std::string id_invalid_merkle_proof;
-        extern const std::string id_invalid_mnemonic;
-        extern const std::string id_invalid_mnemonic_continue;
-        extern const std::string id_invalid_mnemonic_must_be_24_or;
-        extern const std::string id_invalid_network_configuration;
-        extern const std::string id_invalid_payment_request_assetid;
-        extern const std::string id_invalid_pgp_key;
-        extern const std::string id_invalid_phone_number_format;
-        extern const std::string id_invalid_pin;
-        extern const std::string id_invalid_pin_remaining_attempts;
-        extern const std::string id_invalid_pin_you_dont_have_any;
-        extern const std::string id_invalid_pin_you_have_1d;
-        extern const std::string id_invalid_private_key;
-        extern const std::string id_invalid_recovery_phrase;
-        extern const std::string id_invalid_replacement_fee_rate;
-        extern const std::string id_invalid_status_check_that_your;
-        extern const std::string id_invalid_swap_proposal;
-        extern const std::string id_invalid_twofactor_code;
-        extern const std::string id_invalid_url;
-        extern const std::string id_invalid_xpub;
-        extern const std::string id_invoice_expired;
-        extern const std::string id_invoices;
-        extern const std::string id_is_a_noncustodial;
-        extern const std::string id_issuer;
-        extern const std::string id_issuer_domain_s;
-        extern const std::string id_it_looks_like_you_have_no;
-        extern const std::string id_jade_is_a_specialized_device;
-        extern const std::string id_jade_is_an_isolated_device_not;
-        extern const std::string id_jade_is_an_opensource_hardware;
-        extern const std::string id_jade_unlocked;
-        extern const std::string id_jade_was_initialized_for_testnet;
-        extern const std::string id_just_a_few_more_steps_to_get;
-        extern const std::string id_label;
-        extern const std::string id_language;
-        extern const std::string id_last_attempt_if_failed_you_will;
-        extern const std::string id_last_ping_1d_ms;
-        extern const std::string id_later;
-        extern const std::string id_latest_transactions;
-        extern const std::string id_lbtc_has_no_issuer_and_is;
-        extern const std::string id_learn_more;
-        extern const std::string id_learn_more_about_amp_the_assets;
-        extern const std::string id_learn_more_about_s;
-        extern const std::string id_ledger_dashboard_detected;
-        extern const std::string id_ledger_devices;
-        extern const std::string id_ledger_supports_a_limited_set;
-        extern const std::string id_legacy;
-        extern const std::string id_legacy_account;
-        extern const std::string id_legacy_bip44;
-        extern const std::string id_legacy_script_coins;
-        extern const std::string id_legacy_segwit;
-        extern const std::string id_legacy_segwit_account;
-        extern const std::string id_legacy_segwit_bip49;
-        extern const std::string id_lets_get_you_set_up;
-        extern const std::string id_lightning;
-        extern const std::string id_lightning_invoice;
-        extern const std::string id_lightning_invoice__lnurl;
-        extern const std::string id_lightning_invoice_is_expired;
-        extern const std::string id_lightning_network_account;
-        extern const std::string id_limits_s__s;
-        extern const std::string id_liquid_electrum_server;
-        extern const std::string id_liquid_is_a_sidechainbased;
-        extern const std::string id_liquid_securities;
-        extern const std::string id_liquid_testnet_electrum_server;
-        extern const std::string id_liquid_testnet_wallets;
-        extern const std::string id_liquid_wallet;
-        extern const std::string id_liquid_wallets;
-        extern const std::string id_loading;
-        extern const std::string id_loading_accounts;
-        extern const std::string id_loading_assets;
-        extern const std::string id_loading_transactions;
-        extern const std::string id_loading_wallet;
-        extern const std::string id_location_services_are_disabled;
-        extern const std::string id_lock;
-        extern const std::string id_lock_after_1_minute;
-        extern const std::string id_lock_immediately;
-        extern const std::string id_locked;
-        extern const std::string id_locked_coins_will_not_be_spent;
-        extern const std::string id_locking_coins;
-        extern const std::string id_locking_coins_can_help_protect;
-        extern const std::string id_log_file;
-        extern const std::string id_log_in;
-        extern const std::string id_log_in_into_your_s_wallet;
-        extern const std::string id_log_in_to_your_multisig_shield;
-        extern const std::string id_log_in_using_mnemonic;
-        extern const std::string id_log_in_via_watchonly_to_receive;
-        extern const std::string id_log_out;
-        extern const std::string id_logged_in_wallets;
-        extern const std::string id_logging_in;
-        extern const std::string id_login;
-        extern const std::string id_login_failed;
-        extern const std::string id_login_options;
-        extern const std::string id_login_with_biometrics;
-        extern const std::string id_login_with_bip39_passphrase;
-        extern const std::string id_logout;
-        extern const std::string id_logout_and_switch;
-        extern const std::string id_look_at_the_device_for_the;
-        extern const std::string id_looking_for_device;
-        extern const std::string id_looking_for_wallets;
-        extern const std::string id_looks_like_you_havent_used_a;
-        extern const std::string id_low;
-        extern const std::string id_main_account;
-        extern const std::string id_make_sure_to_be_in_a_private;
-        extern const std::string id_make_sure_you_are_alone_and_no;
-        extern const std::string id_make_sure_you_got_everything;
-        extern const std::string id_make_sure_you_have_enabled_otg;
-        extern const std::string id_make_sure_you_made_a_proper;
-        extern const std::string id_malleated;
-        extern const std::string id_managed_assets;
-        extern const std::string id_managed_assets_account;
-        extern const std::string id_managed_assets_accounts_are;
-        extern const std::string id_manual_coin_selection;
-        extern const std::string id_manual_restore;
-        extern const std::string id_max_limit_s;
-        extern const std::string id_max_payable_amount;
-        extern const std::string id_max_receivable_amount;
-        extern const std::string id_max_single_payment_amount;
-        extern const std::string id_medium;
-        extern const std::string id_memo;
-        extern const std::string id_message;
-        extern const std::string id_message_hash;
-        extern const std::string id_migrate_another_wallet;
-        extern const std::string id_migrating_to_blockstream_green;
-        extern const std::string id_minimum;
-        extern const std::string id_minute;
-        extern const std::string id_minutes;
-        extern const std::string id_mnemonic;
-        extern const std::string id_mnemonic_not_available;
-        extern const std::string id_model;
-        extern const std::string id_month;
-        extern const std::string id_months;
-        extern const std::string id_more_info;
-        extern const std::string id_more_options;
-        extern const std::string id_move_to_2fa_protected;
-        extern const std::string id_multi_server_validation;
-        extern const std::string id_multiple_assets;
-        extern const std::string id_multisig;
-        extern const std::string id_multisig_shield;
-        extern const std::string id_my_assets;
-        extern const std::string id_my_notes;
-        extern const std::string id_name;
-        extern const std::string id_native_segwit;
-        extern const std::string id_need_help;
-        extern const std::string id_network;
-        extern const std::string id_network_configuration;
-        extern const std::string id_network_fee;
-        extern const std::string id_network_monitor;
-        extern const std::string id_networks;
-        extern const std::string id_new_account_created;
-        extern const std::string id_new_accounts_functionality;
-        extern const std::string id_new_fee;
-        extern const std::string id_new_incoming_transaction_in;
-        extern const std::string id_new_jade_firmware_available;
-        extern const std::string id_new_jade_firmware_required;
-        extern const std::string id_new_outgoing_transaction_from;
-        extern const std::string id_new_recovery_phrase;
-        extern const std::string id_new_s_transaction_of_s_in;
-        extern const std::string id_new_transaction;
-        extern const std::string id_new_transaction_involving;
-        extern const std::string id_new_version;
-        extern const std::string id_new_wallet;
-        extern const std::string id_next;
-        extern const std::string id_nfc_logo;
-        extern const std::string id_nfc_tags_written;
-        extern const std::string id_no_addresses;
-        extern const std::string id_no_amount_specified;
-        extern const std::string id_no_archived_accounts;
-        extern const std::string id_no_asset_in_this_account;
-        extern const std::string id_no_attempts_remaining;
-        extern const std::string id_no_coins_selected;
-        extern const std::string id_no_device_connected;
-        extern const std::string id_no_existing_wallet_could_be;
-        extern const std::string id_no_more_assets;
-        extern const std::string id_no_multisig_shield_wallet;
-        extern const std::string id_no_peers_connected;
-        extern const std::string id_no_personal_data_will_be_shared;
-        extern const std::string id_no_pin_provided_exiting;
-        extern const std::string id_no_recipients;
-        extern const std::string id_no_registered_name_for_this;
-        extern const std::string id_no_registered_ticker_for_this;
-        extern const std::string id_no_utxos_found;
-        extern const std::string id_node_info;
-        extern const std::string id_non_confidential;
-        extern const std::string id_non_confidential_transaction;
-        extern const std::string id_nonconfidential_addresses_not;
-        extern const std::string id_noradio_firmware;
-        extern const std::string id_normal;
-        extern const std::string id_not_a_valid_email_address;
-        extern const std::string id_not_a_valid_phone_number;
-        extern const std::string id_not_a_valid_word;
-        extern const std::string id_not_available_noradio_build;
-        extern const std::string id_not_confidential;
-        extern const std::string id_not_connected_connecting_in_ds_;
-        extern const std::string id_not_initialized;
-        extern const std::string id_not_now;
-        extern const std::string id_not_on_longest_chain;
-        extern const std::string id_note;
-        extern const std::string id_note_down_your_recovery_phrase;
-        extern const std::string id_notifications;
-        extern const std::string id_now;
-        extern const std::string id_of_24;
-        extern const std::string id_of_s;
-        extern const std::string id_offline_key_storage;
-        extern const std::string id_ok;
-        extern const std::string id_on_average;
-        extern const std::string id_once_selected_this_spending;
-        extern const std::string id_onchain_address;
-        extern const std::string id_onchain_swaps;
-        extern const std::string id_one_attempt_remaining;
-        extern const std::string id_one_network_must_be_selected;
-        extern const std::string id_onion_addresses_require_tor;
-        extern const std::string id_only_connect_to_trusted_nodes;
-        extern const std::string id_only_this_time;
-        extern const std::string id_open;
-        extern const std::string id_operation_failure;
-        extern const std::string id_optimal_if_you_rarely_spend;
-        extern const std::string id_optimal_if_you_spend_coins;
-        extern const std::string id_optional;
-        extern const std::string id_optional_memo;
-        extern const std::string id_optional_password;
-        extern const std::string id_or;
-        extern const std::string id_original_swap_address;
-        extern const std::string id_os__app_version_loading_times;
-        extern const std::string id_our_support_page;
-        extern const std::string id_outdated_hardware_wallet;
-        extern const std::string id_outgoing;
-        extern const std::string id_output_descriptors;
-        extern const std::string id_overview;
-        extern const std::string id_p2sh;
-        extern const std::string id_p2wsh;
-        extern const std::string id_page_visits_button_presses;
-        extern const std::string id_passphrase;
-        extern const std::string id_passphrase_protected;
-        extern const std::string id_password;
-        extern const std::string id_password_protected;
-        extern const std::string id_paste;
-        extern const std::string id_paste_an_existing_proposal;
-        extern const std::string id_path_used_for_signing;
-        extern const std::string id_payment_requested_by_s;
-        extern const std::string id_payments_to_self_are_not;
-        extern const std::string id_pending_confirmation;
-        extern const std::string id_permanent_2fa_account_ideal_for;
-        extern const std::string id_permanently_block_this_wallet;
-        extern const std::string id_personal_electrum_server;
-        extern const std::string id_pgp_key;
-        extern const std::string id_phone_call;
-        extern const std::string id_phone_number;
-        extern const std::string id_pin;
-        extern const std::string id_pin_access_disabled;
-        extern const std::string id_pin_has_to_be_between_4_and_15;
-        extern const std::string id_pins_do_not_match_please_try;
-        extern const std::string id_please_activate_at_least_one;
-        extern const std::string id_please_contribute_if_you_find;
-        extern const std::string id_please_disable_biometric;
-        extern const std::string id_please_disconnect_your_ledger;
-        extern const std::string id_please_enable_another;
-        extern const std::string id_please_enable_camera;
-        extern const std::string id_please_enable_pin;
-        extern const std::string id_please_enter_the_passphrase_for;
-        extern const std::string id_please_follow_the_instructions;
-        extern const std::string id_please_hold_on_while_your;
-        extern const std::string id_please_provide_your_1s;
-        extern const std::string id_please_provide_your_1s_code;
-        extern const std::string id_please_provide_your_passphrase;
-        extern const std::string id_please_reconnect_your_hardware;
-        extern const std::string id_please_secure_your_mnemonic_and;
-        extern const std::string id_please_select_the_checkbox;
-        extern const std::string id_please_set_and_enable_socks5;
-        extern const std::string id_please_tap_card;
-        extern const std::string id_please_verify_that_the_address;
-        extern const std::string id_please_verify_that_this_address;
-        extern const std::string id_please_wait_until_your_ledger;
-        extern const std::string id_power_on_jade;
-        extern const std::string id_precision;
-        extern const std::string id_previous_fee;
-        extern const std::string id_price_feed;
-        extern const std::string id_print_backup_template;
-        extern const std::string id_privacy_policy;
-        extern const std::string id_private_but_less_stable;
-        extern const std::string id_private_key;
-        extern const std::string id_problem_with_key_1s;
-        extern const std::string id_protect_your_bitcoin_with_a;
-        extern const std::string id_provide_this_id_to_the_asset;
-        extern const std::string id_provide_your_amp_id_to_the;
-        extern const std::string id_proxy_host;
-        extern const std::string id_proxy_port;
-        extern const std::string id_proxy_settings;
-        extern const std::string id_pseudonymous_identifier_country;
-        extern const std::string id_qr_code;
-        extern const std::string id_qr_scanner;
-        extern const std::string id_quick_setup_2fa_account_ideal;
-        extern const std::string id_radio_firmware;
-        extern const std::string id_rate;
-        extern const std::string id_rate_us;
-        extern const std::string id_rate_your_experience;
-        extern const std::string id_read_more;
-        extern const std::string id_read_more_at_our_s;
-        extern const std::string id_ready;
-        extern const std::string id_ready_to_start;
-        extern const std::string id_receive;
-        extern const std::string id_receive_any_liquid_asset;
-        extern const std::string id_receive_email_notifications_for;
-        extern const std::string id_received;
-        extern const std::string id_received_on;
-        extern const std::string id_receiving;
-        extern const std::string id_recently_used_wallets;
-        extern const std::string id_recipient;
-        extern const std::string id_recipient_address;
-        extern const std::string id_recovery;
-        extern const std::string id_recovery_and_notifications;
-        extern const std::string id_recovery_key_type;
-        extern const std::string id_recovery_mnemonic;
-        extern const std::string id_recovery_phrase;
-        extern const std::string id_recovery_phrase_check;
-        extern const std::string id_recovery_phrase_length;
-        extern const std::string id_recovery_phrases_key_material;
-        extern const std::string id_recovery_tool;
-        extern const std::string id_recovery_transaction_emails;
-        extern const std::string id_recovery_transaction_request;
-        extern const std::string id_recovery_transactions;
-        extern const std::string id_recovery_words;
-        extern const std::string id_recovery_xpub;
-        extern const std::string id_redeem;
-        extern const std::string id_redeem_your_deposited_funds;
-        extern const std::string id_redeposited;
-        extern const std::string id_reference_exchange_rate;
-        extern const std::string id_refresh;
-        extern const std::string id_refund;
-        extern const std::string id_refund_in_progress;
-        extern const std::string id_refund_initiated;
-        extern const std::string id_refundable;
-        extern const std::string id_reload;
-        extern const std::string id_remember_device;
-        extern const std::string id_remember_device_connection;
-        extern const std::string id_remember_me;
-        extern const std::string id_remember_my_device;
-        extern const std::string id_remove;
-        extern const std::string id_remove_custom_network;
-        extern const std::string id_remove_wallet;
-        extern const std::string id_rename;
-        extern const std::string id_rename_account;
-        extern const std::string id_rename_wallet;
-        extern const std::string id_replaceable;
-        extern const std::string id_report;
-        extern const std::string id_request_amount;
-        extern const std::string id_request_failed;
-        extern const std::string id_request_recovery_transactions;
-        extern const std::string id_request_sent;
-        extern const std::string id_request_twofactor_reset;
-        extern const std::string id_requested_fee_rate_too_low;
-        extern const std::string id_reset;
-        extern const std::string id_reset_spv;
-        extern const std::string id_resetting_your_twofactor_takes;
-        extern const std::string id_restore;
-        extern const std::string id_restore_a_blockstream_green;
-        extern const std::string id_restore_a_singlesig_wallet;
-        extern const std::string id_restore_a_wallet;
-        extern const std::string id_restore_green_wallet;
-        extern const std::string id_restore_temporary_wallet;
-        extern const std::string id_restore_wallet;
-        extern const std::string id_restore_with_recovery_phrase;
-        extern const std::string id_restoring_your_wallet;
-        extern const std::string id_review;
-        extern const std::string id_review_account_information;
-        extern const std::string id_review_output_s;
-        extern const std::string id_s_blocks_left;
-        extern const std::string id_s_from_s;
-        extern const std::string id_s_is_a_liquid_asset_you_can;
-        extern const std::string id_s_is_a_liquid_asset_you_need_a;
-        extern const std::string id_s_is_an_amp_asset_you_can;
-        extern const std::string id_s_is_an_amp_asset_you_need_an;
-        extern const std::string id_s_network;
-        extern const std::string id_s_will_send_you_the_funds_it;
-        extern const std::string id_safe_environment;
-        extern const std::string id_safely_stored;
-        extern const std::string id_save;
-        extern const std::string id_save_a_summary_of_your_accounts;
-        extern const std::string id_save_your_mnemonic;
-        extern const std::string id_scan_a_proposal;
-        extern const std::string id_scan_a_qr_code_for_spv_pairing;
-        extern const std::string id_scan_from_image;
-        extern const std::string id_scan_or_paste_your_extended;
-        extern const std::string id_scan_or_paste_your_public;
-        extern const std::string id_scan_qr_code;
-        extern const std::string id_scan_the_qr_code_with_an;
-        extern const std::string id_scan_to_send_here;
-        extern const std::string id_screen_lock;
-        extern const std::string id_search;
-        extern const std::string id_search_address;
-        extern const std::string id_second;
-        extern const std::string id_seconds;
-        extern const std::string id_security;
-        extern const std::string id_security_change;
-        extern const std::string id_see_archived_accounts_s;
-        extern const std::string id_see_our_privacy_policy_s;
-        extern const std::string id_see_our_terms_of_service_s;
-        extern const std::string id_segwit;
-        extern const std::string id_segwit_account;
-        extern const std::string id_segwit_bip84;
-        extern const std::string id_select_a_fiat_currency_and;
-        extern const std::string id_select_account;
-        extern const std::string id_select_an_app_on_s;
-        extern const std::string id_select_asset;
-        extern const std::string id_select_duration_of_twofactor;
-        extern const std::string id_select_initalize_to_create_a;
-        extern const std::string id_select_initialize_and_choose_to;
-        extern const std::string id_select_network;
-        extern const std::string id_select_the_s_app_on_your_ledger;
-        extern const std::string id_select_wallet;
-        extern const std::string id_select_watchonly_type;
-        extern const std::string id_select_word_number_d;
-        extern const std::string id_select_your_coins;
-        extern const std::string id_select_your_jade_to_login;
-        extern const std::string id_select_your_recovery_key;
-        extern const std::string id_send;
-        extern const std::string id_send_all;
-        extern const std::string id_send_all_funds;
-        extern const std::string id_send_all_requires_a_single;
-        extern const std::string id_send_and_receive_liquidbased;
-        extern const std::string id_send_error_report;
-        extern const std::string id_send_more_than_s_and_up_to_s_to;
-        extern const std::string id_send_to;
-        extern const std::string id_sending;
-        extern const std::string id_sending_request;
-        extern const std::string id_sensitive_information;
-        extern const std::string id_sent;
-        extern const std::string id_sent_to;
-        extern const std::string id_server_ip_and_port_ipport;
-        extern const std::string id_set_2fa_expiry;
-        extern const std::string id_set_a_limit_to_spend_without;
-        extern const std::string id_set_a_new_pin;
-        extern const std::string id_set_a_pin;
-        extern const std::string id_set_a_timeout_to_logout_after;
-        extern const std::string id_set_an_email_address_to_receive;
-        extern const std::string id_set_an_email_for_recovery;
-        extern const std::string id_set_custom_fee_rate;
-        extern const std::string id_set_locktime;
-        extern const std::string id_set_timelock;
-        extern const std::string id_set_twofactor_threshold;
-        extern const std::string id_set_up_a_passcode_for_your_ios;
-        extern const std::string id_set_up_a_screen_lock_for_your;
-        extern const std::string id_set_up_an_email_to_get;
-        extern const std::string id_set_up_credentials_to_access_in;
-        extern const std::string id_set_up_pgp_key_for;
-        extern const std::string id_set_up_twofactor_authentication;
-        extern const std::string id_set_up_watchonly;
-        extern const std::string id_set_up_watchonly_credentials;
-        extern const std::string id_set_wallet_name;
-        extern const std::string id_setting_up_your_wallet;
-        extern const std::string id_setting_updated;
-        extern const std::string id_settings;
-        extern const std::string id_setup_2fa_now;
-        extern const std::string id_setup_a_new_wallet;
-        extern const std::string id_setup_guide;
-        extern const std::string id_setup_jade;
-        extern const std::string id_setup_pin;
-        extern const std::string id_setup_pin_and_s;
-        extern const std::string id_setup_your_jade;
-        extern const std::string id_share;
-        extern const std::string id_share_address;
-        extern const std::string id_share_nonconfidential;
-        extern const std::string id_share_unblinding_data;
-        extern const std::string id_show;
-        extern const std::string id_show_address;
-        extern const std::string id_show_advanced_options;
-        extern const std::string id_show_all;
-        extern const std::string id_show_all_assets;
-        extern const std::string id_show_bitcoin_amounts_in;
-        extern const std::string id_show_coins_with_expiring;
-        extern const std::string id_show_details;
-        extern const std::string id_show_fiat;
-        extern const std::string id_show_lightning_invoice;
-        extern const std::string id_show_my_wallet_backup;
-        extern const std::string id_show_onchain_address;
-        extern const std::string id_show_qr_code;
-        extern const std::string id_show_recovery_phrase;
-        extern const std::string id_sign_message;
-        extern const std::string id_sign_transaction;
-        extern const std::string id_signature_validation_failed_if;
-        extern const std::string id_signup_in_progress;
-        extern const std::string id_simple;
-        extern const std::string id_simple__secure_selfcustody;
-        extern const std::string id_simple_portable_standard;
-        extern const std::string id_simplified_payment_verification;
-        extern const std::string id_singlesig;
-        extern const std::string id_singlesig_wallets_are_not_yet;
-        extern const std::string id_skip;
-        extern const std::string id_skip_not_recommended;
-        extern const std::string id_slide_to_send;
-        extern const std::string id_slow;
-        extern const std::string id_sms;
-        extern const std::string id_snnreset_this_setting_and_then;
-        extern const std::string id_socks5_hostname;
-        extern const std::string id_socks5_port;
-        extern const std::string id_socks5_proxy_and_port_must_be;
-        extern const std::string id_something_went_wrong;
-        extern const std::string id_spend_your_bitcoin_without_2fa;
-        extern const std::string id_spv_is_always_synchronized_on;
-        extern const std::string id_spv_mode_is_currently_available;
-        extern const std::string id_spv_not_fully_synced;
-        extern const std::string id_spv_notifications;
-        extern const std::string id_spv_reset_and_restarted;
-        extern const std::string id_spv_synchronization;
-        extern const std::string id_spv_synchronization_using_tor;
-        extern const std::string id_spv_unverified;
-        extern const std::string id_spv_verification;
-        extern const std::string id_standard;
-        extern const std::string id_standard_account;
-        extern const std::string id_standard_accounts_allow_you_to;
-        extern const std::string id_standard_wallet;
-        extern const std::string id_start_a_2fa_reset_process_if;
-        extern const std::string id_start_receiving_funds_and_set;
-        extern const std::string id_status;
-        extern const std::string id_step;
-        extern const std::string id_store_it_somewhere_safe;
-        extern const std::string id_submit;
-        extern const std::string id_success;
-        extern const std::string id_successfully_sent_your_funds;
-        extern const std::string id_support;
-        extern const std::string id_support_page;
-        extern const std::string id_swap;
-        extern const std::string id_swap_is_in_progress;
-        extern const std::string id_swap_proposal;
-        extern const std::string id_swapped;
-        extern const std::string id_sweep;
-        extern const std::string id_sweep_from_paper_wallet;
-        extern const std::string id_sweep_into_s;
-        extern const std::string id_switch_network;
-        extern const std::string id_synchronize_spv_on_mobile;
-        extern const std::string id_syou_need_ton1_reset_greens;
-        extern const std::string id_system_location;
-        extern const std::string id_system_message;
-        extern const std::string id_take_control_your_keys_your;
-        extern const std::string id_tap_on_the_card_to_view;
-        extern const std::string id_tap_to_restart_the_simplified;
-        extern const std::string id_tap_to_scan_a_qr_code_and;
-        extern const std::string id_taproot;
-        extern const std::string id_taproot_account;
-        extern const std::string id_taproot_bip86;
-        extern const std::string id_telegram;
-        extern const std::string id_terms_of_service;
-        extern const std::string id_terms_of_use;
-        extern const std::string id_testnet_and_liquid_testnet;
-        extern const std::string id_testnet_electrum_server;
-        extern const std::string id_testnet_wallets;
-        extern const std::string id_thank_you_for_downloading_green;
-        extern const std::string id_thank_you_for_your_feedback;
-        extern const std::string id_the_1_year_2fa_reset_process;
-        extern const std::string id_the_address_is_valid;
-        extern const std::string id_the_addresses_dont_match;
-        extern const std::string id_the_asset_registry_is_currently;
-        extern const std::string id_the_camera_has_a_problem_you;
-        extern const std::string id_the_default_value_is_90_days_if;
-        extern const std::string id_the_easier_safer_and_faster;
-        extern const std::string id_the_email_will_also_be_used_to;
-        extern const std::string id_the_hardware_wallet_you_are;
-        extern const std::string id_the_importance_of_twofactor;
-        extern const std::string id_the_liquid_network_is_a_bitcoin;
-        extern const std::string id_the_network_selected_on_the;
-        extern const std::string id_the_new_email_will_be_used_for;
-        extern const std::string id_the_new_firmware_requires_you;
-        extern const std::string id_the_password_cant_be_empty;
-        extern const std::string id_the_qr_code_does_not_include;
-        extern const std::string id_the_recovery_key_below_will_not;
-        extern const std::string id_the_recovery_phrase_can_be_used;
-        extern const std::string id_the_recovery_phrase_doesnt;
-        extern const std::string id_the_source_code_is_available_at;
-        extern const std::string id_the_transaction_contains;
-        extern const std::string id_the_username_cant_be_empty;
-        extern const std::string id_the_waiting_period_is_necessary;
-        extern const std::string id_there_are_no_results_for_the;
-        extern const std::string id_there_is_already_a_pin_set_for;
-        extern const std::string id_there_is_already_a_swap_in;
-        extern const std::string id_there_is_already_an_archived;
-        extern const std::string id_these_are_some_compatible;
-        extern const std::string id_these_settings_apply_for_every;
-        extern const std::string id_this_amount_is_below_the;
-        extern const std::string id_this_feature_is_coming_soon;
-        extern const std::string id_this_might_take_up_to_a;
-        extern const std::string id_this_signature_is_a_proof_of;
-        extern const std::string id_this_transaction_spent;
-        extern const std::string id_this_wallet_is_based_on_your;
-        extern const std::string id_this_wallet_operates_on_a_test;
-        extern const std::string id_this_will_disable_pin_login_for;
-        extern const std::string id_this_will_log_you_out_and;
-        extern const std::string id_ticker;
-        extern const std::string id_time_s;
-        extern const std::string id_tip_we_recommend_you_enable;
-        extern const std::string id_tip_you_can_use_the;
-        extern const std::string id_to;
-        extern const std::string id_to_authorize_the_transaction;
-        extern const std::string id_to_keep_you_in_control_of_your;
-        extern const std::string id_too_many_pin_attempts;
-        extern const std::string id_tor;
-        extern const std::string id_tor_connectivity_disabled;
-        extern const std::string id_tor_is_connected;
-        extern const std::string id_tor_is_not_yet_available_for;
-        extern const std::string id_tor_status;
-        extern const std::string id_tor_will_use_1s_and_only_work;
-        extern const std::string id_total;
-        extern const std::string id_total_assets;
-        extern const std::string id_total_balance;
-        extern const std::string id_total_with_fee;
-        extern const std::string id_touch_id;
-        extern const std::string id_touch_to_display;
-        extern const std::string id_touchface_id_not_available;
-        extern const std::string id_transaction_already_confirmed;
-        extern const std::string id_transaction_copied_to_clipboard;
-        extern const std::string id_transaction_details;
-        extern const std::string id_transaction_id;
-        extern const std::string id_transaction_sent;
-        extern const std::string id_transaction_status;
-        extern const std::string id_transactions;
-        extern const std::string id_troubleshoot;
-        extern const std::string id_try_again;
-        extern const std::string id_try_now;
-        extern const std::string id_turn_on_bluetooth_to_connect;
-        extern const std::string id_two_factor_authentication;
-        extern const std::string id_twofactor;
-        extern const std::string id_twofactor_authentication;
-        extern const std::string id_twofactor_authentication_expiry;
-        extern const std::string id_twofactor_expiration_period;
-        extern const std::string id_twofactor_protection_does_not;
-        extern const std::string id_twofactor_reset_in_progress;
-        extern const std::string id_twofactor_settings;
-        extern const std::string id_twofactor_threshold;
-        extern const std::string id_tx_count;
-        extern const std::string id_txid;
-        extern const std::string id_type_the_next_word;
-        extern const std::string id_unable_to_contact_the_green;
-        extern const std::string id_unarchive;
-        extern const std::string id_unarchive_account;
-        extern const std::string id_unblinding_data;
-        extern const std::string id_unconfirmed;
-        extern const std::string id_undo_2fa_dispute;
-        extern const std::string id_unknown;
-        extern const std::string id_unknown_bip21_parameter;
-        extern const std::string id_unknown_custom;
-        extern const std::string id_unknown_firmware;
-        extern const std::string id_unlock;
-        extern const std::string id_unlock_green;
-        extern const std::string id_unlock_jade_to_continue;
-        extern const std::string id_unlock_your_device_to_continue;
-        extern const std::string id_unlocked_coins_can_be_spent_and;
-        extern const std::string id_unlocking_coins;
-        extern const std::string id_unstable_internet_connection;
-        extern const std::string id_update;
-        extern const std::string id_updated;
-        extern const std::string id_updating_firmware;
-        extern const std::string id_uploading_firmware;
-        extern const std::string id_use_a_hardware_wallet_as_your;
-        extern const std::string id_use_a_public_key;
-        extern const std::string id_use_all_available_coins;
-        extern const std::string id_use_an_existing_recovery_phrase;
-        extern const std::string id_use_an_xpub_for_which_you_own;
-        extern const std::string id_use_android_screen_lock_to_log;
-        extern const std::string id_use_comma_separated_values_or;
-        extern const std::string id_use_hardware_device;
-        extern const std::string id_use_secure_display_and_screen;
-        extern const std::string id_use_the_jogwheel_to_select_the;
-        extern const std::string id_use_this_recovery_phrase_to;
-        extern const std::string id_use_your_email_to_receive;
-        extern const std::string id_user_contact_info_ip_address;
-        extern const std::string id_user_not_found_or_invalid;
-        extern const std::string id_username;
-        extern const std::string id_username_not_available;
-        extern const std::string id_value_must_be_between_144_and;
-        extern const std::string id_verified;
-        extern const std::string id_verify;
-        extern const std::string id_verify_on_device;
-        extern const std::string id_verify_recovery_phrase;
-        extern const std::string id_verify_your_bitcoin;
-        extern const std::string id_verify_your_pin;
-        extern const std::string id_verifying_transactions;
-        extern const std::string id_version;
-        extern const std::string id_version_1s;
-        extern const std::string id_version_1s_2s;
-        extern const std::string id_view_account;
-        extern const std::string id_view_archived_accounts;
-        extern const std::string id_view_archived_accounts_d;
-        extern const std::string id_view_in_explorer;
-        extern const std::string id_view_more;
-        extern const std::string id_visit_s_for_further_information;
-        extern const std::string id_visit_the_blockstream_help;
-        extern const std::string id_waiting_for_transaction;
-        extern const std::string id_wallet;
-        extern const std::string id_wallet_already_restored;
-        extern const std::string id_wallet_assets;
-        extern const std::string id_wallet_backup;
-        extern const std::string id_wallet_coins_will_require;
-        extern const std::string id_wallet_creation_failed;
-        extern const std::string id_wallet_found;
-        extern const std::string id_wallet_name;
-        extern const std::string id_wallet_not_found;
-        extern const std::string id_wallet_pockets;
-        extern const std::string id_wallet_transactions;
-        extern const std::string id_wallets;
-        extern const std::string id_warning;
-        extern const std::string id_warning_no_trusted_node_set;
-        extern const std::string id_warning_nononion_address;
-        extern const std::string id_warning_resetting_twofactor;
-        extern const std::string id_warning_there_is_already_a;
-        extern const std::string id_warning_wallet_locked_by;
-        extern const std::string id_warning_watchonly_credentials;
-        extern const std::string id_warning_you_need_a_positive;
-        extern const std::string id_watchonly;
-        extern const std::string id_watchonly_credentials;
-        extern const std::string id_watchonly_details;
-        extern const std::string id_watchonly_disabled;
-        extern const std::string id_watchonly_login;
-        extern const std::string id_watchonly_mode_can_be_activated;
-        extern const std::string id_watchonly_mode_cannot_be;
-        extern const std::string id_watchonly_wallet;
-        extern const std::string id_we_use_the_camera_to_scan_qr;
-        extern const std::string id_we_will_do_our_best_to_find_a;
-        extern const std::string id_welcome;
-        extern const std::string id_welcome_to;
-        extern const std::string id_welcome_to_blockstream_jade;
-        extern const std::string id_welcome_to_your_wallet;
-        extern const std::string id_well_done_you_can_continue;
-        extern const std::string id_well_done_you_can_continue_with;
-        extern const std::string id_well_get_you_set_up_in_no_time;
-        extern const std::string id_well_get_you_set_up_with_an_amp;
-        extern const std::string id_what_is_word_number_s;
-        extern const std::string id_what_type_of_account_would_you;
-        extern const std::string id_whats_collected;
-        extern const std::string id_whats_new;
-        extern const std::string id_whats_not_collected;
-        extern const std::string id_where_would_you_like_to;
-        extern const std::string id_whomever_can_access_your;
-        extern const std::string id_wireless;
-        extern const std::string id_withdraw;
-        extern const std::string id_withdraw_limits_s__s;
-        extern const std::string id_word;
-        extern const std::string id_word_d_of_d;
-        extern const std::string id_write_down_the_words;
-        extern const std::string id_write_down_your_recovery_phrase;
-        extern const std::string id_wrong_choice_check_your;
-        extern const std::string id_xpub;
-        extern const std::string id_year;
-        extern const std::string id_years;
-        extern const std::string id_you_are_not_connected;
-        extern const std::string id_you_are_not_connected_please;
-        extern const std::string id_you_are_now_connected;
-        extern const std::string id_you_are_redeeming_funds_from_s;
-        extern const std::string id_you_can_change_these_later_on;
-        extern const std::string id_you_can_send_up_to;
-        extern const std::string id_you_can_still_receive_funds_but;
-        extern const std::string id_you_can_sweep_s_of_your_funds;
-        extern const std::string id_you_can_use_your_wallet_to;
-        extern const std::string id_you_cannot_create_or_restore_a;
-        extern const std::string id_you_cannot_receive_more_than_s;
-        extern const std::string id_you_have_a_significant_amount;
-        extern const std::string id_you_have_clicked_a_payment_uri;
-        extern const std::string id_you_have_clicked_a_uri_select_a;
-        extern const std::string id_you_have_control_on_your_funds;
-        extern const std::string id_you_have_just_received_s;
-        extern const std::string id_you_have_no_coins_to_send;
-        extern const std::string id_you_have_received_s;
-        extern const std::string id_you_have_successfully_changed;
-        extern const std::string id_you_have_successfully_sent_a;
-        extern const std::string id_you_have_to_authenticate_using;
-        extern const std::string id_you_have_tor_enabled_are_you;
-        extern const std::string id_you_must_first_log_out_before;
-        extern const std::string id_you_must_save_this_mnemonic_now;
-        extern const std::string id_you_need_a_liquid_account_in;
-        extern const std::string id_you_only_have_one_twofactor;
-        extern const std::string id_you_will_be_asked_to_enter_your;
-        extern const std::string id_you_will_need_to_reenter_your;
-        extern const std::string id_you_will_see_your_coins_here;
-        extern const std::string id_youll_need_to_back_up_your;
-        extern const std::string id_youll_need_your_pin_to_log_in;
-        extern const std::string id_youll_need_your_recovery_phrase;
-        extern const std::string id_youll_see_your_coins_here_when;
-        extern const std::string id_your_2fa_expires_so_that_if_you;
-        extern const std::string id_your_bitcoin_and_liquid_assets;
-        extern const std::string id_your_bluetooth_adapter_is;
-        extern const std::string id_your_current_receive_capacity;
-        extern const std::string id_your_device_was_disconnected;
-        extern const std::string id_your_favourite_exchange_rate_is;
-        extern const std::string id_your_funds_are_secured_by;
-        extern const std::string id_your_funds_are_secured_by_a;
-        extern const std::string id_your_funds_are_secured_by_your;
-        extern const std::string id_your_funds_have_grown;
-        extern const std::string id_your_green_wallet_is_now_ready;
-        extern const std::string id_your_ios_device_might_not_be;
-        extern const std::string id_your_keys_secure_your_coins_on;
-        extern const std::string id_your_notifications_will_be;
-        extern const std::string id_your_pin_or_your_mnemonic_will;
-        extern const std::string id_your_s_sent_to_s_has_been;
-        extern const std::string id_your_settings_are_unsavednndo;
-        extern const std::string id_your_swap_proposal_is_generated;
-        extern const std::string id_your_transactions_will_be_shown;
-        extern const std::string id_your_twofactor_threshold_is_s;
-        extern const std::string id_your_wallet_backup_is_made_of;
-        extern const std::string id_your_wallet_is_locked_for_a;
-        extern const std::string id_your_wallet_is_locked_under_2fa;
-        extern const std::string id_your_wallet_is_not_yet_fully;
-        extern const std::string id_your_watchonly_username_and;
-        extern const std::string id_youve_entered_an_invalid_pin;
+        inline constexpr std::string_view id_1030_minutes{ "id_1030_minutes" }; // ~ 10-30 Minutes
+        inline constexpr std::string_view id_12_confirmations{ "id_12_confirmations" }; // 1/2 confirmations
+        // 12 months (51840 blocks)
+        inline constexpr std::string_view id_12_months_51840_blocks{ "id_12_months_51840_blocks" };
+        inline constexpr std::string_view id_12_words{ "id_12_words" }; // 12 words
+        // 15 months (65535 blocks)
+        inline constexpr std::string_view id_15_months_65535_blocks{ "id_15_months_65535_blocks" };
+        // 1. Double check all of your recovery phrase word by word, are all words correct?\n2. The order of words is
+        // important! Make sure you\'ve typed the words in the correct order.\n\nIf neither of these tips have helped
+        // you, or if you don\'t have a 12, 24 or 27 words recovery phrase please check our help center.
+        inline constexpr std::string_view id_1_double_check_all_of_your{ "id_1_double_check_all_of_your" };
+        inline constexpr std::string_view id_1d_2s_ago{ "id_1d_2s_ago" }; // %1$d %2$s ago
+        inline constexpr std::string_view id_1d_minutes{ "id_1d_minutes" }; // %1$d minutes
+        inline constexpr std::string_view id_1s_blocks_left_2d{ "id_1s_blocks_left_2d" }; // %1$s blocks left %2$d
+        inline constexpr std::string_view id_1s_twofactor_setup{ "id_1s_twofactor_setup" }; // %1$s Two-Factor setup
+        inline constexpr std::string_view id_24_words{ "id_24_words" }; // 24 words
+        inline constexpr std::string_view id_2_hours{ "id_2_hours" }; // ~ 2 Hours
+        // 2FA Dispute in Progress
+        inline constexpr std::string_view id_2fa_dispute_in_progress{ "id_2fa_dispute_in_progress" };
+        inline constexpr std::string_view id_2fa_expired{ "id_2fa_expired" }; // 2FA Expired
+        inline constexpr std::string_view id_2fa_expiry{ "id_2fa_expiry" }; // 2FA Expiry
+        // 2FA isn’t set up yet.\n\nYou can choose your favourite 2FA method among an authenticator app, email, SMS or a
+        // call.
+        inline constexpr std::string_view id_2fa_isnt_set_up_yetnnyou_can{ "id_2fa_isnt_set_up_yetnnyou_can" };
+        inline constexpr std::string_view id_2fa_methods{ "id_2fa_methods" }; // 2FA Methods
+        inline constexpr std::string_view id_2fa_protected{ "id_2fa_protected" }; // 2FA Protected
+        // 2FA Reset in Progress
+        inline constexpr std::string_view id_2fa_reset_in_progress{ "id_2fa_reset_in_progress" };
+        inline constexpr std::string_view id_2fa_shield{ "id_2fa_shield" }; // 2FA Shield
+        inline constexpr std::string_view id_2fa_shield_account{ "id_2fa_shield_account" }; // 2FA Shield Account
+        inline constexpr std::string_view id_2fa_threshold{ "id_2fa_threshold" }; // 2FA Threshold
+        inline constexpr std::string_view id_2of2{ "id_2of2" }; // 2of2
+        inline constexpr std::string_view id_2of3{ "id_2of3" }; // 2of3
+        inline constexpr std::string_view id_2of3_account{ "id_2of3_account" }; // 2of3 Account
+        inline constexpr std::string_view id_2of3_with_2fa{ "id_2of3_with_2fa" }; // 2of3 with 2FA
+        inline constexpr std::string_view id_2of3_with_2fa_shield{ "id_2of3_with_2fa_shield" }; // 2of3 with 2FA Shield
+        inline constexpr std::string_view id_4_hours{ "id_4_hours" }; // ~ 4 Hours
+        inline constexpr std::string_view id_5_seconds_minimum{ "id_5_seconds_minimum" }; // 5 seconds minimum
+        // 6 months (25920 blocks)
+        inline constexpr std::string_view id_6_months_25920_blocks{ "id_6_months_25920_blocks" };
+        // A 2of3 account requires two out of three signatures to spend coins. The third signature is from a backup key
+        // known only to you. This gives you the security benefits of a standard account, while still allowing you to
+        // move your coins independently at any point in time.
+        inline constexpr std::string_view id_a_2of3_account_requires_two_out{ "id_a_2of3_account_requires_two_out" };
+        // A funding fee of %s (minimum %s) is applied when receiving amounts above your current receive capacity of %s
+        inline constexpr std::string_view id_a_funding_fee_of_s_minimum_s_is{ "id_a_funding_fee_of_s_minimum_s_is" };
+        // A new transaction has just arrived in your wallet.
+        inline constexpr std::string_view id_a_new_transaction_has_just{ "id_a_new_transaction_has_just" };
+        // A newer version of Blockstream Green is now available
+        inline constexpr std::string_view id_a_newer_version_of_blockstream{ "id_a_newer_version_of_blockstream" };
+        // A powerful hardware wallet for securing your Bitcoin.
+        inline constexpr std::string_view id_a_powerful_hardware_wallet_for{ "id_a_powerful_hardware_wallet_for" };
+        // A screen lock must be enabled from Android settings
+        inline constexpr std::string_view id_a_screen_lock_must_be_enabled{ "id_a_screen_lock_must_be_enabled" };
+        // A set up funding fee of %s (%s) will be applied to the received amount.
+        inline constexpr std::string_view id_a_set_up_funding_fee_of_s_s{ "id_a_set_up_funding_fee_of_s_s" };
+        // A wallet is detected on this device:
+        inline constexpr std::string_view id_a_wallet_is_detected_on_this{ "id_a_wallet_is_detected_on_this" };
+        inline constexpr std::string_view id_about{ "id_about" }; // About
+        inline constexpr std::string_view id_accept{ "id_accept" }; // ACCEPT
+        inline constexpr std::string_view id_access{ "id_access" }; // Access
+        inline constexpr std::string_view id_account{ "id_account" }; // Account
+        inline constexpr std::string_view id_account__asset{ "id_account__asset" }; // Account & Asset
+        inline constexpr std::string_view id_account_address{ "id_account_address" }; // Account Address
+        inline constexpr std::string_view id_account_archived{ "id_account_archived" }; // Account archived
+        inline constexpr std::string_view id_account_balance{ "id_account_balance" }; // Account Balance
+        // Account Extended Public Keys
+        inline constexpr std::string_view id_account_extended_public_keys{ "id_account_extended_public_keys" };
+        // Account for special assets, monitored or authorized by the asset issuer.
+        inline constexpr std::string_view id_account_for_special_assets{ "id_account_for_special_assets" };
+        // Account has been archived
+        inline constexpr std::string_view id_account_has_been_archived{ "id_account_has_been_archived" };
+        // Account has been removed
+        inline constexpr std::string_view id_account_has_been_removed{ "id_account_has_been_removed" };
+        inline constexpr std::string_view id_account_id{ "id_account_id" }; // Account ID
+        inline constexpr std::string_view id_account_name{ "id_account_name" }; // Account Name
+        inline constexpr std::string_view id_account_type{ "id_account_type" }; // Account Type
+        inline constexpr std::string_view id_accounts{ "id_accounts" }; // Accounts
+        inline constexpr std::string_view id_accounts_summary{ "id_accounts_summary" }; // Accounts summary
+        inline constexpr std::string_view id_action_canceled{ "id_action_canceled" }; // Action canceled
+        inline constexpr std::string_view id_actions{ "id_actions" }; // Actions
+        inline constexpr std::string_view id_add_2fa_account{ "id_add_2fa_account" }; // Add 2FA Account
+        // Add a note (only you can see it).
+        inline constexpr std::string_view id_add_a_note_only_you_can_see_it{ "id_add_a_note_only_you_can_see_it" };
+        // Add a PGP public key to receive encrypted email and keep your privacy
+        inline constexpr std::string_view id_add_a_pgp_public_key_to_receive{ "id_add_a_pgp_public_key_to_receive" };
+        inline constexpr std::string_view id_add_amount{ "id_add_amount" }; // Add Amount
+        inline constexpr std::string_view id_add_amount_optional{ "id_add_amount_optional" }; // Add amount (optional)
+        inline constexpr std::string_view id_add_an_amp_wallet{ "id_add_an_amp_wallet" }; // Add an AMP wallet
+        inline constexpr std::string_view id_add_another_wallet{ "id_add_another_wallet" }; // Add another wallet
+        // Add custom network by QR Code
+        inline constexpr std::string_view id_add_custom_network_by_qr_code{ "id_add_custom_network_by_qr_code" };
+        // Add custom network by URL
+        inline constexpr std::string_view id_add_custom_network_by_url{ "id_add_custom_network_by_url" };
+        inline constexpr std::string_view id_add_new_account{ "id_add_new_account" }; // Add New Account
+        inline constexpr std::string_view id_add_note{ "id_add_note" }; // Add Note
+        inline constexpr std::string_view id_add_recipient{ "id_add_recipient" }; // Add Recipient
+        inline constexpr std::string_view id_add_wallet{ "id_add_wallet" }; // Add Wallet
+        inline constexpr std::string_view id_adding_a_2fa{ "id_adding_a_2fa" }; // adding a 2FA
+        inline constexpr std::string_view id_additional_networks{ "id_additional_networks" }; // Additional Networks
+        inline constexpr std::string_view id_additional_security{ "id_additional_security" }; // Additional Security
+        inline constexpr std::string_view id_address{ "id_address" }; // Address
+        inline constexpr std::string_view id_address_1s{ "id_address_1s" }; // Address: %1$s
+        // Address copied to clipboard
+        inline constexpr std::string_view id_address_copied_to_clipboard{ "id_address_copied_to_clipboard" };
+        inline constexpr std::string_view id_address_to_receive{ "id_address_to_receive" }; // Address to Receive
+        inline constexpr std::string_view id_address_type{ "id_address_type" }; // Address Type
+        inline constexpr std::string_view id_address_verified{ "id_address_verified" }; // Address verified!
+        // Address was filled by a Payment URI
+        inline constexpr std::string_view id_address_was_filled_by_a_payment{ "id_address_was_filled_by_a_payment" };
+        inline constexpr std::string_view id_addresses{ "id_addresses" }; // Addresses
+        inline constexpr std::string_view id_advanced{ "id_advanced" }; // Advanced
+        // Advanced network settings
+        inline constexpr std::string_view id_advanced_network_settings{ "id_advanced_network_settings" };
+        inline constexpr std::string_view id_advanced_options{ "id_advanced_options" }; // Advanced options
+        // Advanced options for your third recovery key
+        inline constexpr std::string_view id_advanced_options_for_your_third{ "id_advanced_options_for_your_third" };
+        inline constexpr std::string_view id_all{ "id_all" }; // All
+        inline constexpr std::string_view id_all_assets{ "id_all_assets" }; // All Assets
+        inline constexpr std::string_view id_all_coins{ "id_all_coins" }; // (All coins)
+        inline constexpr std::string_view id_all_networks{ "id_all_networks" }; // All networks
+        // All of the accounts in your wallet need to be empty before deleting it.
+        inline constexpr std::string_view id_all_of_the_accounts_in_your{ "id_all_of_the_accounts_in_your" };
+        // All the coins received or created as change.
+        inline constexpr std::string_view id_all_the_coins_received_or{ "id_all_the_coins_received_or" };
+        inline constexpr std::string_view id_all_wallets{ "id_all_wallets" }; // All wallets
+        inline constexpr std::string_view id_allow_collection{ "id_allow_collection" }; // Allow collection
+        // Allow data collection
+        inline constexpr std::string_view id_allow_data_collection{ "id_allow_data_collection" };
+        // Allows you to quickly check your balance, receive funds or sweep a paper wallet. You can\'t send funds in
+        // watch-only mode.
+        inline constexpr std::string_view id_allows_you_to_quickly_check{ "id_allows_you_to_quickly_check" };
+        inline constexpr std::string_view id_always{ "id_always" }; // Always
+        inline constexpr std::string_view id_always_ask{ "id_always_ask" }; // Always ask
+        inline constexpr std::string_view id_amount{ "id_amount" }; // Amount
+        // Amount above maximum allowed value
+        inline constexpr std::string_view id_amount_above_maximum_allowed{ "id_amount_above_maximum_allowed" };
+        // Amount below minimum allowed value
+        inline constexpr std::string_view id_amount_below_minimum_allowed{ "id_amount_below_minimum_allowed" };
+        // Amount below the dust threshold
+        inline constexpr std::string_view id_amount_below_the_dust_threshold{ "id_amount_below_the_dust_threshold" };
+        inline constexpr std::string_view id_amount_in_s{ "id_amount_in_s" }; // Amount in %s
+        // Amount must be at least %s
+        inline constexpr std::string_view id_amount_must_be_at_least_s{ "id_amount_must_be_at_least_s" };
+        // Amount must be at most %s
+        inline constexpr std::string_view id_amount_must_be_at_most_s{ "id_amount_must_be_at_most_s" };
+        inline constexpr std::string_view id_amount_to_receive{ "id_amount_to_receive" }; // Amount to Receive
+        inline constexpr std::string_view id_amp{ "id_amp" }; // AMP
+        inline constexpr std::string_view id_amp_account{ "id_amp_account" }; // AMP Account
+        // AMP accounts are only available on Liquid wallets. You may be required to provide your account ID to issuers
+        // to receive an AMP Asset.
+        inline constexpr std::string_view id_amp_accounts_are_only_available{ "id_amp_accounts_are_only_available" };
+        inline constexpr std::string_view id_amp_id{ "id_amp_id" }; // AMP ID
+        inline constexpr std::string_view id_amp_wallet{ "id_amp_wallet" }; // AMP Wallet
+        // An unidentified error occurred. The following error log can help you identify the issue:\n\n%s
+        inline constexpr std::string_view id_an_unidentified_error_occurred{ "id_an_unidentified_error_occurred" };
+        // Another 2FA method is already active. Confirm via 2FA that you authorize this change.
+        inline constexpr std::string_view id_another_2fa_method_is_already{ "id_another_2fa_method_is_already" };
+        // Any wallet found will be displayed here.
+        inline constexpr std::string_view id_any_wallet_found_will_be{ "id_any_wallet_found_will_be" };
+        inline constexpr std::string_view id_app_settings{ "id_app_settings" }; // App Settings
+        inline constexpr std::string_view id_archive{ "id_archive" }; // Archive
+        inline constexpr std::string_view id_archive_account{ "id_archive_account" }; // Archive account
+        inline constexpr std::string_view id_archived{ "id_archived" }; // Archived
+        inline constexpr std::string_view id_archived_account{ "id_archived_account" }; // Archived Account
+        inline constexpr std::string_view id_archived_accounts{ "id_archived_accounts" }; // Archived Accounts
+        // Are you sure you want to delete the recipient?
+        inline constexpr std::string_view id_are_you_sure_you_want_to_delete{ "id_are_you_sure_you_want_to_delete" };
+        // Are you sure you want to remove your Lightning account?
+        inline constexpr std::string_view id_are_you_sure_you_want_to_remove{ "id_are_you_sure_you_want_to_remove" };
+        // Are you sure you want to view the transaction using %s?
+        inline constexpr std::string_view id_are_you_sure_you_want_to_view{ "id_are_you_sure_you_want_to_view" };
+        // As easy as snapping a photo with your phone. If you have an existing wallet, scan your recovery phrase from
+        // settings.
+        inline constexpr std::string_view id_as_easy_as_snapping_a_photo{ "id_as_easy_as_snapping_a_photo" };
+        inline constexpr std::string_view id_asset{ "id_asset" }; // Asset
+        inline constexpr std::string_view id_asset_details{ "id_asset_details" }; // Asset Details
+        // Asset icons are missing, try reloading them.
+        inline constexpr std::string_view id_asset_icons_are_missing_try{ "id_asset_icons_are_missing_try" };
+        inline constexpr std::string_view id_asset_id{ "id_asset_id" }; // Asset ID
+        inline constexpr std::string_view id_asset_name{ "id_asset_name" }; // Asset Name
+        inline constexpr std::string_view id_assets{ "id_assets" }; // Assets
+        // Assets cannot be used on Bitcoin
+        inline constexpr std::string_view id_assets_cannot_be_used_on_bitcoin{ "id_assets_cannot_be_used_on_bitcoin" };
+        // At least 8 characters required
+        inline constexpr std::string_view id_at_least_8_characters_required{ "id_at_least_8_characters_required" };
+        // Attempts remaining: %d
+        inline constexpr std::string_view id_attempts_remaining_d{ "id_attempts_remaining_d" };
+        inline constexpr std::string_view id_authenticate{ "id_authenticate" }; // Authenticate
+        inline constexpr std::string_view id_authenticate_address{ "id_authenticate_address" }; // Authenticate address
+        // Authenticate to view the recovery phrase
+        inline constexpr std::string_view id_authenticate_to_view_the{ "id_authenticate_to_view_the" };
+        // Authentication error: %s
+        inline constexpr std::string_view id_authentication_error_s{ "id_authentication_error_s" };
+        // Authentication failed
+        inline constexpr std::string_view id_authentication_failed{ "id_authentication_failed" };
+        // Authentication Successful
+        inline constexpr std::string_view id_authentication_successful{ "id_authentication_successful" };
+        inline constexpr std::string_view id_authenticator_app{ "id_authenticator_app" }; // Authenticator app
+        // Authenticator QR Code
+        inline constexpr std::string_view id_authenticator_qr_code{ "id_authenticator_qr_code" };
+        // Authenticator secret key
+        inline constexpr std::string_view id_authenticator_secret_key{ "id_authenticator_secret_key" };
+        inline constexpr std::string_view id_auto_logout_timeout{ "id_auto_logout_timeout" }; // Auto logout timeout
+        // Auto logout timeout expired
+        inline constexpr std::string_view id_auto_logout_timeout_expired{ "id_auto_logout_timeout_expired" };
+        inline constexpr std::string_view id_autolock_after{ "id_autolock_after" }; // Autolock After
+        inline constexpr std::string_view id_available{ "id_available" }; // Available
+        inline constexpr std::string_view id_available_funds_s{ "id_available_funds_s" }; // Available funds %s
+        inline constexpr std::string_view id_back{ "id_back" }; // Back
+        // Back Up Recovery Phrase
+        inline constexpr std::string_view id_back_up_recovery_phrase{ "id_back_up_recovery_phrase" };
+        // Backup Recovery Phrase
+        inline constexpr std::string_view id_backup_recovery_phrase{ "id_backup_recovery_phrase" };
+        // Backup the recovery mnemonic and recovery xpub to recover funds from your 2of3 account.
+        inline constexpr std::string_view id_backup_the_recovery_mnemonic{ "id_backup_the_recovery_mnemonic" };
+        // Backup your mnemonic before removing the wallet from this device.
+        inline constexpr std::string_view id_backup_your_mnemonic_before{ "id_backup_your_mnemonic_before" };
+        // Be aware, other apps can read or change the clipboard
+        inline constexpr std::string_view id_be_aware_other_apps_can_read_or{ "id_be_aware_other_apps_can_read_or" };
+        // Be sure your recovery phrase is backed up before removing this wallet.
+        inline constexpr std::string_view id_be_sure_your_recovery_phrase_is{ "id_be_sure_your_recovery_phrase_is" };
+        inline constexpr std::string_view id_before_you_backup{ "id_before_you_backup" }; // Before You Backup
+        // Biometric Login is Disabled
+        inline constexpr std::string_view id_biometric_login_is_disabled{ "id_biometric_login_is_disabled" };
+        // Biometric Login is Enabled
+        inline constexpr std::string_view id_biometric_login_is_enabled{ "id_biometric_login_is_enabled" };
+        // Biometrics Authentication
+        inline constexpr std::string_view id_biometrics_authentication{ "id_biometrics_authentication" };
+        inline constexpr std::string_view id_bip39_passphrase{ "id_bip39_passphrase" }; // BIP39 Passphrase
+        // BIP39 Passphrase login
+        inline constexpr std::string_view id_bip39_passphrase_login{ "id_bip39_passphrase_login" };
+        // BIP49 accounts allow you to segregate funds, and to receive on wrapped segwit addresses, thus ensuring the
+        // highest backwards compatibility when receiving funds from anyone on the network.
+        inline constexpr std::string_view id_bip49_accounts_allow_you_to{ "id_bip49_accounts_allow_you_to" };
+        // BIP84 accounts allow you to segregate your funds, and to receive on bech32 native segwit addresses. This
+        // account type ensures cheaper transactions when sending funds, but not all services support bech32 addresses
+        // yet.
+        inline constexpr std::string_view id_bip84_accounts_allow_you_to{ "id_bip84_accounts_allow_you_to" };
+        inline constexpr std::string_view id_bitcoin_and_liquid{ "id_bitcoin_and_liquid" }; // Bitcoin and Liquid
+        inline constexpr std::string_view id_bitcoin_denomination{ "id_bitcoin_denomination" }; // Bitcoin denomination
+        // Bitcoin Electrum server
+        inline constexpr std::string_view id_bitcoin_electrum_server{ "id_bitcoin_electrum_server" };
+        // Bitcoin is the world\'s leading P2P cryptocurrency network. Select to send and receive bitcoin.
+        inline constexpr std::string_view id_bitcoin_is_the_worlds_leading{ "id_bitcoin_is_the_worlds_leading" };
+        // Bitcoin Testnet and Liquid Testnet
+        inline constexpr std::string_view id_bitcoin_testnet_and_liquid{ "id_bitcoin_testnet_and_liquid" };
+        inline constexpr std::string_view id_bitcoin_wallet{ "id_bitcoin_wallet" }; // Bitcoin wallet.
+        inline constexpr std::string_view id_bitcoin_wallets{ "id_bitcoin_wallets" }; // Bitcoin wallets
+        inline constexpr std::string_view id_block{ "id_block" }; // block
+        inline constexpr std::string_view id_block_d{ "id_block_d" }; // Block %d
+        inline constexpr std::string_view id_block_height{ "id_block_height" }; // Block Height
+        inline constexpr std::string_view id_block_height_1d{ "id_block_height_1d" }; // Block height: %1$d
+        inline constexpr std::string_view id_blocks{ "id_blocks" }; // blocks
+        inline constexpr std::string_view id_blocks_confirmed{ "id_blocks_confirmed" }; // blocks confirmed
+        inline constexpr std::string_view id_blockstream_devices{ "id_blockstream_devices" }; // Blockstream Devices
+        // Blockstream does not have access to your wallet backup and will not be able to help you in case you lose it
+        inline constexpr std::string_view id_blockstream_does_not_have{ "id_blockstream_does_not_have" };
+        // Blockstream Green needs access to Bluetooth in order to connect to hardware wallets. Location data is not
+        // used or kept by Blockstream.
+        inline constexpr std::string_view id_blockstream_green_needs_access{ "id_blockstream_green_needs_access" };
+        // Blockstream Green supports both Bitcoin and the Liquid Network.
+        inline constexpr std::string_view id_blockstream_green_supports_both{ "id_blockstream_green_supports_both" };
+        // Blockstream Green:\nSimple and Secure
+        inline constexpr std::string_view id_blockstream_greennsimple_and{ "id_blockstream_greennsimple_and" };
+        inline constexpr std::string_view id_blockstream_store{ "id_blockstream_store" }; // Blockstream Store
+        inline constexpr std::string_view id_bluetooth{ "id_bluetooth" }; // Bluetooth
+        // BTChip is not set up. Please set it up using a desktop client to be able to use it.
+        inline constexpr std::string_view id_btchip_is_not_set_up_please_set{ "id_btchip_is_not_set_up_please_set" };
+        // By proceeding to the next steps you agree to the %s
+        inline constexpr std::string_view id_by_proceeding_to_the_next_steps{ "id_by_proceeding_to_the_next_steps" };
+        inline constexpr std::string_view id_cable{ "id_cable" }; // Cable
+        inline constexpr std::string_view id_call{ "id_call" }; // Call
+        inline constexpr std::string_view id_camera_problem{ "id_camera_problem" }; // Camera problem
+        inline constexpr std::string_view id_cancel{ "id_cancel" }; // Cancel
+        inline constexpr std::string_view id_cancel_2fa_reset{ "id_cancel_2fa_reset" }; // Cancel 2FA reset
+        // Cancel a reset to unlock your wallet if you recovered access to an old Two-Factor Authentication method.
+        inline constexpr std::string_view id_cancel_a_reset_to_unlock_your{ "id_cancel_a_reset_to_unlock_your" };
+        // Cancel Two-Factor reset
+        inline constexpr std::string_view id_cancel_twofactor_reset{ "id_cancel_twofactor_reset" };
+        // Cannot remove enabled network, please disable it first
+        inline constexpr std::string_view id_cannot_remove_enabled_network{ "id_cannot_remove_enabled_network" };
+        // Can\'t connect to this URL
+        inline constexpr std::string_view id_cant_connect_to_this_url{ "id_cant_connect_to_this_url" };
+        inline constexpr std::string_view id_change{ "id_change" }; // Change
+        inline constexpr std::string_view id_change_address{ "id_change_address" }; // Change address
+        inline constexpr std::string_view id_change_pin{ "id_change_pin" }; // Change PIN
+        inline constexpr std::string_view id_change_speed{ "id_change_speed" }; // Change speed
+        // Changing reference exchange rate will reset your 2FA threshold to 0. Remember to adjust the 2FA threshold
+        // after spending.
+        inline constexpr std::string_view id_changing_reference_exchange{ "id_changing_reference_exchange" };
+        // Channel closure initiated. You can sweep your funds after the transaction is confirmed
+        inline constexpr std::string_view id_channel_closure_initiated_you{ "id_channel_closure_initiated_you" };
+        // Cheaper and more private singlesig option. Addresses are Bech32m.
+        inline constexpr std::string_view id_cheaper_and_more_private{ "id_cheaper_and_more_private" };
+        // Cheaper singlesig option. Addresses are Native SegWit Bech32.
+        inline constexpr std::string_view id_cheaper_singlesig_option{ "id_cheaper_singlesig_option" };
+        inline constexpr std::string_view id_check_device{ "id_check_device" }; // Check Device
+        inline constexpr std::string_view id_check_for_updates{ "id_check_for_updates" }; // Check for updates
+        // Check for updates on startup
+        inline constexpr std::string_view id_check_for_updates_on_startup{ "id_check_for_updates_on_startup" };
+        // Check our 6 easy steps to be able to send and receive AMP assets.
+        inline constexpr std::string_view id_check_our_6_easy_steps_to_be{ "id_check_our_6_easy_steps_to_be" };
+        inline constexpr std::string_view id_check_your_backup{ "id_check_your_backup" }; // Check your backup
+        inline constexpr std::string_view id_check_your_device{ "id_check_your_device" }; // Check your device
+        inline constexpr std::string_view id_choose{ "id_choose" }; // Choose
+        // Choose a name for your new Blockstream Green wallet.
+        inline constexpr std::string_view id_choose_a_name_for_your_new{ "id_choose_a_name_for_your_new" };
+        // Choose a name for your wallet
+        inline constexpr std::string_view id_choose_a_name_for_your_wallet{ "id_choose_a_name_for_your_wallet" };
+        inline constexpr std::string_view id_choose_a_swap_option{ "id_choose_a_swap_option" }; // Choose a Swap Option
+        // Choose a USB or Bluetooth connection on Jade after verifying your recovery phrase
+        inline constexpr std::string_view id_choose_a_usb_or_bluetooth{ "id_choose_a_usb_or_bluetooth" };
+        // Choose Bluetooth connection on Jade after verifying your recovery phrase
+        inline constexpr std::string_view id_choose_bluetooth_connection_on{ "id_choose_bluetooth_connection_on" };
+        // Choose method to authorize the action
+        inline constexpr std::string_view id_choose_method_to_authorize_the{ "id_choose_method_to_authorize_the" };
+        // Choose recovery phrase length
+        inline constexpr std::string_view id_choose_recovery_phrase_length{ "id_choose_recovery_phrase_length" };
+        // Choose Security Policy
+        inline constexpr std::string_view id_choose_security_policy{ "id_choose_security_policy" };
+        // Choose the Electrum servers you trust
+        inline constexpr std::string_view id_choose_the_electrum_servers_you{ "id_choose_the_electrum_servers_you" };
+        // Choose the security policy that matches your wallet.
+        inline constexpr std::string_view id_choose_the_security_policy_that{ "id_choose_the_security_policy_that" };
+        // Choose the security policy you want to restore this wallet on.
+        inline constexpr std::string_view id_choose_the_security_policy_you{ "id_choose_the_security_policy_you" };
+        // Choose this version to connect to your Blockstream Jade with both a usb cable and wireless
+        inline constexpr std::string_view id_choose_this_version_to_connect{ "id_choose_this_version_to_connect" };
+        // Choose this version to disable all radio connections on your Blockstream Jade. This will make your
+        // Blockstream Jade incompatible with iOS devices
+        inline constexpr std::string_view id_choose_this_version_to_disable{ "id_choose_this_version_to_disable" };
+        // Choose Two-Factor authentication method
+        inline constexpr std::string_view id_choose_twofactor_authentication{ "id_choose_twofactor_authentication" };
+        inline constexpr std::string_view id_choose_watchonly{ "id_choose_watchonly" }; // Choose Watch-Only
+        inline constexpr std::string_view id_choose_your_network{ "id_choose_your_network" }; // Choose Your Network
+        inline constexpr std::string_view id_clear{ "id_clear" }; // Clear
+        inline constexpr std::string_view id_clear_cache{ "id_clear_cache" }; // Clear cache
+        inline constexpr std::string_view id_click_to_copy{ "id_click_to_copy" }; // Click to copy
+        // Click to receive an email with your encrypted recovery data.
+        inline constexpr std::string_view id_click_to_receive_an_email_with{ "id_click_to_receive_an_email_with" };
+        inline constexpr std::string_view id_close{ "id_close" }; // Close
+        inline constexpr std::string_view id_close_channel{ "id_close_channel" }; // Close Channel
+        inline constexpr std::string_view id_code{ "id_code" }; // Code
+        inline constexpr std::string_view id_coin{ "id_coin" }; // Coin
+        inline constexpr std::string_view id_coins{ "id_coins" }; // Coins
+        // Coins for which 2FA protection is expired.
+        inline constexpr std::string_view id_coins_for_which_2fa_protection{ "id_coins_for_which_2fa_protection" };
+        inline constexpr std::string_view id_coins_locked{ "id_coins_locked" }; // Coins locked
+        // Coins protected by the legacy script recoverable with your nlocktimes.zip file.
+        inline constexpr std::string_view id_coins_protected_by_the_legacy{ "id_coins_protected_by_the_legacy" };
+        // Coins protected by the new script with embedded 2FA expiry through CheckSequenceVerify.
+        inline constexpr std::string_view id_coins_protected_by_the_new{ "id_coins_protected_by_the_new" };
+        // Coins received or created before SegWit was activated.
+        inline constexpr std::string_view id_coins_received_or_created{ "id_coins_received_or_created" };
+        inline constexpr std::string_view id_coins_unlocked{ "id_coins_unlocked" }; // Coins unlocked
+        // Coins whose asset and amount are publicly visible.
+        inline constexpr std::string_view id_coins_whose_asset_and_amount{ "id_coins_whose_asset_and_amount" };
+        // Coins with a value lower than 1092 satoshis that are uneconomic to spend; these coins can be generated by
+        // your wallet as change or sent to you by third parties trying to spam or deanonymize your wallet.
+        inline constexpr std::string_view id_coins_with_a_value_lower_than{ "id_coins_with_a_value_lower_than" };
+        inline constexpr std::string_view id_collapse_sidebar{ "id_collapse_sidebar" }; // Collapse sidebar
+        inline constexpr std::string_view id_coming_soon{ "id_coming_soon" }; // Coming Soon!
+        // Communication timed out. Make sure the device is powered on and try again.
+        inline constexpr std::string_view id_communication_timed_out_make{ "id_communication_timed_out_make" };
+        inline constexpr std::string_view id_completed{ "id_completed" }; // Completed
+        inline constexpr std::string_view id_confidential{ "id_confidential" }; // Confidential
+        // Confidential Transaction
+        inline constexpr std::string_view id_confidential_transaction{ "id_confidential_transaction" };
+        inline constexpr std::string_view id_confirm{ "id_confirm" }; // Confirm
+        inline constexpr std::string_view id_confirm_action{ "id_confirm_action" }; // Confirm action
+        // Confirm by typing the wallet name
+        inline constexpr std::string_view id_confirm_by_typing_the_wallet{ "id_confirm_by_typing_the_wallet" };
+        inline constexpr std::string_view id_confirm_code{ "id_confirm_code" }; // Confirm Code
+        // Confirm Coin Selection
+        inline constexpr std::string_view id_confirm_coin_selection{ "id_confirm_coin_selection" };
+        // Confirm on your device
+        inline constexpr std::string_view id_confirm_on_your_device{ "id_confirm_on_your_device" };
+        inline constexpr std::string_view id_confirm_passphrase{ "id_confirm_passphrase" }; // Confirm passphrase
+        inline constexpr std::string_view id_confirm_refund{ "id_confirm_refund" }; // Confirm Refund
+        inline constexpr std::string_view id_confirm_swap{ "id_confirm_swap" }; // Confirm swap
+        inline constexpr std::string_view id_confirm_transaction{ "id_confirm_transaction" }; // Confirm transaction
+        // Confirm transaction details on your hardware wallet
+        inline constexpr std::string_view id_confirm_transaction_details_on{ "id_confirm_transaction_details_on" };
+        // Confirm update on your Jade
+        inline constexpr std::string_view id_confirm_update_on_your_jade{ "id_confirm_update_on_your_jade" };
+        // Confirm version on Jade
+        inline constexpr std::string_view id_confirm_version_on_jade{ "id_confirm_version_on_jade" };
+        // Confirm via 2FA that you authorize this change.
+        inline constexpr std::string_view id_confirm_via_2fa_that_you{ "id_confirm_via_2fa_that_you" };
+        inline constexpr std::string_view id_confirm_your_new_pin{ "id_confirm_your_new_pin" }; // Confirm your new PIN
+        // Confirmation in %d blocks
+        inline constexpr std::string_view id_confirmation_in_d_blocks{ "id_confirmation_in_d_blocks" };
+        inline constexpr std::string_view id_confirmation_time{ "id_confirmation_time" }; // Confirmation Time
+        inline constexpr std::string_view id_confirmations{ "id_confirmations" }; // Confirmations
+        // Confirming your transaction
+        inline constexpr std::string_view id_confirming_your_transaction{ "id_confirming_your_transaction" };
+        inline constexpr std::string_view id_congratulations{ "id_congratulations" }; // Congratulations!
+        // Connect a different Hardware Device
+        inline constexpr std::string_view id_connect_a_different_hardware{ "id_connect_a_different_hardware" };
+        // Connect hardware wallet
+        inline constexpr std::string_view id_connect_hardware_wallet{ "id_connect_hardware_wallet" };
+        inline constexpr std::string_view id_connect_jade{ "id_connect_jade" }; // Connect Jade
+        // Connect Jade with a USB cable to download the latest firmware update
+        inline constexpr std::string_view id_connect_jade_with_a_usb_cable{ "id_connect_jade_with_a_usb_cable" };
+        // Connect through a proxy
+        inline constexpr std::string_view id_connect_through_a_proxy{ "id_connect_through_a_proxy" };
+        // Connect USB cable or enable Bluetooth
+        inline constexpr std::string_view id_connect_usb_cable_or_enable{ "id_connect_usb_cable_or_enable" };
+        // Connect using USB or Bluetooth
+        inline constexpr std::string_view id_connect_using_usb_or_bluetooth{ "id_connect_using_usb_or_bluetooth" };
+        // Connect with Bluetooth
+        inline constexpr std::string_view id_connect_with_bluetooth{ "id_connect_with_bluetooth" };
+        inline constexpr std::string_view id_connect_with_tor{ "id_connect_with_tor" }; // Connect with Tor
+        // Connect your Jade to use it with Green
+        inline constexpr std::string_view id_connect_your_jade_to_use_it{ "id_connect_your_jade_to_use_it" };
+        // Connect your Ledger to use it in Green
+        inline constexpr std::string_view id_connect_your_ledger_to_use_it{ "id_connect_your_ledger_to_use_it" };
+        inline constexpr std::string_view id_connected_to_jade{ "id_connected_to_jade" }; // Connected to Jade
+        inline constexpr std::string_view id_connected_wallets{ "id_connected_wallets" }; // Connected wallets
+        inline constexpr std::string_view id_connecting{ "id_connecting" }; // Connecting…
+        // Connecting through Tor
+        inline constexpr std::string_view id_connecting_through_tor{ "id_connecting_through_tor" };
+        // Connecting to a trusted node through Tor requires enabling proxy settings in the app before logging in and a
+        // Socks5 proxy (Orbot app for Android)
+        inline constexpr std::string_view id_connecting_to_a_trusted_node{ "id_connecting_to_a_trusted_node" };
+        inline constexpr std::string_view id_connecting_to_peers{ "id_connecting_to_peers" }; // Connecting to peers...
+        // Connecting to Tor (.onion) nodes allows maximum privacy and security. Press "OK" to continue.
+        inline constexpr std::string_view id_connecting_to_tor_onion_nodes{ "id_connecting_to_tor_onion_nodes" };
+        // Connecting to your device
+        inline constexpr std::string_view id_connecting_to_your_device{ "id_connecting_to_your_device" };
+        inline constexpr std::string_view id_connection{ "id_connection" }; // Connection
+        inline constexpr std::string_view id_connection_failed{ "id_connection_failed" }; // Connection failed
+        // Connection to device failed! Move closer to the device and try again.
+        inline constexpr std::string_view id_connection_to_device_failed{ "id_connection_to_device_failed" };
+        // Contact support at %s or visit %s
+        inline constexpr std::string_view id_contact_support_at_s_or_visit_s{ "id_contact_support_at_s_or_visit_s" };
+        inline constexpr std::string_view id_continue{ "id_continue" }; // Continue
+        inline constexpr std::string_view id_continue_with_1s{ "id_continue_with_1s" }; // Continue with %1$s
+        inline constexpr std::string_view id_copied_to_clipboard{ "id_copied_to_clipboard" }; // Copied to clipboard
+        inline constexpr std::string_view id_copy{ "id_copy" }; // Copy
+        inline constexpr std::string_view id_copy_address{ "id_copy_address" }; // Copy address
+        inline constexpr std::string_view id_copy_details{ "id_copy_details" }; // Copy details
+        inline constexpr std::string_view id_copy_device_id{ "id_copy_device_id" }; // Copy Device ID
+        inline constexpr std::string_view id_copy_id{ "id_copy_id" }; // Copy ID
+        inline constexpr std::string_view id_copy_raw_transaction{ "id_copy_raw_transaction" }; // Copy raw transaction
+        inline constexpr std::string_view id_copy_support_id{ "id_copy_support_id" }; // Copy support ID
+        inline constexpr std::string_view id_copy_swap_proposal{ "id_copy_swap_proposal" }; // Copy Swap Proposal
+        inline constexpr std::string_view id_copy_to_clipboard{ "id_copy_to_clipboard" }; // Copy To Clipboard
+        inline constexpr std::string_view id_copy_transaction_id{ "id_copy_transaction_id" }; // Copy transaction ID
+        inline constexpr std::string_view id_copy_unblinded_link{ "id_copy_unblinded_link" }; // Copy unblinded link
+        inline constexpr std::string_view id_copy_unblinding_data{ "id_copy_unblinding_data" }; // Copy unblinding data
+        inline constexpr std::string_view id_copy_uri{ "id_copy_uri" }; // Copy URI
+        inline constexpr std::string_view id_copy_xpub{ "id_copy_xpub" }; // Copy xpub
+        inline constexpr std::string_view id_correct_order{ "id_correct_order" }; // correct order
+        // Could not recognized QR code
+        inline constexpr std::string_view id_could_not_recognized_qr_code{ "id_could_not_recognized_qr_code" };
+        inline constexpr std::string_view id_country{ "id_country" }; // Country
+        inline constexpr std::string_view id_create{ "id_create" }; // Create
+        // Create a New Proposal
+        inline constexpr std::string_view id_create_a_new_proposal{ "id_create_a_new_proposal" };
+        inline constexpr std::string_view id_create_a_new_swap{ "id_create_a_new_swap" }; // Create a New Swap
+        inline constexpr std::string_view id_create_a_pin{ "id_create_a_pin" }; // Create a PIN
+        // Create a PIN to access your wallet
+        inline constexpr std::string_view id_create_a_pin_to_access_your{ "id_create_a_pin_to_access_your" };
+        // Create a wallet for Bitcoin, Liquid or Testnet
+        inline constexpr std::string_view id_create_a_wallet_for_bitcoin{ "id_create_a_wallet_for_bitcoin" };
+        inline constexpr std::string_view id_create_account{ "id_create_account" }; // Create Account
+        inline constexpr std::string_view id_create_invoice{ "id_create_invoice" }; // Create Invoice
+        inline constexpr std::string_view id_create_new_account{ "id_create_new_account" }; // Create New Account
+        inline constexpr std::string_view id_create_new_wallet{ "id_create_new_wallet" }; // Create New Wallet
+        // Create temporary wallet
+        inline constexpr std::string_view id_create_temporary_wallet{ "id_create_temporary_wallet" };
+        inline constexpr std::string_view id_create_wallet{ "id_create_wallet" }; // Create Wallet
+        // Create your first account to receive funds.
+        inline constexpr std::string_view id_create_your_first_account_to{ "id_create_your_first_account_to" };
+        inline constexpr std::string_view id_creating_wallet{ "id_creating_wallet" }; // Creating wallet…
+        // Creating your %s account...
+        inline constexpr std::string_view id_creating_your_s_account{ "id_creating_your_s_account" };
+        inline constexpr std::string_view id_csv{ "id_csv" }; // Csv
+        inline constexpr std::string_view id_currency{ "id_currency" }; // Currency
+        inline constexpr std::string_view id_current_version{ "id_current_version" }; // Current version
+        inline constexpr std::string_view id_custom{ "id_custom" }; // Custom
+        // Custom network added, enable it in the network settings
+        inline constexpr std::string_view id_custom_network_added_enable_it{ "id_custom_network_added_enable_it" };
+        // Custom network not found
+        inline constexpr std::string_view id_custom_network_not_found{ "id_custom_network_not_found" };
+        // Custom network with this name already present
+        inline constexpr std::string_view id_custom_network_with_this_name{ "id_custom_network_with_this_name" };
+        // Custom servers and validation
+        inline constexpr std::string_view id_custom_servers_and_validation{ "id_custom_servers_and_validation" };
+        // Customize 2FA expiration of your coins
+        inline constexpr std::string_view id_customize_2fa_expiration_of{ "id_customize_2fa_expiration_of" };
+        inline constexpr std::string_view id_d6_confirmations{ "id_d6_confirmations" }; // %d/6 confirmations
+        // %d asset in this account
+        inline constexpr std::string_view id_d_asset_in_this_account{ "id_d_asset_in_this_account" };
+        inline constexpr std::string_view id_d_assets{ "id_d_assets" }; // %d assets
+        // %d assets in this account
+        inline constexpr std::string_view id_d_assets_in_this_account{ "id_d_assets_in_this_account" };
+        inline constexpr std::string_view id_d_assets_in_total{ "id_d_assets_in_total" }; // %d assets in total
+        inline constexpr std::string_view id_d_coins_selected{ "id_d_coins_selected" }; // (%d coins selected)
+        inline constexpr std::string_view id_d_words{ "id_d_words" }; // %d words
+        inline constexpr std::string_view id_data_directory{ "id_data_directory" }; // Data directory
+        inline constexpr std::string_view id_date{ "id_date" }; // Date
+        inline constexpr std::string_view id_day{ "id_day" }; // day
+        inline constexpr std::string_view id_days{ "id_days" }; // days
+        inline constexpr std::string_view id_days_remaining_s{ "id_days_remaining_s" }; // Days remaining: %s
+        // Default custom fee rate
+        inline constexpr std::string_view id_default_custom_fee_rate{ "id_default_custom_fee_rate" };
+        // Default transaction priority
+        inline constexpr std::string_view id_default_transaction_priority{ "id_default_transaction_priority" };
+        inline constexpr std::string_view id_delete{ "id_delete" }; // Delete
+        inline constexpr std::string_view id_delete_credentials{ "id_delete_credentials" }; // Delete credentials
+        // Delete permanently your wallet from the Blockstream Green database. You will never be able to log in to it
+        // thereafter.
+        inline constexpr std::string_view id_delete_permanently_your_wallet{ "id_delete_permanently_your_wallet" };
+        inline constexpr std::string_view id_delete_s_twofactor{ "id_delete_s_twofactor" }; // Delete %s Two-Factor
+        inline constexpr std::string_view id_delete_wallet{ "id_delete_wallet" }; // Delete Wallet
+        // Deleting your PIN will remove wallet access permanently unless you have your mnemonic available. Press "OK"
+        // to continue.
+        inline constexpr std::string_view id_deleting_your_pin_will_remove{ "id_deleting_your_pin_will_remove" };
+        inline constexpr std::string_view id_denomination{ "id_denomination" }; // Denomination
+        // Denomination & Exchange Rate
+        inline constexpr std::string_view id_denomination__exchange_rate{ "id_denomination__exchange_rate" };
+        inline constexpr std::string_view id_deposit{ "id_deposit" }; // Deposit
+        inline constexpr std::string_view id_description{ "id_description" }; // Description
+        inline constexpr std::string_view id_descriptor{ "id_descriptor" }; // Descriptor
+        inline constexpr std::string_view id_details{ "id_details" }; // Details
+        inline constexpr std::string_view id_device{ "id_device" }; // Device
+        inline constexpr std::string_view id_devices{ "id_devices" }; // Devices
+        // Different passphrases generate new wallets!\n\nRemember you can only restore this wallet with both your
+        // recovery phrase and the passphrase.
+        inline constexpr std::string_view id_different_passphrases_generate{ "id_different_passphrases_generate" };
+        inline constexpr std::string_view id_digital_wallets{ "id_digital_wallets" }; // Digital Wallets
+        inline constexpr std::string_view id_disable{ "id_disable" }; // Disable
+        // Disable Authenticator
+        inline constexpr std::string_view id_disable_authenticator{ "id_disable_authenticator" };
+        inline constexpr std::string_view id_disable_pin_access{ "id_disable_pin_access" }; // Disable PIN access
+        // Disable PIN access for this wallet on all devices
+        inline constexpr std::string_view id_disable_pin_access_for_this{ "id_disable_pin_access_for_this" };
+        // Disable %s Two-Factor Authentication
+        inline constexpr std::string_view id_disable_s_twofactor{ "id_disable_s_twofactor" };
+        inline constexpr std::string_view id_disabled{ "id_disabled" }; // Disabled
+        inline constexpr std::string_view id_disconnect{ "id_disconnect" }; // Disconnect
+        // Display values in %s and exchange rate in %s using %s
+        inline constexpr std::string_view id_display_values_in_s_and{ "id_display_values_in_s_and" };
+        // Displays the progress of SPV synchronization
+        inline constexpr std::string_view id_displays_the_progress_of_spv{ "id_displays_the_progress_of_spv" };
+        // Dispute Two-Factor reset
+        inline constexpr std::string_view id_dispute_twofactor_reset{ "id_dispute_twofactor_reset" };
+        inline constexpr std::string_view id_disputed{ "id_disputed" }; // Disputed
+        // Distributed under the %s, see LICENSE for more information or visit %s
+        inline constexpr std::string_view id_distributed_under_the_s_see{ "id_distributed_under_the_s_see" };
+        // Do you have the backup?
+        inline constexpr std::string_view id_do_you_have_the_backup{ "id_do_you_have_the_backup" };
+        inline constexpr std::string_view id_domain{ "id_domain" }; // Domain
+        inline constexpr std::string_view id_done{ "id_done" }; // Done
+        inline constexpr std::string_view id_dont_ask_me_again{ "id_dont_ask_me_again" }; // Don\'t ask me again
+        inline constexpr std::string_view id_dont_collect_data{ "id_dont_collect_data" }; // Don\'t collect data
+        // Don’t have a Jade? Check our store
+        inline constexpr std::string_view id_dont_have_a_jade_check_our_store{ "id_dont_have_a_jade_check_our_store" };
+        // Don\'t show this again
+        inline constexpr std::string_view id_dont_show_this_again{ "id_dont_show_this_again" };
+        // Don\'t store your recovery phrase on your phone, computer, or any online services.
+        inline constexpr std::string_view id_dont_store_your_recovery_phrase{ "id_dont_store_your_recovery_phrase" };
+        // Don\'t take screenshots of your recovery phrase!
+        inline constexpr std::string_view id_dont_take_screenshots_of_your{ "id_dont_take_screenshots_of_your" };
+        // Double check SPV with other servers
+        inline constexpr std::string_view id_double_check_spv_with_other{ "id_double_check_spv_with_other" };
+        inline constexpr std::string_view id_double_spend{ "id_double_spend" }; // double spend
+        inline constexpr std::string_view id_double_spend_by{ "id_double_spend_by" }; // Double spend by
+        inline constexpr std::string_view id_download_finished{ "id_download_finished" }; // Download finished
+        inline constexpr std::string_view id_dust{ "id_dust" }; // Dust
+        inline constexpr std::string_view id_edit{ "id_edit" }; // Edit
+        inline constexpr std::string_view id_edit_fee{ "id_edit_fee" }; // Edit Fee
+        inline constexpr std::string_view id_email{ "id_email" }; // Email
+        inline constexpr std::string_view id_email_address{ "id_email_address" }; // email address
+        // Emergency Recovery Phrase Restore
+        inline constexpr std::string_view id_emergency_recovery_phrase{ "id_emergency_recovery_phrase" };
+        inline constexpr std::string_view id_empty{ "id_empty" }; // Empty
+        inline constexpr std::string_view id_enable{ "id_enable" }; // Enable
+        inline constexpr std::string_view id_enable_2fa{ "id_enable_2fa" }; // Enable 2FA
+        inline constexpr std::string_view id_enable_bluetooth{ "id_enable_bluetooth" }; // Enable Bluetooth
+        // Enable bluetooth from system settings
+        inline constexpr std::string_view id_enable_bluetooth_from_system{ "id_enable_bluetooth_from_system" };
+        // Enable custom networks debug options
+        inline constexpr std::string_view id_enable_custom_networks_debug{ "id_enable_custom_networks_debug" };
+        // Enable email notifications to change nlocktime
+        inline constexpr std::string_view id_enable_email_notifications_to{ "id_enable_email_notifications_to" };
+        // Enable experimental features
+        inline constexpr std::string_view id_enable_experimental_features{ "id_enable_experimental_features" };
+        inline constexpr std::string_view id_enable_face_id{ "id_enable_face_id" }; // Enable Face ID
+        // Enable limited usage data collection
+        inline constexpr std::string_view id_enable_limited_usage_data{ "id_enable_limited_usage_data" };
+        // Enable location services
+        inline constexpr std::string_view id_enable_location_services{ "id_enable_location_services" };
+        // Enable or change your PIN to quickly access your wallet
+        inline constexpr std::string_view id_enable_or_change_your_pin_to{ "id_enable_or_change_your_pin_to" };
+        inline constexpr std::string_view id_enable_spv{ "id_enable_spv" }; // Enable SPV
+        // Enable SPV and modify SPV settings
+        inline constexpr std::string_view id_enable_spv_and_modify_spv{ "id_enable_spv_and_modify_spv" };
+        inline constexpr std::string_view id_enable_testnet{ "id_enable_testnet" }; // Enable testnet
+        // Enable testnet in app settings to use Jade
+        inline constexpr std::string_view id_enable_testnet_in_app_settings{ "id_enable_testnet_in_app_settings" };
+        inline constexpr std::string_view id_enable_touch_id{ "id_enable_touch_id" }; // Enable Touch ID
+        // Enable Two-Factor Authentication to protect your wallet from unauthorized transactions or changes to critical
+        // security settings
+        inline constexpr std::string_view id_enable_twofactor_authentication{ "id_enable_twofactor_authentication" };
+        inline constexpr std::string_view id_enabled{ "id_enabled" }; // Enabled
+        inline constexpr std::string_view id_enabled_1s{ "id_enabled_1s" }; // Enabled: %1$s
+        // Encryption passphrase
+        inline constexpr std::string_view id_encryption_passphrase{ "id_encryption_passphrase" };
+        inline constexpr std::string_view id_enhance_security{ "id_enhance_security" }; // Enhance Security
+        inline constexpr std::string_view id_enhanced_privacy{ "id_enhanced_privacy" }; // Enhanced Privacy
+        inline constexpr std::string_view id_enter{ "id_enter" }; // Enter
+        // Enter a PGP public key to have emails encrypted for better privacy.
+        inline constexpr std::string_view id_enter_a_pgp_public_key_to_have{ "id_enter_a_pgp_public_key_to_have" };
+        // Enter a private key to sweep into this wallet
+        inline constexpr std::string_view id_enter_a_private_key_to_sweep{ "id_enter_a_private_key_to_sweep" };
+        // Enter a valid .onion or IP address (.onion preferred)
+        inline constexpr std::string_view id_enter_a_valid_onion_or_ip{ "id_enter_a_valid_onion_or_ip" };
+        // Enter a valid username
+        inline constexpr std::string_view id_enter_a_valid_username{ "id_enter_a_valid_username" };
+        inline constexpr std::string_view id_enter_amount_in{ "id_enter_amount_in" }; // Enter amount in
+        inline constexpr std::string_view id_enter_an_address{ "id_enter_an_address" }; // Enter an address
+        // Enter an address or sweep paper wallet
+        inline constexpr std::string_view id_enter_an_address_or_sweep_paper{ "id_enter_an_address_or_sweep_paper" };
+        // Enter and confirm a unique PIN that will be entered to unlock Jade.
+        inline constexpr std::string_view id_enter_and_confirm_a_unique_pin{ "id_enter_and_confirm_a_unique_pin" };
+        inline constexpr std::string_view id_enter_new_email{ "id_enter_new_email" }; // Enter new email
+        inline constexpr std::string_view id_enter_phone_number{ "id_enter_phone_number" }; // Enter phone number
+        inline constexpr std::string_view id_enter_pin{ "id_enter_pin" }; // Enter PIN
+        inline constexpr std::string_view id_enter_pin_on_jade{ "id_enter_pin_on_jade" }; // Enter PIN on Jade
+        // Enter the email for which you want to delete a dispute request
+        inline constexpr std::string_view id_enter_the_email_for_which_you{ "id_enter_the_email_for_which_you" };
+        // Enter The Matching Words
+        inline constexpr std::string_view id_enter_the_matching_words{ "id_enter_the_matching_words" };
+        // Enter the PIN for your hardware wallet
+        inline constexpr std::string_view id_enter_the_pin_for_your_hardware{ "id_enter_the_pin_for_your_hardware" };
+        // Enter your 12, 24 or 27 words recovery phrase
+        inline constexpr std::string_view id_enter_your_12_24_or_27_words{ "id_enter_your_12_24_or_27_words" };
+        // Enter your 24 or 27 words recovery phrase
+        inline constexpr std::string_view id_enter_your_24_or_27_words{ "id_enter_your_24_or_27_words" };
+        // Enter your 27 words recovery phrase
+        inline constexpr std::string_view id_enter_your_27_words_recovery{ "id_enter_your_27_words_recovery" };
+        // Enter your 6-digit PIN to Access your Wallet
+        inline constexpr std::string_view id_enter_your_6digit_pin_to_access{ "id_enter_your_6digit_pin_to_access" };
+        // Enter your email address
+        inline constexpr std::string_view id_enter_your_email_address{ "id_enter_your_email_address" };
+        inline constexpr std::string_view id_enter_your_pin{ "id_enter_your_pin" }; // Enter Your PIN
+        // Enter your recovery phrase
+        inline constexpr std::string_view id_enter_your_recovery_phrase{ "id_enter_your_recovery_phrase" };
+        // Enter your %s wallet mnemonic
+        inline constexpr std::string_view id_enter_your_s_wallet_mnemonic{ "id_enter_your_s_wallet_mnemonic" };
+        // Enter your wallet mnemonic
+        inline constexpr std::string_view id_enter_your_wallet_mnemonic{ "id_enter_your_wallet_mnemonic" };
+        inline constexpr std::string_view id_enter_your_xpub{ "id_enter_your_xpub" }; // Enter your xpub
+        // Enter your xPub to add a watch-only wallet where you can receive funds and check your balance without
+        // importing your private keys.
+        inline constexpr std::string_view id_enter_your_xpub_to_add_a{ "id_enter_your_xpub_to_add_a" };
+        // Enter your\nRecovery Phrase
+        inline constexpr std::string_view id_enter_yournrecovery_phrase{ "id_enter_yournrecovery_phrase" };
+        inline constexpr std::string_view id_entity{ "id_entity" }; // Entity
+        inline constexpr std::string_view id_ephemeral_wallets{ "id_ephemeral_wallets" }; // Ephemeral wallets
+        inline constexpr std::string_view id_error{ "id_error" }; // Error
+        // Error logging in with Hardware Wallet
+        inline constexpr std::string_view id_error_logging_in_with_hardware{ "id_error_logging_in_with_hardware" };
+        // Error: NFC tag not writable
+        inline constexpr std::string_view id_error_nfc_tag_not_writable{ "id_error_nfc_tag_not_writable" };
+        // Error: NFC tag too small
+        inline constexpr std::string_view id_error_nfc_tag_too_small{ "id_error_nfc_tag_too_small" };
+        // Error: passphrases do not match
+        inline constexpr std::string_view id_error_passphrases_do_not_match{ "id_error_passphrases_do_not_match" };
+        // Error setting Fee Rate
+        inline constexpr std::string_view id_error_setting_fee_rate{ "id_error_setting_fee_rate" };
+        inline constexpr std::string_view id_establishing_session{ "id_establishing_session" }; // Establishing session
+        // Estimated blocks until confirmation: %d
+        inline constexpr std::string_view id_estimated_blocks_until{ "id_estimated_blocks_until" };
+        // Everything you need to take control of your bitcoin.
+        inline constexpr std::string_view id_everything_you_need_to_take{ "id_everything_you_need_to_take" };
+        // Example: 8.90.14.2:8333,40.116.12.85:8333
+        inline constexpr std::string_view id_example_89014283334011612858333{ "id_example_89014283334011612858333" };
+        inline constexpr std::string_view id_exchange_rate{ "id_exchange_rate" }; // Exchange Rate
+        // Existing recovery phrase
+        inline constexpr std::string_view id_existing_recovery_phrase{ "id_existing_recovery_phrase" };
+        inline constexpr std::string_view id_existing_wallets{ "id_existing_wallets" }; // Existing Wallets
+        inline constexpr std::string_view id_exit_guide{ "id_exit_guide" }; // Exit Guide
+        inline constexpr std::string_view id_expand_sidebar{ "id_expand_sidebar" }; // Expand sidebar
+        inline constexpr std::string_view id_experimental{ "id_experimental" }; // Experimental
+        inline constexpr std::string_view id_experimental_feature{ "id_experimental_feature" }; // Experimental Feature
+        // Experimental features might change, break, or be discontinued at any time, so you agree to use them at your
+        // own risk.
+        inline constexpr std::string_view id_experimental_features_might{ "id_experimental_features_might" };
+        inline constexpr std::string_view id_expiration{ "id_expiration" }; // Expiration
+        inline constexpr std::string_view id_explore_your_wallet{ "id_explore_your_wallet" }; // Explore Your Wallet
+        inline constexpr std::string_view id_export{ "id_export" }; // Export
+        // Export transactions to CSV file
+        inline constexpr std::string_view id_export_transactions_to_csv_file{ "id_export_transactions_to_csv_file" };
+        // Exports an account\'s extended public key (xPub/yPub/zPub) to view as a watch-only
+        inline constexpr std::string_view id_exports_an_accounts_extended{ "id_exports_an_accounts_extended" };
+        inline constexpr std::string_view id_extended_public_key{ "id_extended_public_key" }; // Extended Public Key
+        inline constexpr std::string_view id_extended_public_keys{ "id_extended_public_keys" }; // Extended Public Keys
+        inline constexpr std::string_view id_face_id{ "id_face_id" }; // Face ID
+        // Failed to load asset icons
+        inline constexpr std::string_view id_failed_to_load_asset_icons{ "id_failed_to_load_asset_icons" };
+        // Failed to Load Asset Registry
+        inline constexpr std::string_view id_failed_to_load_asset_registry{ "id_failed_to_load_asset_registry" };
+        inline constexpr std::string_view id_fast{ "id_fast" }; // Fast
+        // Fast transactions on the Lightning Network, powered by Greenlight.
+        inline constexpr std::string_view id_fast_transactions_on_the{ "id_fast_transactions_on_the" };
+        // Faster, more confidential Bitcoin transactions
+        inline constexpr std::string_view id_faster_more_confidential{ "id_faster_more_confidential" };
+        inline constexpr std::string_view id_fastest{ "id_fastest" }; // Fastest
+        inline constexpr std::string_view id_fee{ "id_fee" }; // Fee
+        // Fee Amount, Size, Fee Rate
+        inline constexpr std::string_view id_fee_amount_size_fee_rate{ "id_fee_amount_size_fee_rate" };
+        inline constexpr std::string_view id_fee_rate{ "id_fee_rate" }; // Fee rate
+        // Fee rate is above maximum accepted fee rate.
+        inline constexpr std::string_view id_fee_rate_is_above_maximum{ "id_fee_rate_is_above_maximum" };
+        // Fee rate is below minimum accepted fee rate
+        inline constexpr std::string_view id_fee_rate_is_below_minimum{ "id_fee_rate_is_below_minimum" };
+        // Fee rate must be at least %s satoshi/vbyte.
+        inline constexpr std::string_view id_fee_rate_must_be_at_least_s{ "id_fee_rate_must_be_at_least_s" };
+        inline constexpr std::string_view id_fee_rate_s{ "id_fee_rate_s" }; // Fee rate: %s
+        inline constexpr std::string_view id_fee_s__s{ "id_fee_s__s" }; // Fee: %s / %s
+        inline constexpr std::string_view id_feedback{ "id_feedback" }; // Feedback
+        // Fees are collected by bitcoin miners, not Blockstream.
+        inline constexpr std::string_view id_fees_are_collected_by_bitcoin{ "id_fees_are_collected_by_bitcoin" };
+        inline constexpr std::string_view id_fees_are_too_low{ "id_fees_are_too_low" }; // Fees are too low
+        // Fetching new firmware
+        inline constexpr std::string_view id_fetching_new_firmware{ "id_fetching_new_firmware" };
+        inline constexpr std::string_view id_filters{ "id_filters" }; // Filters
+        inline constexpr std::string_view id_finishing_up{ "id_finishing_up" }; // Finishing Up
+        inline constexpr std::string_view id_firmware{ "id_firmware" }; // Firmware
+        inline constexpr std::string_view id_firmware_update{ "id_firmware_update" }; // Firmware update
+        // Firmware update completed
+        inline constexpr std::string_view id_firmware_update_completed{ "id_firmware_update_completed" };
+        inline constexpr std::string_view id_firmware_upgrade{ "id_firmware_upgrade" }; // Firmware Upgrade
+        inline constexpr std::string_view id_firmware_version_s{ "id_firmware_version_s" }; // Firmware Version: %s
+        // Follow the instructions of your hardware wallet before continuing.
+        inline constexpr std::string_view id_follow_the_instructions_of_your{ "id_follow_the_instructions_of_your" };
+        // Follow the instructions on Jade
+        inline constexpr std::string_view id_follow_the_instructions_on_jade{ "id_follow_the_instructions_on_jade" };
+        // Follow the instructions on your device.
+        inline constexpr std::string_view id_follow_the_instructions_on_your{ "id_follow_the_instructions_on_your" };
+        inline constexpr std::string_view id_for_investors{ "id_for_investors" }; // For investors
+        // For long term storage
+        inline constexpr std::string_view id_for_long_term_storage{ "id_for_long_term_storage" };
+        // For more information, Read More
+        inline constexpr std::string_view id_for_more_information_read_more{ "id_for_more_information_read_more" };
+        inline constexpr std::string_view id_for_most_users{ "id_for_most_users" }; // For most users
+        inline constexpr std::string_view id_from{ "id_from" }; // FROM
+        inline constexpr std::string_view id_funds_received{ "id_funds_received" }; // Funds Received!
+        // Funds received in this transaction are not confidential.
+        inline constexpr std::string_view id_funds_received_in_this{ "id_funds_received_in_this" };
+        inline constexpr std::string_view id_general{ "id_general" }; // General
+        inline constexpr std::string_view id_generate{ "id_generate" }; // Generate
+        // Generate a new recovery phrase as your third recovery key.
+        inline constexpr std::string_view id_generate_a_new_recovery_phrase{ "id_generate_a_new_recovery_phrase" };
+        inline constexpr std::string_view id_generate_new_address{ "id_generate_new_address" }; // Generate New Address
+        inline constexpr std::string_view id_get_code{ "id_get_code" }; // Get Code
+        inline constexpr std::string_view id_get_id{ "id_get_id" }; // Get ID
+        inline constexpr std::string_view id_get_jade{ "id_get_jade" }; // Get Jade
+        // Give Bluetooth Permissions
+        inline constexpr std::string_view id_give_bluetooth_permissions{ "id_give_bluetooth_permissions" };
+        // Give us your feedback
+        inline constexpr std::string_view id_give_us_your_feedback{ "id_give_us_your_feedback" };
+        inline constexpr std::string_view id_go_to_account{ "id_go_to_account" }; // Go to Account
+        // Go to Receive to get your Account ID.
+        inline constexpr std::string_view id_go_to_receive_to_get_your{ "id_go_to_receive_to_get_your" };
+        inline constexpr std::string_view id_go_to_wallet{ "id_go_to_wallet" }; // Go to Wallet
+        // Got it written down? Great. You can enter it here. Don’t lose it, it’ll stay the same.
+        inline constexpr std::string_view id_got_it_written_down_great_you{ "id_got_it_written_down_great_you" };
+        // Green is a non-custodial wallet
+        inline constexpr std::string_view id_green_is_a_noncustodial_wallet{ "id_green_is_a_noncustodial_wallet" };
+        inline constexpr std::string_view id_green_logo{ "id_green_logo" }; // Green Logo
+        // Green Mnemonic QR Code
+        inline constexpr std::string_view id_green_mnemonic_qr_code{ "id_green_mnemonic_qr_code" };
+        // Green only supports one PIN for each network. New wallets will require a mnemonic every time you log in.
+        inline constexpr std::string_view id_green_only_supports_one_pin_for{ "id_green_only_supports_one_pin_for" };
+        // Green only supports one PIN per network. To set a PIN for this wallet, disable the PIN on your original
+        // wallet first.
+        inline constexpr std::string_view id_green_only_supports_one_pin_per{ "id_green_only_supports_one_pin_per" };
+        // Green uses biometric authentication to allow easy access to the wallet
+        inline constexpr std::string_view id_green_uses_biometric{ "id_green_uses_biometric" };
+        // Green uses Bluetooth for communication with hardware wallets
+        inline constexpr std::string_view id_green_uses_bluetooth_for{ "id_green_uses_bluetooth_for" };
+        // Green uses Bluetooth to connect to hardware wallets
+        inline constexpr std::string_view id_green_uses_bluetooth_to_connect{ "id_green_uses_bluetooth_to_connect" };
+        // Green uses multisig with one signature generated by your device, and one by Blockstream’s servers. Setting up
+        // your Two-Factor Authentication enables an extra layer of security for the server-side signature.
+        inline constexpr std::string_view id_green_uses_multisig_with_one{ "id_green_uses_multisig_with_one" };
+        inline constexpr std::string_view id_hardware_devices{ "id_hardware_devices" }; // Hardware Devices
+        inline constexpr std::string_view id_hardware_security{ "id_hardware_security" }; // Hardware Security
+        inline constexpr std::string_view id_hardware_wallet{ "id_hardware_wallet" }; // Hardware wallet
+        // Hardware wallet support for Confidential Transactions coming soon.
+        inline constexpr std::string_view id_hardware_wallet_support_for{ "id_hardware_wallet_support_for" };
+        inline constexpr std::string_view id_hardware_wallets{ "id_hardware_wallets" }; // Hardware wallets
+        inline constexpr std::string_view id_hash{ "id_hash" }; // Hash
+        inline constexpr std::string_view id_hash_s{ "id_hash_s" }; // Hash: %s
+        inline constexpr std::string_view id_help{ "id_help" }; // Help
+        inline constexpr std::string_view id_help_green_improve{ "id_help_green_improve" }; // Help Green Improve
+        inline constexpr std::string_view id_here{ "id_here" }; // here
+        inline constexpr std::string_view id_hex{ "id_hex" }; // HEX
+        // Hide advanced options
+        inline constexpr std::string_view id_hide_advanced_options{ "id_hide_advanced_options" };
+        inline constexpr std::string_view id_hide_amounts{ "id_hide_amounts" }; // Hide amounts
+        inline constexpr std::string_view id_hide_assets{ "id_hide_assets" }; // Hide assets
+        inline constexpr std::string_view id_hide_details{ "id_hide_details" }; // Hide details
+        inline constexpr std::string_view id_high{ "id_high" }; // High
+        inline constexpr std::string_view id_hold_button_to_send{ "id_hold_button_to_send" }; // Hold button to Send
+        // Hold the green button on the bottom of Jade until it boots up
+        inline constexpr std::string_view id_hold_the_green_button_on_the{ "id_hold_the_green_button_on_the" };
+        // Hold your NFC tag close to the device
+        inline constexpr std::string_view id_hold_your_nfc_tag_close_to_the{ "id_hold_your_nfc_tag_close_to_the" };
+        inline constexpr std::string_view id_home{ "id_home" }; // Home
+        inline constexpr std::string_view id_hour{ "id_hour" }; // hour
+        inline constexpr std::string_view id_hours{ "id_hours" }; // hours
+        // How to Stop This Reset
+        inline constexpr std::string_view id_how_to_stop_this_reset{ "id_how_to_stop_this_reset" };
+        inline constexpr std::string_view id_i_agree_to_the{ "id_i_agree_to_the" }; // I agree to the
+        // I agree to the Terms of Service and Privacy Policy
+        inline constexpr std::string_view id_i_agree_to_the_terms_of_service{ "id_i_agree_to_the_terms_of_service" };
+        // I confirm I have read and understood the above message
+        inline constexpr std::string_view id_i_confirm_i_have_read_and{ "id_i_confirm_i_have_read_and" };
+        // I confirm I want to delete this wallet
+        inline constexpr std::string_view id_i_confirm_i_want_to_delete_this{ "id_i_confirm_i_want_to_delete_this" };
+        // I confirm I want to disable PIN access on all my devices.
+        inline constexpr std::string_view id_i_confirm_i_want_to_disable_pin{ "id_i_confirm_i_want_to_disable_pin" };
+        inline constexpr std::string_view id_i_forgot_my_password{ "id_i_forgot_my_password" }; // I forgot my password
+        // (i) Fund via an onchain bitcoin transaction
+        inline constexpr std::string_view id_i_fund_via_an_onchain_bitcoin{ "id_i_fund_via_an_onchain_bitcoin" };
+        inline constexpr std::string_view id_i_lost_my_2fa{ "id_i_lost_my_2fa" }; // I lost my 2FA
+        // I secured the mnemonic and I have read the ToS
+        inline constexpr std::string_view id_i_secured_the_mnemonic_and_i{ "id_i_secured_the_mnemonic_and_i" };
+        // I typed all my recovery phrase why can\'t I continue?
+        inline constexpr std::string_view id_i_typed_all_my_recovery_phrase{ "id_i_typed_all_my_recovery_phrase" };
+        // I understand amounts could be incorrect
+        inline constexpr std::string_view id_i_understand_amounts_could_be{ "id_i_understand_amounts_could_be" };
+        inline constexpr std::string_view id_id{ "id_id" }; // ID
+        // If for any reason you can\'t login into your wallet, you can recover your recovery phrase using your
+        // PIN/Biometrics.
+        inline constexpr std::string_view id_if_for_any_reason_you_cant{ "id_if_for_any_reason_you_cant" };
+        // If you agree, Green will collect limited usage data to optimize the user experience. No sensitive user or
+        // wallet info is collected.
+        inline constexpr std::string_view id_if_you_agree_green_will_collect{ "id_if_you_agree_green_will_collect" };
+        // If you are the rightful owner of this wallet, and you still possess one of its active 2FA methods, cancel the
+        // reset to be able to spend and empty this wallet.
+        inline constexpr std::string_view id_if_you_are_the_rightful_owner{ "id_if_you_are_the_rightful_owner" };
+        // If you did not request the reset, but you cannot cancel the reset process because you can\'t access any
+        // existing Two-Factor Authorization methods, dispute this 2FA reset. This will permanently block your wallet,
+        // but you can undo this action.
+        inline constexpr std::string_view id_if_you_did_not_request_the{ "id_if_you_did_not_request_the" };
+        // If you forget it or lose it, your funds are going to be lost as well.
+        inline constexpr std::string_view id_if_you_forget_it_or_lose_it{ "id_if_you_forget_it_or_lose_it" };
+        // If you have access to a Two-Factor method for this wallet, cancel the reset to be able to spend and receive
+        // immediately, or wait %d days.
+        inline constexpr std::string_view id_if_you_have_access_to_a{ "id_if_you_have_access_to_a" };
+        // If you have some coins on the legacy address type, and you won\'t spend them shortly, you might need to setup
+        // an email and receive your recovery transactions to be sure you are always in control of your funds.
+        inline constexpr std::string_view id_if_you_have_some_coins_on_the{ "id_if_you_have_some_coins_on_the" };
+        // If you initiated the 2FA reset dispute by mistake, you can undo it and set the wallet back to 2FA reset
+        // state.
+        inline constexpr std::string_view id_if_you_initiated_the_2fa_reset{ "id_if_you_initiated_the_2fa_reset" };
+        inline constexpr std::string_view id_import{ "id_import" }; // Import
+        // Import a Multisig Shield wallet created on Blockstream Green.
+        inline constexpr std::string_view id_import_a_multisig_shield_wallet{ "id_import_a_multisig_shield_wallet" };
+        // Import a wallet created on Blockstream Green.
+        inline constexpr std::string_view id_import_a_wallet_created_on{ "id_import_a_wallet_created_on" };
+        // Import a wallet created with other apps. This option only works with singlesig wallets using BIP39 mnemonics,
+        // and following the BIP44, BIP49, or BIP84 derivations.
+        inline constexpr std::string_view id_import_a_wallet_created_with{ "id_import_a_wallet_created_with" };
+        inline constexpr std::string_view id_import_from_file{ "id_import_from_file" }; // Import from file
+        inline constexpr std::string_view id_in_progress{ "id_in_progress" }; // In Progress
+        inline constexpr std::string_view id_inbound_liquidity{ "id_inbound_liquidity" }; // Inbound Liquidity
+        inline constexpr std::string_view id_incoming{ "id_incoming" }; // Incoming
+        // Inconsistent data provided for enabling Authenticator 2FA
+        inline constexpr std::string_view id_inconsistent_data_provided_for{ "id_inconsistent_data_provided_for" };
+        inline constexpr std::string_view id_increase_fee{ "id_increase_fee" }; // Increase fee
+        // Increase inbound capacity now
+        inline constexpr std::string_view id_increase_inbound_capacity_now{ "id_increase_inbound_capacity_now" };
+        inline constexpr std::string_view id_increase_security{ "id_increase_security" }; // Increase Security
+        // Increase the security of your funds by adding a 2FA
+        inline constexpr std::string_view id_increase_the_security_of_your{ "id_increase_the_security_of_your" };
+        // Information not available.
+        inline constexpr std::string_view id_information_not_available{ "id_information_not_available" };
+        // Initialize and Create wallet
+        inline constexpr std::string_view id_initialize_and_create_wallet{ "id_initialize_and_create_wallet" };
+        // Initialize Jade for testnet
+        inline constexpr std::string_view id_initialize_jade_for_testnet{ "id_initialize_jade_for_testnet" };
+        inline constexpr std::string_view id_initialized{ "id_initialized" }; // Initialized
+        inline constexpr std::string_view id_initializing_tor{ "id_initializing_tor" }; // Initializing Tor…
+        // Insert your email to receive 2FA codes to authorize transfers and other operations.
+        inline constexpr std::string_view id_insert_your_email_to_receive{ "id_insert_your_email_to_receive" };
+        // Insert your phone number to receive 2FA codes to authorize transfers and other operations.
+        inline constexpr std::string_view id_insert_your_phone_number_to{ "id_insert_your_phone_number_to" };
+        inline constexpr std::string_view id_install_version_s{ "id_install_version_s" }; // Install version: %s?
+        inline constexpr std::string_view id_instant{ "id_instant" }; // Instant
+        inline constexpr std::string_view id_insufficient_funds{ "id_insufficient_funds" }; // Insufficient funds
+        // Insufficient L-BTC for fees
+        inline constexpr std::string_view id_insufficient_lbtc_for_fees{ "id_insufficient_lbtc_for_fees" };
+        // Insufficient L-BTC to send a transaction. In Liquid, L-BTC are needed to pay transaction fees. Generate an
+        // address to receive L-BTC
+        inline constexpr std::string_view id_insufficient_lbtc_to_send_a{ "id_insufficient_lbtc_to_send_a" };
+        inline constexpr std::string_view id_invalid_address{ "id_invalid_address" }; // Invalid address
+        inline constexpr std::string_view id_invalid_amount{ "id_invalid_amount" }; // Invalid amount
+        inline constexpr std::string_view id_invalid_asset_id{ "id_invalid_asset_id" }; // Invalid Asset ID
+        // Invalid clipboard contents
+        inline constexpr std::string_view id_invalid_clipboard_contents{ "id_invalid_clipboard_contents" };
+        inline constexpr std::string_view id_invalid_merkle_proof{ "id_invalid_merkle_proof" }; // Invalid Merkle proof
+        inline constexpr std::string_view id_invalid_mnemonic{ "id_invalid_mnemonic" }; // Invalid mnemonic
+        // Invalid mnemonic. Continue typing or ask for help
+        inline constexpr std::string_view id_invalid_mnemonic_continue{ "id_invalid_mnemonic_continue" };
+        // Invalid mnemonic (must be 24 or 27 words)
+        inline constexpr std::string_view id_invalid_mnemonic_must_be_24_or{ "id_invalid_mnemonic_must_be_24_or" };
+        // Invalid network configuration
+        inline constexpr std::string_view id_invalid_network_configuration{ "id_invalid_network_configuration" };
+        // Invalid payment request, AssetID has to be specified
+        inline constexpr std::string_view id_invalid_payment_request_assetid{ "id_invalid_payment_request_assetid" };
+        inline constexpr std::string_view id_invalid_pgp_key{ "id_invalid_pgp_key" }; // Invalid PGP key
+        // Invalid phone number format
+        inline constexpr std::string_view id_invalid_phone_number_format{ "id_invalid_phone_number_format" };
+        inline constexpr std::string_view id_invalid_pin{ "id_invalid_pin" }; // Invalid PIN
+        // Invalid PIN. Remaining attempts: %1$d.
+        inline constexpr std::string_view id_invalid_pin_remaining_attempts{ "id_invalid_pin_remaining_attempts" };
+        // Invalid PIN, you don\'t have any attempts left. Please log in using your mnemonic.
+        inline constexpr std::string_view id_invalid_pin_you_dont_have_any{ "id_invalid_pin_you_dont_have_any" };
+        // Invalid PIN, you have %1$d attempts left
+        inline constexpr std::string_view id_invalid_pin_you_have_1d{ "id_invalid_pin_you_have_1d" };
+        inline constexpr std::string_view id_invalid_private_key{ "id_invalid_private_key" }; // Invalid private key
+        // Invalid recovery phrase
+        inline constexpr std::string_view id_invalid_recovery_phrase{ "id_invalid_recovery_phrase" };
+        // Invalid replacement fee rate
+        inline constexpr std::string_view id_invalid_replacement_fee_rate{ "id_invalid_replacement_fee_rate" };
+        // Invalid status. Check that your device is unlocked and try again.
+        inline constexpr std::string_view id_invalid_status_check_that_your{ "id_invalid_status_check_that_your" };
+        // Invalid swap proposal
+        inline constexpr std::string_view id_invalid_swap_proposal{ "id_invalid_swap_proposal" };
+        // Invalid Two-Factor code
+        inline constexpr std::string_view id_invalid_twofactor_code{ "id_invalid_twofactor_code" };
+        inline constexpr std::string_view id_invalid_url{ "id_invalid_url" }; // Invalid URL
+        inline constexpr std::string_view id_invalid_xpub{ "id_invalid_xpub" }; // Invalid xpub
+        inline constexpr std::string_view id_invoice_expired{ "id_invoice_expired" }; // Invoice expired
+        inline constexpr std::string_view id_invoices{ "id_invoices" }; // Invoices
+        inline constexpr std::string_view id_is_a_noncustodial{ "id_is_a_noncustodial" }; // is a non-custodial
+        inline constexpr std::string_view id_issuer{ "id_issuer" }; // Issuer
+        inline constexpr std::string_view id_issuer_domain_s{ "id_issuer_domain_s" }; // Issuer Domain: %s
+        // It looks like you have no wallets. Click below to add one.
+        inline constexpr std::string_view id_it_looks_like_you_have_no{ "id_it_looks_like_you_have_no" };
+        // Jade is a specialized device designed to securely store the keys needed to spend your bitcoin.
+        inline constexpr std::string_view id_jade_is_a_specialized_device{ "id_jade_is_a_specialized_device" };
+        // Jade is an isolated device not connected to the internet, which means your funds are protected from a hacked
+        // or compromised phone.
+        inline constexpr std::string_view id_jade_is_an_isolated_device_not{ "id_jade_is_an_isolated_device_not" };
+        // Jade is an open-source hardware wallet for Bitcoin and Liquid assets.
+        inline constexpr std::string_view id_jade_is_an_opensource_hardware{ "id_jade_is_an_opensource_hardware" };
+        inline constexpr std::string_view id_jade_unlocked{ "id_jade_unlocked" }; // Jade unlocked
+        // Jade was initialized for testnet
+        inline constexpr std::string_view id_jade_was_initialized_for_testnet{ "id_jade_was_initialized_for_testnet" };
+        // Just a few more steps to get you set up.
+        inline constexpr std::string_view id_just_a_few_more_steps_to_get{ "id_just_a_few_more_steps_to_get" };
+        inline constexpr std::string_view id_label{ "id_label" }; // Label
+        inline constexpr std::string_view id_language{ "id_language" }; // Language
+        // Last attempt: if failed, you will have to restore your wallet with your recovery phrase.
+        inline constexpr std::string_view id_last_attempt_if_failed_you_will{ "id_last_attempt_if_failed_you_will" };
+        inline constexpr std::string_view id_last_ping_1d_ms{ "id_last_ping_1d_ms" }; // Last ping: %1$d ms
+        inline constexpr std::string_view id_later{ "id_later" }; // LATER
+        inline constexpr std::string_view id_latest_transactions{ "id_latest_transactions" }; // Latest transactions
+        // L-BTC has no issuer and is instead created on the network via a peg-in.
+        inline constexpr std::string_view id_lbtc_has_no_issuer_and_is{ "id_lbtc_has_no_issuer_and_is" };
+        inline constexpr std::string_view id_learn_more{ "id_learn_more" }; // Learn more
+        // Learn more about AMP, the assets and your eligibility
+        inline constexpr std::string_view id_learn_more_about_amp_the_assets{ "id_learn_more_about_amp_the_assets" };
+        inline constexpr std::string_view id_learn_more_about_s{ "id_learn_more_about_s" }; // Learn more about %s.
+        // Ledger Dashboard detected, please open the correct app to access.
+        inline constexpr std::string_view id_ledger_dashboard_detected{ "id_ledger_dashboard_detected" };
+        inline constexpr std::string_view id_ledger_devices{ "id_ledger_devices" }; // Ledger devices
+        // Ledger supports a limited set of assets: tap here to check the list.
+        inline constexpr std::string_view id_ledger_supports_a_limited_set{ "id_ledger_supports_a_limited_set" };
+        inline constexpr std::string_view id_legacy{ "id_legacy" }; // Legacy
+        inline constexpr std::string_view id_legacy_account{ "id_legacy_account" }; // Legacy Account
+        inline constexpr std::string_view id_legacy_bip44{ "id_legacy_bip44" }; // Legacy (BIP44)
+        inline constexpr std::string_view id_legacy_script_coins{ "id_legacy_script_coins" }; // Legacy script coins
+        inline constexpr std::string_view id_legacy_segwit{ "id_legacy_segwit" }; // Legacy SegWit
+        // Legacy SegWit Account
+        inline constexpr std::string_view id_legacy_segwit_account{ "id_legacy_segwit_account" };
+        inline constexpr std::string_view id_legacy_segwit_bip49{ "id_legacy_segwit_bip49" }; // Legacy SegWit (BIP49)
+        inline constexpr std::string_view id_lets_get_you_set_up{ "id_lets_get_you_set_up" }; // Let\'s get you set up.
+        inline constexpr std::string_view id_lightning{ "id_lightning" }; // Lightning
+        inline constexpr std::string_view id_lightning_invoice{ "id_lightning_invoice" }; // Lightning Invoice
+        // Lightning Invoice / LNURL
+        inline constexpr std::string_view id_lightning_invoice__lnurl{ "id_lightning_invoice__lnurl" };
+        // Lightning invoice is expired
+        inline constexpr std::string_view id_lightning_invoice_is_expired{ "id_lightning_invoice_is_expired" };
+        // Lightning Network account powered by Greenlight. Portable onto your own CLN node.
+        inline constexpr std::string_view id_lightning_network_account{ "id_lightning_network_account" };
+        inline constexpr std::string_view id_limits_s__s{ "id_limits_s__s" }; // Limits: %s - %s
+        // Liquid Electrum server
+        inline constexpr std::string_view id_liquid_electrum_server{ "id_liquid_electrum_server" };
+        // Liquid is a sidechain-based settlement network for traders and exchanges, enabling faster, more confidential
+        // Bitcoin transactions and the issuance of digital assets.
+        inline constexpr std::string_view id_liquid_is_a_sidechainbased{ "id_liquid_is_a_sidechainbased" };
+        inline constexpr std::string_view id_liquid_securities{ "id_liquid_securities" }; // Liquid Securities
+        // Liquid Testnet Electrum server
+        inline constexpr std::string_view id_liquid_testnet_electrum_server{ "id_liquid_testnet_electrum_server" };
+        // Liquid testnet wallets
+        inline constexpr std::string_view id_liquid_testnet_wallets{ "id_liquid_testnet_wallets" };
+        inline constexpr std::string_view id_liquid_wallet{ "id_liquid_wallet" }; // Liquid Wallet
+        inline constexpr std::string_view id_liquid_wallets{ "id_liquid_wallets" }; // Liquid wallets
+        inline constexpr std::string_view id_loading{ "id_loading" }; // Loading
+        inline constexpr std::string_view id_loading_accounts{ "id_loading_accounts" }; // Loading accounts…
+        inline constexpr std::string_view id_loading_assets{ "id_loading_assets" }; // Loading assets…
+        inline constexpr std::string_view id_loading_transactions{ "id_loading_transactions" }; // Loading transactions…
+        inline constexpr std::string_view id_loading_wallet{ "id_loading_wallet" }; // Loading wallet…
+        // Location services are disabled, do you want to enable them?
+        inline constexpr std::string_view id_location_services_are_disabled{ "id_location_services_are_disabled" };
+        inline constexpr std::string_view id_lock{ "id_lock" }; // Lock
+        inline constexpr std::string_view id_lock_after_1_minute{ "id_lock_after_1_minute" }; // Lock after 1 minute
+        inline constexpr std::string_view id_lock_immediately{ "id_lock_immediately" }; // Lock immediately
+        inline constexpr std::string_view id_locked{ "id_locked" }; // Locked
+        // Locked coins will not be spent nor included in your balance.
+        inline constexpr std::string_view id_locked_coins_will_not_be_spent{ "id_locked_coins_will_not_be_spent" };
+        inline constexpr std::string_view id_locking_coins{ "id_locking_coins" }; // Locking coins
+        // Locking coins can help protect your privacy and save on transaction fees. Locked coins are deducted from your
+        // balance and are not used when sending transactions. You can only lock coins labeled as dust and unlock them
+        // later at any time.
+        inline constexpr std::string_view id_locking_coins_can_help_protect{ "id_locking_coins_can_help_protect" };
+        inline constexpr std::string_view id_log_file{ "id_log_file" }; // Log file
+        inline constexpr std::string_view id_log_in{ "id_log_in" }; // Log In
+        // Log in into your %s wallet
+        inline constexpr std::string_view id_log_in_into_your_s_wallet{ "id_log_in_into_your_s_wallet" };
+        // Log in to your Multisig Shield watch-only wallet with a username and password. You can create your watch-only
+        // credentials after logging into your Multisig Shield wallet.
+        inline constexpr std::string_view id_log_in_to_your_multisig_shield{ "id_log_in_to_your_multisig_shield" };
+        // Log in using mnemonic
+        inline constexpr std::string_view id_log_in_using_mnemonic{ "id_log_in_using_mnemonic" };
+        // Log in via Watch-only to receive funds and check balance.
+        inline constexpr std::string_view id_log_in_via_watchonly_to_receive{ "id_log_in_via_watchonly_to_receive" };
+        inline constexpr std::string_view id_log_out{ "id_log_out" }; // Log out
+        inline constexpr std::string_view id_logged_in_wallets{ "id_logged_in_wallets" }; // Logged in wallets
+        inline constexpr std::string_view id_logging_in{ "id_logging_in" }; // Logging in…
+        inline constexpr std::string_view id_login{ "id_login" }; // Login
+        inline constexpr std::string_view id_login_failed{ "id_login_failed" }; // Login Failed
+        inline constexpr std::string_view id_login_options{ "id_login_options" }; // Login options
+        // Login with Biometrics
+        inline constexpr std::string_view id_login_with_biometrics{ "id_login_with_biometrics" };
+        // Login with BIP39 Passphrase
+        inline constexpr std::string_view id_login_with_bip39_passphrase{ "id_login_with_bip39_passphrase" };
+        inline constexpr std::string_view id_logout{ "id_logout" }; // Logout
+        inline constexpr std::string_view id_logout_and_switch{ "id_logout_and_switch" }; // Logout and Switch
+        // Look at the device for the number positions
+        inline constexpr std::string_view id_look_at_the_device_for_the{ "id_look_at_the_device_for_the" };
+        inline constexpr std::string_view id_looking_for_device{ "id_looking_for_device" }; // Looking for device...
+        inline constexpr std::string_view id_looking_for_wallets{ "id_looking_for_wallets" }; // Looking for wallets…
+        // Looks like you haven\'t used a wallet yet. Try creating a new one.
+        inline constexpr std::string_view id_looks_like_you_havent_used_a{ "id_looks_like_you_havent_used_a" };
+        inline constexpr std::string_view id_low{ "id_low" }; // Low
+        inline constexpr std::string_view id_main_account{ "id_main_account" }; // Main Account
+        // Make sure to be in a private and safe space
+        inline constexpr std::string_view id_make_sure_to_be_in_a_private{ "id_make_sure_to_be_in_a_private" };
+        // Make sure you are alone and no camera is recording you or the screen.
+        inline constexpr std::string_view id_make_sure_you_are_alone_and_no{ "id_make_sure_you_are_alone_and_no" };
+        // Make sure you got everything right.
+        inline constexpr std::string_view id_make_sure_you_got_everything{ "id_make_sure_you_got_everything" };
+        // Make sure you have enabled OTG option in Android Settings
+        inline constexpr std::string_view id_make_sure_you_have_enabled_otg{ "id_make_sure_you_have_enabled_otg" };
+        // Make sure you made a proper backup of your wallet mnemonic.
+        inline constexpr std::string_view id_make_sure_you_made_a_proper{ "id_make_sure_you_made_a_proper" };
+        inline constexpr std::string_view id_malleated{ "id_malleated" }; // malleated
+        inline constexpr std::string_view id_managed_assets{ "id_managed_assets" }; // Managed Assets
+        // Managed Assets Account
+        inline constexpr std::string_view id_managed_assets_account{ "id_managed_assets_account" };
+        // Managed assets accounts are only available on Liquid wallets. You may be required to provide your account ID
+        // to issuers to receive a Managed Asset.
+        inline constexpr std::string_view id_managed_assets_accounts_are{ "id_managed_assets_accounts_are" };
+        // Manual coin selection
+        inline constexpr std::string_view id_manual_coin_selection{ "id_manual_coin_selection" };
+        inline constexpr std::string_view id_manual_restore{ "id_manual_restore" }; // Manual Restore
+        inline constexpr std::string_view id_max_limit_s{ "id_max_limit_s" }; // Max Limit: %s
+        inline constexpr std::string_view id_max_payable_amount{ "id_max_payable_amount" }; // Max Payable Amount
+        // Max Receivable Amount
+        inline constexpr std::string_view id_max_receivable_amount{ "id_max_receivable_amount" };
+        // Max Single Payment Amount
+        inline constexpr std::string_view id_max_single_payment_amount{ "id_max_single_payment_amount" };
+        inline constexpr std::string_view id_medium{ "id_medium" }; // Medium
+        inline constexpr std::string_view id_memo{ "id_memo" }; // Memo
+        inline constexpr std::string_view id_message{ "id_message" }; // Message
+        inline constexpr std::string_view id_message_hash{ "id_message_hash" }; // Message hash
+        // Migrate Another Wallet
+        inline constexpr std::string_view id_migrate_another_wallet{ "id_migrate_another_wallet" };
+        // Migrating to Blockstream Green? Have an existing Blockstream Green wallet you’d like to import? Let\'s go!
+        inline constexpr std::string_view id_migrating_to_blockstream_green{ "id_migrating_to_blockstream_green" };
+        inline constexpr std::string_view id_minimum{ "id_minimum" }; // Minimum
+        inline constexpr std::string_view id_minute{ "id_minute" }; // minute
+        inline constexpr std::string_view id_minutes{ "id_minutes" }; // minutes
+        inline constexpr std::string_view id_mnemonic{ "id_mnemonic" }; // Mnemonic
+        // Mnemonic not available
+        inline constexpr std::string_view id_mnemonic_not_available{ "id_mnemonic_not_available" };
+        inline constexpr std::string_view id_model{ "id_model" }; // Model
+        inline constexpr std::string_view id_month{ "id_month" }; // month
+        inline constexpr std::string_view id_months{ "id_months" }; // months
+        inline constexpr std::string_view id_more_info{ "id_more_info" }; // More Info
+        inline constexpr std::string_view id_more_options{ "id_more_options" }; // More Options
+        // Move to 2FA Protected
+        inline constexpr std::string_view id_move_to_2fa_protected{ "id_move_to_2fa_protected" };
+        // Multi Server Validation
+        inline constexpr std::string_view id_multi_server_validation{ "id_multi_server_validation" };
+        inline constexpr std::string_view id_multiple_assets{ "id_multiple_assets" }; // Multiple Assets
+        inline constexpr std::string_view id_multisig{ "id_multisig" }; // Multisig
+        inline constexpr std::string_view id_multisig_shield{ "id_multisig_shield" }; // Multisig Shield
+        inline constexpr std::string_view id_my_assets{ "id_my_assets" }; // My Assets
+        inline constexpr std::string_view id_my_notes{ "id_my_notes" }; // MY NOTES
+        inline constexpr std::string_view id_name{ "id_name" }; // Name
+        inline constexpr std::string_view id_native_segwit{ "id_native_segwit" }; // Native SegWit
+        inline constexpr std::string_view id_need_help{ "id_need_help" }; // Need help?
+        inline constexpr std::string_view id_network{ "id_network" }; // Network
+        // Network Configuration
+        inline constexpr std::string_view id_network_configuration{ "id_network_configuration" };
+        inline constexpr std::string_view id_network_fee{ "id_network_fee" }; // Network Fee
+        inline constexpr std::string_view id_network_monitor{ "id_network_monitor" }; // Network Monitor
+        inline constexpr std::string_view id_networks{ "id_networks" }; // Networks
+        inline constexpr std::string_view id_new_account_created{ "id_new_account_created" }; // New account created
+        // New accounts functionality coming soon!
+        inline constexpr std::string_view id_new_accounts_functionality{ "id_new_accounts_functionality" };
+        inline constexpr std::string_view id_new_fee{ "id_new_fee" }; // New fee
+        // New incoming transaction in account %s (%s).
+        inline constexpr std::string_view id_new_incoming_transaction_in{ "id_new_incoming_transaction_in" };
+        // New Jade Firmware Available
+        inline constexpr std::string_view id_new_jade_firmware_available{ "id_new_jade_firmware_available" };
+        // New Jade Firmware Required
+        inline constexpr std::string_view id_new_jade_firmware_required{ "id_new_jade_firmware_required" };
+        // New outgoing transaction from account %s (%s).
+        inline constexpr std::string_view id_new_outgoing_transaction_from{ "id_new_outgoing_transaction_from" };
+        inline constexpr std::string_view id_new_recovery_phrase{ "id_new_recovery_phrase" }; // New recovery phrase
+        // New %s transaction of %s in account %s.
+        inline constexpr std::string_view id_new_s_transaction_of_s_in{ "id_new_s_transaction_of_s_in" };
+        inline constexpr std::string_view id_new_transaction{ "id_new_transaction" }; // New transaction
+        // New transaction involving accounts %s.
+        inline constexpr std::string_view id_new_transaction_involving{ "id_new_transaction_involving" };
+        inline constexpr std::string_view id_new_version{ "id_new_version" }; // New version
+        inline constexpr std::string_view id_new_wallet{ "id_new_wallet" }; // New Wallet
+        inline constexpr std::string_view id_next{ "id_next" }; // Next
+        inline constexpr std::string_view id_nfc_logo{ "id_nfc_logo" }; // NFC Logo
+        inline constexpr std::string_view id_nfc_tags_written{ "id_nfc_tags_written" }; // NFC TAGs Written:
+        inline constexpr std::string_view id_no_addresses{ "id_no_addresses" }; // No addresses
+        inline constexpr std::string_view id_no_amount_specified{ "id_no_amount_specified" }; // No amount specified
+        inline constexpr std::string_view id_no_archived_accounts{ "id_no_archived_accounts" }; // No archived accounts
+        // No asset in this account
+        inline constexpr std::string_view id_no_asset_in_this_account{ "id_no_asset_in_this_account" };
+        // No attempts remaining
+        inline constexpr std::string_view id_no_attempts_remaining{ "id_no_attempts_remaining" };
+        inline constexpr std::string_view id_no_coins_selected{ "id_no_coins_selected" }; // (No coins selected)
+        inline constexpr std::string_view id_no_device_connected{ "id_no_device_connected" }; // No device connected
+        // No existing wallet could be found.\nTry manually restoring your wallet.
+        inline constexpr std::string_view id_no_existing_wallet_could_be{ "id_no_existing_wallet_could_be" };
+        inline constexpr std::string_view id_no_more_assets{ "id_no_more_assets" }; // No more assets.
+        // No multisig shield wallet exists for this recovery phrase.
+        inline constexpr std::string_view id_no_multisig_shield_wallet{ "id_no_multisig_shield_wallet" };
+        inline constexpr std::string_view id_no_peers_connected{ "id_no_peers_connected" }; // No Peers Connected
+        // No personal data will be shared with this service.
+        inline constexpr std::string_view id_no_personal_data_will_be_shared{ "id_no_personal_data_will_be_shared" };
+        // No PIN provided, exiting.
+        inline constexpr std::string_view id_no_pin_provided_exiting{ "id_no_pin_provided_exiting" };
+        inline constexpr std::string_view id_no_recipients{ "id_no_recipients" }; // No recipients
+        // No registered name for this asset.
+        inline constexpr std::string_view id_no_registered_name_for_this{ "id_no_registered_name_for_this" };
+        // No registered ticker for this asset.
+        inline constexpr std::string_view id_no_registered_ticker_for_this{ "id_no_registered_ticker_for_this" };
+        inline constexpr std::string_view id_no_utxos_found{ "id_no_utxos_found" }; // No UTXOs found
+        inline constexpr std::string_view id_node_info{ "id_node_info" }; // Node Info
+        inline constexpr std::string_view id_non_confidential{ "id_non_confidential" }; // Non Confidential
+        // Non Confidential Transaction
+        inline constexpr std::string_view id_non_confidential_transaction{ "id_non_confidential_transaction" };
+        // Non-confidential addresses not supported
+        inline constexpr std::string_view id_nonconfidential_addresses_not{ "id_nonconfidential_addresses_not" };
+        inline constexpr std::string_view id_noradio_firmware{ "id_noradio_firmware" }; // No-radio firmware
+        inline constexpr std::string_view id_normal{ "id_normal" }; // Normal
+        // Not a valid email address
+        inline constexpr std::string_view id_not_a_valid_email_address{ "id_not_a_valid_email_address" };
+        // Not a valid phone number
+        inline constexpr std::string_view id_not_a_valid_phone_number{ "id_not_a_valid_phone_number" };
+        inline constexpr std::string_view id_not_a_valid_word{ "id_not_a_valid_word" }; // Not a valid word
+        // Not available (No-radio build)
+        inline constexpr std::string_view id_not_available_noradio_build{ "id_not_available_noradio_build" };
+        inline constexpr std::string_view id_not_confidential{ "id_not_confidential" }; // Not confidential
+        // Not connected. Connecting in %ds …
+        inline constexpr std::string_view id_not_connected_connecting_in_ds_{ "id_not_connected_connecting_in_ds_" };
+        inline constexpr std::string_view id_not_initialized{ "id_not_initialized" }; // Not initialized
+        inline constexpr std::string_view id_not_now{ "id_not_now" }; // Not now
+        inline constexpr std::string_view id_not_on_longest_chain{ "id_not_on_longest_chain" }; // Not on longest chain
+        inline constexpr std::string_view id_note{ "id_note" }; // Note
+        // Note down your recovery phrase. Keep it somewhere safe!
+        inline constexpr std::string_view id_note_down_your_recovery_phrase{ "id_note_down_your_recovery_phrase" };
+        inline constexpr std::string_view id_notifications{ "id_notifications" }; // Notifications
+        inline constexpr std::string_view id_now{ "id_now" }; // Now
+        inline constexpr std::string_view id_of_24{ "id_of_24" }; // of 24
+        inline constexpr std::string_view id_of_s{ "id_of_s" }; // of %s
+        inline constexpr std::string_view id_offline_key_storage{ "id_offline_key_storage" }; // Offline Key Storage
+        inline constexpr std::string_view id_ok{ "id_ok" }; // Ok
+        inline constexpr std::string_view id_on_average{ "id_on_average" }; // on average
+        // Once selected, this spending policy cannot be changed. For tips on what type of security is best for you,
+        // visit our Help Center.
+        inline constexpr std::string_view id_once_selected_this_spending{ "id_once_selected_this_spending" };
+        inline constexpr std::string_view id_onchain_address{ "id_onchain_address" }; // Onchain Address
+        inline constexpr std::string_view id_onchain_swaps{ "id_onchain_swaps" }; // Onchain Swaps
+        // One attempt remaining
+        inline constexpr std::string_view id_one_attempt_remaining{ "id_one_attempt_remaining" };
+        // One network must be selected. Selecting Bitcoin by default
+        inline constexpr std::string_view id_one_network_must_be_selected{ "id_one_network_must_be_selected" };
+        // Onion addresses require Tor connectivity. Enable it in the network settings.
+        inline constexpr std::string_view id_onion_addresses_require_tor{ "id_onion_addresses_require_tor" };
+        // Only connect to trusted node(s) for SPV
+        inline constexpr std::string_view id_only_connect_to_trusted_nodes{ "id_only_connect_to_trusted_nodes" };
+        inline constexpr std::string_view id_only_this_time{ "id_only_this_time" }; // Only this time
+        inline constexpr std::string_view id_open{ "id_open" }; // Open
+        inline constexpr std::string_view id_operation_failure{ "id_operation_failure" }; // Operation failure
+        // Optimal if you rarely spend coins. Wallet coins will require two-factor reactivation every 455 days to remain
+        // protected by two-factor authentication
+        inline constexpr std::string_view id_optimal_if_you_rarely_spend{ "id_optimal_if_you_rarely_spend" };
+        // Optimal if you spend coins every 6 months. Wallet coins will require two-factor reactivation every 6 months
+        // to remain protected by two-factor authentication.
+        inline constexpr std::string_view id_optimal_if_you_spend_coins{ "id_optimal_if_you_spend_coins" };
+        inline constexpr std::string_view id_optional{ "id_optional" }; // Optional
+        inline constexpr std::string_view id_optional_memo{ "id_optional_memo" }; // Optional memo
+        inline constexpr std::string_view id_optional_password{ "id_optional_password" }; // Optional password
+        inline constexpr std::string_view id_or{ "id_or" }; // OR
+        // Original swap address
+        inline constexpr std::string_view id_original_swap_address{ "id_original_swap_address" };
+        // OS & app version, loading times
+        inline constexpr std::string_view id_os__app_version_loading_times{ "id_os__app_version_loading_times" };
+        inline constexpr std::string_view id_our_support_page{ "id_our_support_page" }; // our support page
+        // Outdated hardware wallet firmware. Please upgrade to the latest firmware from your desktop.
+        inline constexpr std::string_view id_outdated_hardware_wallet{ "id_outdated_hardware_wallet" };
+        inline constexpr std::string_view id_outgoing{ "id_outgoing" }; // Outgoing
+        inline constexpr std::string_view id_output_descriptors{ "id_output_descriptors" }; // Output Descriptors
+        inline constexpr std::string_view id_overview{ "id_overview" }; // Overview
+        inline constexpr std::string_view id_p2sh{ "id_p2sh" }; // P2sh
+        inline constexpr std::string_view id_p2wsh{ "id_p2wsh" }; // P2wsh
+        // Page visits, button presses, general app configuration
+        inline constexpr std::string_view id_page_visits_button_presses{ "id_page_visits_button_presses" };
+        inline constexpr std::string_view id_passphrase{ "id_passphrase" }; // Passphrase
+        inline constexpr std::string_view id_passphrase_protected{ "id_passphrase_protected" }; // Passphrase protected
+        inline constexpr std::string_view id_password{ "id_password" }; // Password
+        inline constexpr std::string_view id_password_protected{ "id_password_protected" }; // Password protected
+        inline constexpr std::string_view id_paste{ "id_paste" }; // Paste
+        // Paste an Existing Proposal
+        inline constexpr std::string_view id_paste_an_existing_proposal{ "id_paste_an_existing_proposal" };
+        // Path used for signing
+        inline constexpr std::string_view id_path_used_for_signing{ "id_path_used_for_signing" };
+        // Payment requested by %s
+        inline constexpr std::string_view id_payment_requested_by_s{ "id_payment_requested_by_s" };
+        // Payments to self are not supported in your lightning account.
+        inline constexpr std::string_view id_payments_to_self_are_not{ "id_payments_to_self_are_not" };
+        inline constexpr std::string_view id_pending_confirmation{ "id_pending_confirmation" }; // Pending confirmation
+        // Permanent 2FA account, ideal for long term hodling, optionally with 3rd emergency key on hardware wallet.
+        inline constexpr std::string_view id_permanent_2fa_account_ideal_for{ "id_permanent_2fa_account_ideal_for" };
+        // Permanently Block This Wallet
+        inline constexpr std::string_view id_permanently_block_this_wallet{ "id_permanently_block_this_wallet" };
+        // Personal Electrum Server
+        inline constexpr std::string_view id_personal_electrum_server{ "id_personal_electrum_server" };
+        inline constexpr std::string_view id_pgp_key{ "id_pgp_key" }; // PGP key
+        inline constexpr std::string_view id_phone_call{ "id_phone_call" }; // Phone call
+        inline constexpr std::string_view id_phone_number{ "id_phone_number" }; // phone number
+        inline constexpr std::string_view id_pin{ "id_pin" }; // PIN
+        inline constexpr std::string_view id_pin_access_disabled{ "id_pin_access_disabled" }; // PIN access disabled
+        // PIN has to be between 4 and 15 digits
+        inline constexpr std::string_view id_pin_has_to_be_between_4_and_15{ "id_pin_has_to_be_between_4_and_15" };
+        // PINs do not match, please try again.
+        inline constexpr std::string_view id_pins_do_not_match_please_try{ "id_pins_do_not_match_please_try" };
+        // Please activate at least one fingerprint in Android settings in order to use biometric login
+        inline constexpr std::string_view id_please_activate_at_least_one{ "id_please_activate_at_least_one" };
+        // Please contribute if you find Blockstream Green useful
+        inline constexpr std::string_view id_please_contribute_if_you_find{ "id_please_contribute_if_you_find" };
+        // Please disable biometric authentication before deleting PIN
+        inline constexpr std::string_view id_please_disable_biometric{ "id_please_disable_biometric" };
+        // Please disconnect your Ledger Nano X, power it off by long-pressing both buttons, then reconnect it and enter
+        // its PIN
+        inline constexpr std::string_view id_please_disconnect_your_ledger{ "id_please_disconnect_your_ledger" };
+        // Please enable another authentication method to avoid losing access to your funds.
+        inline constexpr std::string_view id_please_enable_another{ "id_please_enable_another" };
+        // Please enable camera permissions to use the camera.
+        inline constexpr std::string_view id_please_enable_camera{ "id_please_enable_camera" };
+        // Please enable PIN authentication before adding or removing biometric authentication
+        inline constexpr std::string_view id_please_enable_pin{ "id_please_enable_pin" };
+        // Please enter the passphrase for your hardware wallet.
+        inline constexpr std::string_view id_please_enter_the_passphrase_for{ "id_please_enter_the_passphrase_for" };
+        // Please follow the instructions on your hardware wallet
+        inline constexpr std::string_view id_please_follow_the_instructions{ "id_please_follow_the_instructions" };
+        // Please hold on while your address is being generated
+        inline constexpr std::string_view id_please_hold_on_while_your{ "id_please_hold_on_while_your" };
+        // Please provide your %1$s.
+        inline constexpr std::string_view id_please_provide_your_1s{ "id_please_provide_your_1s" };
+        // Please provide your %1$s code.
+        inline constexpr std::string_view id_please_provide_your_1s_code{ "id_please_provide_your_1s_code" };
+        // Please provide your passphrase:
+        inline constexpr std::string_view id_please_provide_your_passphrase{ "id_please_provide_your_passphrase" };
+        // Please re-connect your hardware wallet before trying again.
+        inline constexpr std::string_view id_please_reconnect_your_hardware{ "id_please_reconnect_your_hardware" };
+        // Please secure your mnemonic and confirm you agree to the Terms of Service
+        inline constexpr std::string_view id_please_secure_your_mnemonic_and{ "id_please_secure_your_mnemonic_and" };
+        // Please select the checkbox
+        inline constexpr std::string_view id_please_select_the_checkbox{ "id_please_select_the_checkbox" };
+        // Please set and enable SOCKS5 proxy and port to use Tor
+        inline constexpr std::string_view id_please_set_and_enable_socks5{ "id_please_set_and_enable_socks5" };
+        inline constexpr std::string_view id_please_tap_card{ "id_please_tap_card" }; // Please tap card
+        // Please verify that the address shown on your hardware wallet matches the one on your phone.
+        inline constexpr std::string_view id_please_verify_that_the_address{ "id_please_verify_that_the_address" };
+        // Please verify that this address matches the one displayed on your hardware device.
+        inline constexpr std::string_view id_please_verify_that_this_address{ "id_please_verify_that_this_address" };
+        // Please wait until your Ledger displays the address to validate it. This could take up to 20 seconds.
+        inline constexpr std::string_view id_please_wait_until_your_ledger{ "id_please_wait_until_your_ledger" };
+        inline constexpr std::string_view id_power_on_jade{ "id_power_on_jade" }; // Power on Jade
+        inline constexpr std::string_view id_precision{ "id_precision" }; // Precision
+        inline constexpr std::string_view id_previous_fee{ "id_previous_fee" }; // Previous fee
+        inline constexpr std::string_view id_price_feed{ "id_price_feed" }; // Price Feed
+        // Print Backup Template
+        inline constexpr std::string_view id_print_backup_template{ "id_print_backup_template" };
+        inline constexpr std::string_view id_privacy_policy{ "id_privacy_policy" }; // Privacy Policy
+        // Private, but less stable connection
+        inline constexpr std::string_view id_private_but_less_stable{ "id_private_but_less_stable" };
+        inline constexpr std::string_view id_private_key{ "id_private_key" }; // Private Key
+        inline constexpr std::string_view id_problem_with_key_1s{ "id_problem_with_key_1s" }; // Problem with key %1$s
+        // Protect your bitcoin with a second form of verification
+        inline constexpr std::string_view id_protect_your_bitcoin_with_a{ "id_protect_your_bitcoin_with_a" };
+        // Provide this ID to the asset issuer if requested.
+        inline constexpr std::string_view id_provide_this_id_to_the_asset{ "id_provide_this_id_to_the_asset" };
+        // Provide your AMP ID to the asset issuer if requested.
+        inline constexpr std::string_view id_provide_your_amp_id_to_the{ "id_provide_your_amp_id_to_the" };
+        inline constexpr std::string_view id_proxy_host{ "id_proxy_host" }; // Proxy host
+        inline constexpr std::string_view id_proxy_port{ "id_proxy_port" }; // Proxy port
+        inline constexpr std::string_view id_proxy_settings{ "id_proxy_settings" }; // PROXY SETTINGS
+        // Pseudonymous identifier, country
+        inline constexpr std::string_view id_pseudonymous_identifier_country{ "id_pseudonymous_identifier_country" };
+        inline constexpr std::string_view id_qr_code{ "id_qr_code" }; // QR Code
+        inline constexpr std::string_view id_qr_scanner{ "id_qr_scanner" }; // QR Scanner
+        // Quick setup 2FA account, ideal for active spenders (2FA expires if you don\'t move funds for 1 year).
+        inline constexpr std::string_view id_quick_setup_2fa_account_ideal{ "id_quick_setup_2fa_account_ideal" };
+        inline constexpr std::string_view id_radio_firmware{ "id_radio_firmware" }; // Radio firmware
+        inline constexpr std::string_view id_rate{ "id_rate" }; // Rate
+        inline constexpr std::string_view id_rate_us{ "id_rate_us" }; // Rate us
+        inline constexpr std::string_view id_rate_your_experience{ "id_rate_your_experience" }; // Rate your experience
+        inline constexpr std::string_view id_read_more{ "id_read_more" }; // Read more
+        inline constexpr std::string_view id_read_more_at_our_s{ "id_read_more_at_our_s" }; // Read more at our %s
+        inline constexpr std::string_view id_ready{ "id_ready" }; // Ready
+        inline constexpr std::string_view id_ready_to_start{ "id_ready_to_start" }; // Ready to start
+        inline constexpr std::string_view id_receive{ "id_receive" }; // Receive
+        // Receive any Liquid Asset
+        inline constexpr std::string_view id_receive_any_liquid_asset{ "id_receive_any_liquid_asset" };
+        // Receive email notifications for sent and received transactions
+        inline constexpr std::string_view id_receive_email_notifications_for{ "id_receive_email_notifications_for" };
+        inline constexpr std::string_view id_received{ "id_received" }; // Received
+        inline constexpr std::string_view id_received_on{ "id_received_on" }; // Received on
+        inline constexpr std::string_view id_receiving{ "id_receiving" }; // Receiving
+        // Recently used wallets
+        inline constexpr std::string_view id_recently_used_wallets{ "id_recently_used_wallets" };
+        inline constexpr std::string_view id_recipient{ "id_recipient" }; // Recipient
+        inline constexpr std::string_view id_recipient_address{ "id_recipient_address" }; // Recipient address
+        inline constexpr std::string_view id_recovery{ "id_recovery" }; // Recovery
+        // Recovery and Notifications
+        inline constexpr std::string_view id_recovery_and_notifications{ "id_recovery_and_notifications" };
+        inline constexpr std::string_view id_recovery_key_type{ "id_recovery_key_type" }; // Recovery Key Type
+        inline constexpr std::string_view id_recovery_mnemonic{ "id_recovery_mnemonic" }; // Recovery mnemonic
+        inline constexpr std::string_view id_recovery_phrase{ "id_recovery_phrase" }; // Recovery Phrase
+        // Recovery Phrase Check
+        inline constexpr std::string_view id_recovery_phrase_check{ "id_recovery_phrase_check" };
+        // Recovery phrase length
+        inline constexpr std::string_view id_recovery_phrase_length{ "id_recovery_phrase_length" };
+        // Recovery phrases, key material, addresses, balances
+        inline constexpr std::string_view id_recovery_phrases_key_material{ "id_recovery_phrases_key_material" };
+        inline constexpr std::string_view id_recovery_tool{ "id_recovery_tool" }; // Recovery Tool
+        // Recovery transaction emails
+        inline constexpr std::string_view id_recovery_transaction_emails{ "id_recovery_transaction_emails" };
+        // Recovery transaction request sent
+        inline constexpr std::string_view id_recovery_transaction_request{ "id_recovery_transaction_request" };
+        // Recovery transactions
+        inline constexpr std::string_view id_recovery_transactions{ "id_recovery_transactions" };
+        inline constexpr std::string_view id_recovery_words{ "id_recovery_words" }; // Recovery words
+        inline constexpr std::string_view id_recovery_xpub{ "id_recovery_xpub" }; // Recovery xpub
+        inline constexpr std::string_view id_redeem{ "id_redeem" }; // Redeem
+        // Redeem your deposited funds without Blockstream Green signature after a pre-defined period of time.
+        inline constexpr std::string_view id_redeem_your_deposited_funds{ "id_redeem_your_deposited_funds" };
+        inline constexpr std::string_view id_redeposited{ "id_redeposited" }; // Redeposited
+        // Reference exchange rate
+        inline constexpr std::string_view id_reference_exchange_rate{ "id_reference_exchange_rate" };
+        inline constexpr std::string_view id_refresh{ "id_refresh" }; // Refresh
+        inline constexpr std::string_view id_refund{ "id_refund" }; // Refund
+        inline constexpr std::string_view id_refund_in_progress{ "id_refund_in_progress" }; // Refund in progress
+        inline constexpr std::string_view id_refund_initiated{ "id_refund_initiated" }; // Refund initiated
+        inline constexpr std::string_view id_refundable{ "id_refundable" }; // Refundable
+        inline constexpr std::string_view id_reload{ "id_reload" }; // Reload
+        inline constexpr std::string_view id_remember_device{ "id_remember_device" }; // Remember device
+        // Remember device connection
+        inline constexpr std::string_view id_remember_device_connection{ "id_remember_device_connection" };
+        inline constexpr std::string_view id_remember_me{ "id_remember_me" }; // Remember me
+        inline constexpr std::string_view id_remember_my_device{ "id_remember_my_device" }; // Remember my Device
+        inline constexpr std::string_view id_remove{ "id_remove" }; // Remove
+        // Remove custom network
+        inline constexpr std::string_view id_remove_custom_network{ "id_remove_custom_network" };
+        inline constexpr std::string_view id_remove_wallet{ "id_remove_wallet" }; // Remove wallet
+        inline constexpr std::string_view id_rename{ "id_rename" }; // Rename
+        inline constexpr std::string_view id_rename_account{ "id_rename_account" }; // Rename account
+        inline constexpr std::string_view id_rename_wallet{ "id_rename_wallet" }; // Rename wallet
+        inline constexpr std::string_view id_replaceable{ "id_replaceable" }; // replaceable
+        inline constexpr std::string_view id_report{ "id_report" }; // Report
+        inline constexpr std::string_view id_request_amount{ "id_request_amount" }; // Request Amount
+        inline constexpr std::string_view id_request_failed{ "id_request_failed" }; // Request Failed
+        // Request recovery transactions
+        inline constexpr std::string_view id_request_recovery_transactions{ "id_request_recovery_transactions" };
+        inline constexpr std::string_view id_request_sent{ "id_request_sent" }; // Request Sent
+        // Request Two-Factor reset
+        inline constexpr std::string_view id_request_twofactor_reset{ "id_request_twofactor_reset" };
+        // Requested fee rate too low
+        inline constexpr std::string_view id_requested_fee_rate_too_low{ "id_requested_fee_rate_too_low" };
+        inline constexpr std::string_view id_reset{ "id_reset" }; // Reset
+        inline constexpr std::string_view id_reset_spv{ "id_reset_spv" }; // Reset SPV
+        // Resetting your Two-Factor takes 12 months minimum. If you are sure you have lost your Two-Factor, please
+        // provide a new email address below to receive the reset.
+        inline constexpr std::string_view id_resetting_your_twofactor_takes{ "id_resetting_your_twofactor_takes" };
+        inline constexpr std::string_view id_restore{ "id_restore" }; // Restore
+        // Restore a Blockstream Green wallet using your 24 words mnemonic backup. You can find it in the settings of
+        // any Blockstream Green app.
+        inline constexpr std::string_view id_restore_a_blockstream_green{ "id_restore_a_blockstream_green" };
+        // Restore a Singlesig wallet created on Blockstream Green, or import a wallet created with other apps. This
+        // option only works with singlesig wallets using BIP39 mnemonics, and following the BIP44, BIP49, or BIP84
+        // derivations.
+        inline constexpr std::string_view id_restore_a_singlesig_wallet{ "id_restore_a_singlesig_wallet" };
+        inline constexpr std::string_view id_restore_a_wallet{ "id_restore_a_wallet" }; // Restore a Wallet
+        inline constexpr std::string_view id_restore_green_wallet{ "id_restore_green_wallet" }; // Restore Green Wallet
+        // Restore temporary wallet
+        inline constexpr std::string_view id_restore_temporary_wallet{ "id_restore_temporary_wallet" };
+        inline constexpr std::string_view id_restore_wallet{ "id_restore_wallet" }; // Restore Wallet
+        // Restore with recovery phrase
+        inline constexpr std::string_view id_restore_with_recovery_phrase{ "id_restore_with_recovery_phrase" };
+        // Restoring Your Wallet
+        inline constexpr std::string_view id_restoring_your_wallet{ "id_restoring_your_wallet" };
+        inline constexpr std::string_view id_review{ "id_review" }; // Review
+        // Review account information
+        inline constexpr std::string_view id_review_account_information{ "id_review_account_information" };
+        inline constexpr std::string_view id_review_output_s{ "id_review_output_s" }; // Review output %s
+        inline constexpr std::string_view id_s_blocks_left{ "id_s_blocks_left" }; // %s blocks left
+        inline constexpr std::string_view id_s_from_s{ "id_s_from_s" }; // %s from %s
+        // %s is a Liquid asset. You can receive it directly on any Liquid account.
+        inline constexpr std::string_view id_s_is_a_liquid_asset_you_can{ "id_s_is_a_liquid_asset_you_can" };
+        // %s is a Liquid asset. You need a Liquid account in order to receive it.
+        inline constexpr std::string_view id_s_is_a_liquid_asset_you_need_a{ "id_s_is_a_liquid_asset_you_need_a" };
+        // %s is an AMP asset. You can receive it directly on any AMP account.
+        inline constexpr std::string_view id_s_is_an_amp_asset_you_can{ "id_s_is_an_amp_asset_you_can" };
+        // %s is an AMP asset. You need an AMP account in order to receive it.
+        inline constexpr std::string_view id_s_is_an_amp_asset_you_need_an{ "id_s_is_an_amp_asset_you_need_an" };
+        inline constexpr std::string_view id_s_network{ "id_s_network" }; // %s network
+        // %s will send you the funds, it can take some time.\n\nKeep the app online.
+        inline constexpr std::string_view id_s_will_send_you_the_funds_it{ "id_s_will_send_you_the_funds_it" };
+        inline constexpr std::string_view id_safe_environment{ "id_safe_environment" }; // Safe Environment
+        inline constexpr std::string_view id_safely_stored{ "id_safely_stored" }; // Safely stored
+        inline constexpr std::string_view id_save{ "id_save" }; // Save
+        // Save a summary of your accounts to speed up recovery in case you need to use our recovery tool.
+        inline constexpr std::string_view id_save_a_summary_of_your_accounts{ "id_save_a_summary_of_your_accounts" };
+        inline constexpr std::string_view id_save_your_mnemonic{ "id_save_your_mnemonic" }; // Save your mnemonic
+        inline constexpr std::string_view id_scan_a_proposal{ "id_scan_a_proposal" }; // Scan a Proposal
+        // Scan a QR code for SPV pairing
+        inline constexpr std::string_view id_scan_a_qr_code_for_spv_pairing{ "id_scan_a_qr_code_for_spv_pairing" };
+        inline constexpr std::string_view id_scan_from_image{ "id_scan_from_image" }; // Scan from Image
+        // Scan or paste your extended public key (xPub/yPub/zPub) to log in to your watch-only-wallet.
+        inline constexpr std::string_view id_scan_or_paste_your_extended{ "id_scan_or_paste_your_extended" };
+        // Scan or paste your public descriptor to log in to your watch-only account.
+        inline constexpr std::string_view id_scan_or_paste_your_public{ "id_scan_or_paste_your_public" };
+        inline constexpr std::string_view id_scan_qr_code{ "id_scan_qr_code" }; // Scan QR code
+        // Scan the QR Code with an Authenticator app
+        inline constexpr std::string_view id_scan_the_qr_code_with_an{ "id_scan_the_qr_code_with_an" };
+        inline constexpr std::string_view id_scan_to_send_here{ "id_scan_to_send_here" }; // Scan to send here
+        inline constexpr std::string_view id_screen_lock{ "id_screen_lock" }; // Screen Lock
+        inline constexpr std::string_view id_search{ "id_search" }; // Search
+        inline constexpr std::string_view id_search_address{ "id_search_address" }; // Search address
+        inline constexpr std::string_view id_second{ "id_second" }; // second
+        inline constexpr std::string_view id_seconds{ "id_seconds" }; // seconds
+        inline constexpr std::string_view id_security{ "id_security" }; // Security
+        inline constexpr std::string_view id_security_change{ "id_security_change" }; // Security Change
+        // See Archived Accounts (%s)
+        inline constexpr std::string_view id_see_archived_accounts_s{ "id_see_archived_accounts_s" };
+        // See our privacy policy %s
+        inline constexpr std::string_view id_see_our_privacy_policy_s{ "id_see_our_privacy_policy_s" };
+        // See our Terms of Service %s
+        inline constexpr std::string_view id_see_our_terms_of_service_s{ "id_see_our_terms_of_service_s" };
+        inline constexpr std::string_view id_segwit{ "id_segwit" }; // SegWit
+        inline constexpr std::string_view id_segwit_account{ "id_segwit_account" }; // SegWit Account
+        inline constexpr std::string_view id_segwit_bip84{ "id_segwit_bip84" }; // SegWit (BIP84)
+        // Select a fiat currency and bitcoin denomination to show amounts in your wallet
+        inline constexpr std::string_view id_select_a_fiat_currency_and{ "id_select_a_fiat_currency_and" };
+        inline constexpr std::string_view id_select_account{ "id_select_account" }; // Select Account
+        inline constexpr std::string_view id_select_an_app_on_s{ "id_select_an_app_on_s" }; // Select an app on %s
+        inline constexpr std::string_view id_select_asset{ "id_select_asset" }; // Select asset
+        // Select duration of Two-Factor Authentication protection for your coins. The new option applies to newly
+        // received coins.
+        inline constexpr std::string_view id_select_duration_of_twofactor{ "id_select_duration_of_twofactor" };
+        // Select Initalize to create a New Wallet then backup and verify your recovery phrase
+        inline constexpr std::string_view id_select_initalize_to_create_a{ "id_select_initalize_to_create_a" };
+        // Select Initialize and choose to create a New wallet
+        inline constexpr std::string_view id_select_initialize_and_choose_to{ "id_select_initialize_and_choose_to" };
+        inline constexpr std::string_view id_select_network{ "id_select_network" }; // Select network
+        // Select the %s app on your Ledger and retry.
+        inline constexpr std::string_view id_select_the_s_app_on_your_ledger{ "id_select_the_s_app_on_your_ledger" };
+        inline constexpr std::string_view id_select_wallet{ "id_select_wallet" }; // Select Wallet
+        // Select Watch-only type
+        inline constexpr std::string_view id_select_watchonly_type{ "id_select_watchonly_type" };
+        inline constexpr std::string_view id_select_word_number_d{ "id_select_word_number_d" }; // Select word number %d
+        inline constexpr std::string_view id_select_your_coins{ "id_select_your_coins" }; // Select Your Coins
+        // Select your Jade to login
+        inline constexpr std::string_view id_select_your_jade_to_login{ "id_select_your_jade_to_login" };
+        // Select your recovery key
+        inline constexpr std::string_view id_select_your_recovery_key{ "id_select_your_recovery_key" };
+        inline constexpr std::string_view id_send{ "id_send" }; // Send
+        inline constexpr std::string_view id_send_all{ "id_send_all" }; // Send all
+        inline constexpr std::string_view id_send_all_funds{ "id_send_all_funds" }; // Send All Funds
+        // Send All requires a single recipient
+        inline constexpr std::string_view id_send_all_requires_a_single{ "id_send_all_requires_a_single" };
+        // Send and receive Liquid-based Managed Assets
+        inline constexpr std::string_view id_send_and_receive_liquidbased{ "id_send_and_receive_liquidbased" };
+        inline constexpr std::string_view id_send_error_report{ "id_send_error_report" }; // Send error report
+        // Send more than %s and up to %s to this address. A setup fee of %s with a minimum of %s will be applied on the
+        // received amount.\n\nThis address can be used only once.
+        inline constexpr std::string_view id_send_more_than_s_and_up_to_s_to{ "id_send_more_than_s_and_up_to_s_to" };
+        inline constexpr std::string_view id_send_to{ "id_send_to" }; // Send To
+        inline constexpr std::string_view id_sending{ "id_sending" }; // Sending
+        inline constexpr std::string_view id_sending_request{ "id_sending_request" }; // Sending Request…
+        // Sensitive Information
+        inline constexpr std::string_view id_sensitive_information{ "id_sensitive_information" };
+        inline constexpr std::string_view id_sent{ "id_sent" }; // Sent
+        inline constexpr std::string_view id_sent_to{ "id_sent_to" }; // Sent to
+        // Server IP and port (ip:port)
+        inline constexpr std::string_view id_server_ip_and_port_ipport{ "id_server_ip_and_port_ipport" };
+        inline constexpr std::string_view id_set_2fa_expiry{ "id_set_2fa_expiry" }; // Set 2FA expiry
+        // Set a limit to spend without two-factor authentication
+        inline constexpr std::string_view id_set_a_limit_to_spend_without{ "id_set_a_limit_to_spend_without" };
+        inline constexpr std::string_view id_set_a_new_pin{ "id_set_a_new_pin" }; // Set a new PIN
+        inline constexpr std::string_view id_set_a_pin{ "id_set_a_pin" }; // Set a PIN
+        // Set a timeout to logout after prolonged inactivity
+        inline constexpr std::string_view id_set_a_timeout_to_logout_after{ "id_set_a_timeout_to_logout_after" };
+        // Set an email address to receive transaction notifications
+        inline constexpr std::string_view id_set_an_email_address_to_receive{ "id_set_an_email_address_to_receive" };
+        // Set an email for recovery
+        inline constexpr std::string_view id_set_an_email_for_recovery{ "id_set_an_email_for_recovery" };
+        inline constexpr std::string_view id_set_custom_fee_rate{ "id_set_custom_fee_rate" }; // Set custom fee rate
+        inline constexpr std::string_view id_set_locktime{ "id_set_locktime" }; // Set Locktime
+        inline constexpr std::string_view id_set_timelock{ "id_set_timelock" }; // Set timelock
+        // Set Two-Factor threshold
+        inline constexpr std::string_view id_set_twofactor_threshold{ "id_set_twofactor_threshold" };
+        // Set up a passcode for your iOS device to set a PIN for Blockstream Green
+        inline constexpr std::string_view id_set_up_a_passcode_for_your_ios{ "id_set_up_a_passcode_for_your_ios" };
+        // Set up a screen lock for your Android device to unlock your wallet using Android screen lock
+        inline constexpr std::string_view id_set_up_a_screen_lock_for_your{ "id_set_up_a_screen_lock_for_your" };
+        // Set up an email to get pre-signed transactions for recovery. Email notifications contain your encrypted
+        // recovery data.
+        inline constexpr std::string_view id_set_up_an_email_to_get{ "id_set_up_an_email_to_get" };
+        // Set up credentials to access in watch-only mode to receive coins without putting your private keys at risk.
+        // Access from any device using a Blockstream Green app
+        inline constexpr std::string_view id_set_up_credentials_to_access_in{ "id_set_up_credentials_to_access_in" };
+        // Set up PGP key for communications
+        inline constexpr std::string_view id_set_up_pgp_key_for{ "id_set_up_pgp_key_for" };
+        // Set up Two-Factor authentication
+        inline constexpr std::string_view id_set_up_twofactor_authentication{ "id_set_up_twofactor_authentication" };
+        inline constexpr std::string_view id_set_up_watchonly{ "id_set_up_watchonly" }; // Set up watch-only
+        // Set up watch-only credentials for this wallet
+        inline constexpr std::string_view id_set_up_watchonly_credentials{ "id_set_up_watchonly_credentials" };
+        inline constexpr std::string_view id_set_wallet_name{ "id_set_wallet_name" }; // Set wallet name
+        // Setting Up Your Wallet
+        inline constexpr std::string_view id_setting_up_your_wallet{ "id_setting_up_your_wallet" };
+        inline constexpr std::string_view id_setting_updated{ "id_setting_updated" }; // Setting updated
+        inline constexpr std::string_view id_settings{ "id_settings" }; // Settings
+        inline constexpr std::string_view id_setup_2fa_now{ "id_setup_2fa_now" }; // Setup 2FA Now
+        inline constexpr std::string_view id_setup_a_new_wallet{ "id_setup_a_new_wallet" }; // Setup a New Wallet
+        inline constexpr std::string_view id_setup_guide{ "id_setup_guide" }; // Setup Guide
+        inline constexpr std::string_view id_setup_jade{ "id_setup_jade" }; // Setup Jade
+        inline constexpr std::string_view id_setup_pin{ "id_setup_pin" }; // Setup PIN
+        inline constexpr std::string_view id_setup_pin_and_s{ "id_setup_pin_and_s" }; // Setup PIN and %s
+        inline constexpr std::string_view id_setup_your_jade{ "id_setup_your_jade" }; // Setup your Jade
+        inline constexpr std::string_view id_share{ "id_share" }; // Share
+        inline constexpr std::string_view id_share_address{ "id_share_address" }; // Share Address
+        // Share non-confidential transaction
+        inline constexpr std::string_view id_share_nonconfidential{ "id_share_nonconfidential" };
+        // Share unblinding data
+        inline constexpr std::string_view id_share_unblinding_data{ "id_share_unblinding_data" };
+        inline constexpr std::string_view id_show{ "id_show" }; // Show
+        inline constexpr std::string_view id_show_address{ "id_show_address" }; // Show Address
+        // Show advanced options
+        inline constexpr std::string_view id_show_advanced_options{ "id_show_advanced_options" };
+        inline constexpr std::string_view id_show_all{ "id_show_all" }; // Show all
+        inline constexpr std::string_view id_show_all_assets{ "id_show_all_assets" }; // Show all assets
+        // Show bitcoin amounts in
+        inline constexpr std::string_view id_show_bitcoin_amounts_in{ "id_show_bitcoin_amounts_in" };
+        // Show coins with expiring Two-Factor authentication protection.
+        inline constexpr std::string_view id_show_coins_with_expiring{ "id_show_coins_with_expiring" };
+        inline constexpr std::string_view id_show_details{ "id_show_details" }; // Show details
+        inline constexpr std::string_view id_show_fiat{ "id_show_fiat" }; // Show fiat
+        // Show Lightning Invoice
+        inline constexpr std::string_view id_show_lightning_invoice{ "id_show_lightning_invoice" };
+        // Show my wallet backup
+        inline constexpr std::string_view id_show_my_wallet_backup{ "id_show_my_wallet_backup" };
+        inline constexpr std::string_view id_show_onchain_address{ "id_show_onchain_address" }; // Show Onchain Address
+        inline constexpr std::string_view id_show_qr_code{ "id_show_qr_code" }; // Show QR code
+        inline constexpr std::string_view id_show_recovery_phrase{ "id_show_recovery_phrase" }; // Show Recovery Phrase
+        inline constexpr std::string_view id_sign_message{ "id_sign_message" }; // Sign message
+        inline constexpr std::string_view id_sign_transaction{ "id_sign_transaction" }; // Sign Transaction
+        // Signature validation failed. If this error is unexpected and has happened repeatedly, it is possible the
+        // hardware wallet is faulty or has been compromised. It could be leaking your keys, which could lead to loss of
+        // funds. Please consider replacing the hardware wallet.
+        inline constexpr std::string_view id_signature_validation_failed_if{ "id_signature_validation_failed_if" };
+        inline constexpr std::string_view id_signup_in_progress{ "id_signup_in_progress" }; // Signup in progress
+        inline constexpr std::string_view id_simple{ "id_simple" }; // Simple
+        // Simple & Secure Self-Custody
+        inline constexpr std::string_view id_simple__secure_selfcustody{ "id_simple__secure_selfcustody" };
+        // Simple, portable, standard singlesig account, secured by your key, the recovery phrase.
+        inline constexpr std::string_view id_simple_portable_standard{ "id_simple_portable_standard" };
+        // Simplified Payment Verification verifies your transactions and balance using the Bitcoin network, outside of
+        // Green\'s servers. Enabling adds bandwidth and processing requirements
+        inline constexpr std::string_view id_simplified_payment_verification{ "id_simplified_payment_verification" };
+        inline constexpr std::string_view id_singlesig{ "id_singlesig" }; // Singlesig
+        // Singlesig wallets are not yet supported for use with hardware devices. By continuing you\'ll access a
+        // Multisig Shield wallet.
+        inline constexpr std::string_view id_singlesig_wallets_are_not_yet{ "id_singlesig_wallets_are_not_yet" };
+        inline constexpr std::string_view id_skip{ "id_skip" }; // Skip
+        // Skip (Not Recommended)
+        inline constexpr std::string_view id_skip_not_recommended{ "id_skip_not_recommended" };
+        inline constexpr std::string_view id_slide_to_send{ "id_slide_to_send" }; // Slide to Send
+        inline constexpr std::string_view id_slow{ "id_slow" }; // Slow
+        inline constexpr std::string_view id_sms{ "id_sms" }; // SMS
+        // %s.\n\nReset this setting and then re-activate it.
+        inline constexpr std::string_view id_snnreset_this_setting_and_then{ "id_snnreset_this_setting_and_then" };
+        inline constexpr std::string_view id_socks5_hostname{ "id_socks5_hostname" }; // Socks5 Hostname
+        inline constexpr std::string_view id_socks5_port{ "id_socks5_port" }; // Socks5 Port
+        // SOCKS5 proxy and port must be set
+        inline constexpr std::string_view id_socks5_proxy_and_port_must_be{ "id_socks5_proxy_and_port_must_be" };
+        inline constexpr std::string_view id_something_went_wrong{ "id_something_went_wrong" }; // Something went wrong
+        // Spend your bitcoin without 2FA up to a certain threshold. After spending bitcoin up to this amount, you will
+        // need to reset your threshold to continue spending without 2FA.
+        inline constexpr std::string_view id_spend_your_bitcoin_without_2fa{ "id_spend_your_bitcoin_without_2fa" };
+        // SPV is always synchronized on non-mobile networks like WiFi or Ethernet. This setting also synchronizes when
+        // using mobile data. This can be expensive depending on your data plan so take care when enabling.
+        inline constexpr std::string_view id_spv_is_always_synchronized_on{ "id_spv_is_always_synchronized_on" };
+        // SPV mode is currently available for singlesig bitcoin wallets only.
+        inline constexpr std::string_view id_spv_mode_is_currently_available{ "id_spv_mode_is_currently_available" };
+        inline constexpr std::string_view id_spv_not_fully_synced{ "id_spv_not_fully_synced" }; // SPV not fully synced
+        inline constexpr std::string_view id_spv_notifications{ "id_spv_notifications" }; // SPV notifications
+        // SPV reset and restarted
+        inline constexpr std::string_view id_spv_reset_and_restarted{ "id_spv_reset_and_restarted" };
+        inline constexpr std::string_view id_spv_synchronization{ "id_spv_synchronization" }; // SPV synchronization
+        // SPV synchronization using Tor requires a trusted node onion URL
+        inline constexpr std::string_view id_spv_synchronization_using_tor{ "id_spv_synchronization_using_tor" };
+        inline constexpr std::string_view id_spv_unverified{ "id_spv_unverified" }; // SPV unverified
+        inline constexpr std::string_view id_spv_verification{ "id_spv_verification" }; // SPV verification
+        inline constexpr std::string_view id_standard{ "id_standard" }; // Standard
+        inline constexpr std::string_view id_standard_account{ "id_standard_account" }; // Standard Account
+        // Standard accounts allow you to separate your funds. Each account will have its own receiving addresses, and
+        // moving funds across accounts requires a transaction.
+        inline constexpr std::string_view id_standard_accounts_allow_you_to{ "id_standard_accounts_allow_you_to" };
+        inline constexpr std::string_view id_standard_wallet{ "id_standard_wallet" }; // Standard Wallet
+        // Start a 2FA reset process if you lost access to all your two-factor authentication methods.
+        inline constexpr std::string_view id_start_a_2fa_reset_process_if{ "id_start_a_2fa_reset_process_if" };
+        // Start receiving funds and set an email to receive recovery data for your wallet
+        inline constexpr std::string_view id_start_receiving_funds_and_set{ "id_start_receiving_funds_and_set" };
+        inline constexpr std::string_view id_status{ "id_status" }; // Status
+        inline constexpr std::string_view id_step{ "id_step" }; // Step
+        // Store it somewhere safe.
+        inline constexpr std::string_view id_store_it_somewhere_safe{ "id_store_it_somewhere_safe" };
+        inline constexpr std::string_view id_submit{ "id_submit" }; // Submit
+        inline constexpr std::string_view id_success{ "id_success" }; // Success
+        // Successfully sent your funds
+        inline constexpr std::string_view id_successfully_sent_your_funds{ "id_successfully_sent_your_funds" };
+        inline constexpr std::string_view id_support{ "id_support" }; // Support
+        inline constexpr std::string_view id_support_page{ "id_support_page" }; // Support Page
+        inline constexpr std::string_view id_swap{ "id_swap" }; // Swap
+        inline constexpr std::string_view id_swap_is_in_progress{ "id_swap_is_in_progress" }; // Swap is in progress
+        inline constexpr std::string_view id_swap_proposal{ "id_swap_proposal" }; // Swap Proposal
+        inline constexpr std::string_view id_swapped{ "id_swapped" }; // Swapped
+        inline constexpr std::string_view id_sweep{ "id_sweep" }; // Sweep
+        // Sweep From Paper Wallet
+        inline constexpr std::string_view id_sweep_from_paper_wallet{ "id_sweep_from_paper_wallet" };
+        inline constexpr std::string_view id_sweep_into_s{ "id_sweep_into_s" }; // Sweep into %s
+        inline constexpr std::string_view id_switch_network{ "id_switch_network" }; // Switch Network
+        // Synchronize SPV on mobile
+        inline constexpr std::string_view id_synchronize_spv_on_mobile{ "id_synchronize_spv_on_mobile" };
+        // %s.You need to:\n1. Reset Green\'s Face/TouchID login,\n2. Log in with PIN,\n3. Re-activate Face/TouchID from
+        // Green Settings.
+        inline constexpr std::string_view id_syou_need_ton1_reset_greens{ "id_syou_need_ton1_reset_greens" };
+        inline constexpr std::string_view id_system_location{ "id_system_location" }; // System location
+        inline constexpr std::string_view id_system_message{ "id_system_message" }; // System Message
+        // Take Control: Your Keys, Your Bitcoin
+        inline constexpr std::string_view id_take_control_your_keys_your{ "id_take_control_your_keys_your" };
+        // Tap on the card to view transactions.
+        inline constexpr std::string_view id_tap_on_the_card_to_view{ "id_tap_on_the_card_to_view" };
+        // Tap to restart the Simplified Payment Verification
+        inline constexpr std::string_view id_tap_to_restart_the_simplified{ "id_tap_to_restart_the_simplified" };
+        // Tap to scan a QR code and connect to a node for SPV
+        inline constexpr std::string_view id_tap_to_scan_a_qr_code_and{ "id_tap_to_scan_a_qr_code_and" };
+        inline constexpr std::string_view id_taproot{ "id_taproot" }; // Taproot
+        inline constexpr std::string_view id_taproot_account{ "id_taproot_account" }; // Taproot account
+        inline constexpr std::string_view id_taproot_bip86{ "id_taproot_bip86" }; // Taproot (BIP86)
+        inline constexpr std::string_view id_telegram{ "id_telegram" }; // Telegram
+        inline constexpr std::string_view id_terms_of_service{ "id_terms_of_service" }; // Terms of Service
+        inline constexpr std::string_view id_terms_of_use{ "id_terms_of_use" }; // Terms of Use
+        // Testnet and Liquid Testnet
+        inline constexpr std::string_view id_testnet_and_liquid_testnet{ "id_testnet_and_liquid_testnet" };
+        // Testnet Electrum server
+        inline constexpr std::string_view id_testnet_electrum_server{ "id_testnet_electrum_server" };
+        inline constexpr std::string_view id_testnet_wallets{ "id_testnet_wallets" }; // Testnet wallets
+        // Thank you for downloading Green! Please leave us a review when you get a chance
+        inline constexpr std::string_view id_thank_you_for_downloading_green{ "id_thank_you_for_downloading_green" };
+        // Thank you for your feedback
+        inline constexpr std::string_view id_thank_you_for_your_feedback{ "id_thank_you_for_your_feedback" };
+        // The 1 year 2FA reset process was ongoing, but someone blocked it by disputing the 2FA reset.
+        inline constexpr std::string_view id_the_1_year_2fa_reset_process{ "id_the_1_year_2fa_reset_process" };
+        inline constexpr std::string_view id_the_address_is_valid{ "id_the_address_is_valid" }; // The address is valid.
+        // The addresses don\'t match.
+        inline constexpr std::string_view id_the_addresses_dont_match{ "id_the_addresses_dont_match" };
+        // The asset registry is currently unavailable: proceed carefully since asset amounts might be shown with a
+        // decimal precision different from what intended by the issuers.
+        inline constexpr std::string_view id_the_asset_registry_is_currently{ "id_the_asset_registry_is_currently" };
+        // The camera has a problem. You probably need to restart the device.
+        inline constexpr std::string_view id_the_camera_has_a_problem_you{ "id_the_camera_has_a_problem_you" };
+        // The default value is 90 days. If you set an email, you will receive an updated copy of your recovery data.
+        inline constexpr std::string_view id_the_default_value_is_90_days_if{ "id_the_default_value_is_90_days_if" };
+        // the easier, safer and faster wallet
+        inline constexpr std::string_view id_the_easier_safer_and_faster{ "id_the_easier_safer_and_faster" };
+        // The email will also be used to receive recovery data and transaction notifications
+        inline constexpr std::string_view id_the_email_will_also_be_used_to{ "id_the_email_will_also_be_used_to" };
+        // The hardware wallet you are using is not yet supported
+        inline constexpr std::string_view id_the_hardware_wallet_you_are{ "id_the_hardware_wallet_you_are" };
+        // The Importance of Two-Factor Authentication
+        inline constexpr std::string_view id_the_importance_of_twofactor{ "id_the_importance_of_twofactor" };
+        // The Liquid Network is a Bitcoin layer-2 solution enabling the fast, confidential settlement and issuance of
+        // digital assets, such as stablecoins, security tokens, and other financial instruments, on top of the Bitcoin
+        // timechain.
+        inline constexpr std::string_view id_the_liquid_network_is_a_bitcoin{ "id_the_liquid_network_is_a_bitcoin" };
+        // The network selected on the Green app is different from the one selected on the hardware wallet. Select the
+        // same network on both devices.
+        inline constexpr std::string_view id_the_network_selected_on_the{ "id_the_network_selected_on_the" };
+        // The new email will be used for Two-Factor Authentication when the reset is complete. The reset takes 12
+        // months plus any remaining timelock.
+        inline constexpr std::string_view id_the_new_email_will_be_used_for{ "id_the_new_email_will_be_used_for" };
+        // The new firmware requires you to unpair your Jade from the Bluetooth settings.
+        inline constexpr std::string_view id_the_new_firmware_requires_you{ "id_the_new_firmware_requires_you" };
+        // The password can\'t be empty
+        inline constexpr std::string_view id_the_password_cant_be_empty{ "id_the_password_cant_be_empty" };
+        // The QR code does not include the BIP39 Passphrase
+        inline constexpr std::string_view id_the_qr_code_does_not_include{ "id_the_qr_code_does_not_include" };
+        // The recovery key below will not be shown again. Please make a safe backup of it now to ensure you can always
+        // access your funds.
+        inline constexpr std::string_view id_the_recovery_key_below_will_not{ "id_the_recovery_key_below_will_not" };
+        // The recovery phrase can be used to claim your funds at any point. Keep it safe, keep it private.
+        inline constexpr std::string_view id_the_recovery_phrase_can_be_used{ "id_the_recovery_phrase_can_be_used" };
+        // The recovery phrase doesn\'t match the previously existing wallet. Please retry with a different recovery
+        // phrase.
+        inline constexpr std::string_view id_the_recovery_phrase_doesnt{ "id_the_recovery_phrase_doesnt" };
+        // The source code is available at %s
+        inline constexpr std::string_view id_the_source_code_is_available_at{ "id_the_source_code_is_available_at" };
+        // The transaction contains non-confidential funds.
+        inline constexpr std::string_view id_the_transaction_contains{ "id_the_transaction_contains" };
+        // The username can\'t be empty
+        inline constexpr std::string_view id_the_username_cant_be_empty{ "id_the_username_cant_be_empty" };
+        // The waiting period is necessary to ensure the security of your wallet, to prevent thieves from getting around
+        // your Two-Factor protection.
+        inline constexpr std::string_view id_the_waiting_period_is_necessary{ "id_the_waiting_period_is_necessary" };
+        // There are no results for the applied filter
+        inline constexpr std::string_view id_there_are_no_results_for_the{ "id_there_are_no_results_for_the" };
+        // There is already a PIN set for a %s wallet. Proceeding will not allow setting a PIN and login will require
+        // the 24 words mnemonic. You can disable PIN from settings or with 3 failed attempts.
+        inline constexpr std::string_view id_there_is_already_a_pin_set_for{ "id_there_is_already_a_pin_set_for" };
+        // There is already a swap in progress. Only one at a time is allowed
+        inline constexpr std::string_view id_there_is_already_a_swap_in{ "id_there_is_already_a_swap_in" };
+        // There is already an archived account.\n\nDo you want to create a new one?
+        inline constexpr std::string_view id_there_is_already_an_archived{ "id_there_is_already_an_archived" };
+        // These are some compatible wallets:
+        inline constexpr std::string_view id_these_are_some_compatible{ "id_these_are_some_compatible" };
+        // These settings apply for every wallet you use on Blockstream Green.
+        inline constexpr std::string_view id_these_settings_apply_for_every{ "id_these_settings_apply_for_every" };
+        // This amount is below the minimum fee %s (%s).
+        inline constexpr std::string_view id_this_amount_is_below_the{ "id_this_amount_is_below_the" };
+        // This feature is coming soon, stay tuned!
+        inline constexpr std::string_view id_this_feature_is_coming_soon{ "id_this_feature_is_coming_soon" };
+        // This might take up to a minute.\nThanks for your patience!
+        inline constexpr std::string_view id_this_might_take_up_to_a{ "id_this_might_take_up_to_a" };
+        // This signature is a proof of ownership of the address
+        inline constexpr std::string_view id_this_signature_is_a_proof_of{ "id_this_signature_is_a_proof_of" };
+        // This transaction spent non-confidential funds.
+        inline constexpr std::string_view id_this_transaction_spent{ "id_this_transaction_spent" };
+        // This wallet is based on your recovery phrase and a BIP39 Passphrase
+        inline constexpr std::string_view id_this_wallet_is_based_on_your{ "id_this_wallet_is_based_on_your" };
+        // This wallet operates on a test network. Anything you receive or send here has no value
+        inline constexpr std::string_view id_this_wallet_operates_on_a_test{ "id_this_wallet_operates_on_a_test" };
+        // This will disable PIN login for this wallet on all your devices. You will need your recovery phrase to access
+        // your wallet.
+        inline constexpr std::string_view id_this_will_disable_pin_login_for{ "id_this_will_disable_pin_login_for" };
+        // This will log you out and delete this wallet from the app and the Blockstream servers database.
+        inline constexpr std::string_view id_this_will_log_you_out_and{ "id_this_will_log_you_out_and" };
+        inline constexpr std::string_view id_ticker{ "id_ticker" }; // Ticker
+        inline constexpr std::string_view id_time_s{ "id_time_s" }; // Time: %s
+        // Tip: We recommend you enable more than one 2FA method. If you only set up one 2FA method and then lose it,
+        // you\'ll have to wait at least one year until the 2FA expires.
+        inline constexpr std::string_view id_tip_we_recommend_you_enable{ "id_tip_we_recommend_you_enable" };
+        // Tip: You can use the xPub/yPub/zPub to view your watch-only wallet in Green, or you may import it to another
+        // platform. Each account in your wallet has a separate xPub/yPub/zPub.
+        inline constexpr std::string_view id_tip_you_can_use_the{ "id_tip_you_can_use_the" };
+        inline constexpr std::string_view id_to{ "id_to" }; // TO
+        // To authorize the transaction you need to enter your 2FA code.
+        inline constexpr std::string_view id_to_authorize_the_transaction{ "id_to_authorize_the_transaction" };
+        // To keep you in control of your funds, Two-Factor Authentication protection expires after roughly %d days
+        // since your last payment. You will be prompted to make a Two-Factor Reactivation transaction, if you don\'t
+        // move funds often enough.
+        inline constexpr std::string_view id_to_keep_you_in_control_of_your{ "id_to_keep_you_in_control_of_your" };
+        // Too many PIN attempts
+        inline constexpr std::string_view id_too_many_pin_attempts{ "id_too_many_pin_attempts" };
+        inline constexpr std::string_view id_tor{ "id_tor" }; // Tor
+        // Tor Connectivity Disabled!
+        inline constexpr std::string_view id_tor_connectivity_disabled{ "id_tor_connectivity_disabled" };
+        inline constexpr std::string_view id_tor_is_connected{ "id_tor_is_connected" }; // Tor is connected
+        // Tor is not yet available for singlesig wallets
+        inline constexpr std::string_view id_tor_is_not_yet_available_for{ "id_tor_is_not_yet_available_for" };
+        inline constexpr std::string_view id_tor_status{ "id_tor_status" }; // Tor status
+        // Tor will use %1$s and only work if your proxy is Orbot or Tor enabled
+        inline constexpr std::string_view id_tor_will_use_1s_and_only_work{ "id_tor_will_use_1s_and_only_work" };
+        inline constexpr std::string_view id_total{ "id_total" }; // Total
+        inline constexpr std::string_view id_total_assets{ "id_total_assets" }; // Total Assets
+        inline constexpr std::string_view id_total_balance{ "id_total_balance" }; // Total Balance
+        inline constexpr std::string_view id_total_with_fee{ "id_total_with_fee" }; // Total with Fee
+        inline constexpr std::string_view id_touch_id{ "id_touch_id" }; // Touch ID
+        inline constexpr std::string_view id_touch_to_display{ "id_touch_to_display" }; // Touch to display
+        // Touch/Face ID not available
+        inline constexpr std::string_view id_touchface_id_not_available{ "id_touchface_id_not_available" };
+        // Transaction already confirmed
+        inline constexpr std::string_view id_transaction_already_confirmed{ "id_transaction_already_confirmed" };
+        // Transaction copied to clipboard
+        inline constexpr std::string_view id_transaction_copied_to_clipboard{ "id_transaction_copied_to_clipboard" };
+        inline constexpr std::string_view id_transaction_details{ "id_transaction_details" }; // Transaction details
+        inline constexpr std::string_view id_transaction_id{ "id_transaction_id" }; // Transaction ID
+        inline constexpr std::string_view id_transaction_sent{ "id_transaction_sent" }; // Transaction Sent
+        inline constexpr std::string_view id_transaction_status{ "id_transaction_status" }; // Transaction status
+        inline constexpr std::string_view id_transactions{ "id_transactions" }; // Transactions
+        inline constexpr std::string_view id_troubleshoot{ "id_troubleshoot" }; // Troubleshoot
+        inline constexpr std::string_view id_try_again{ "id_try_again" }; // Try Again
+        inline constexpr std::string_view id_try_now{ "id_try_now" }; // Try now
+        // Turn on bluetooth to connect your hardware wallet.
+        inline constexpr std::string_view id_turn_on_bluetooth_to_connect{ "id_turn_on_bluetooth_to_connect" };
+        // TWO FACTOR AUTHENTICATION
+        inline constexpr std::string_view id_two_factor_authentication{ "id_two_factor_authentication" };
+        inline constexpr std::string_view id_twofactor{ "id_twofactor" }; // Two-Factor
+        // Two-Factor authentication
+        inline constexpr std::string_view id_twofactor_authentication{ "id_twofactor_authentication" };
+        // Two-Factor authentication expiry
+        inline constexpr std::string_view id_twofactor_authentication_expiry{ "id_twofactor_authentication_expiry" };
+        // Two-Factor expiration period
+        inline constexpr std::string_view id_twofactor_expiration_period{ "id_twofactor_expiration_period" };
+        // Two-Factor protection does not expire on this account, enable 2 separate Two-Factor methods as backup in case
+        // you lose access to one.
+        inline constexpr std::string_view id_twofactor_protection_does_not{ "id_twofactor_protection_does_not" };
+        // Two-Factor reset in progress, your wallet is currently locked.
+        inline constexpr std::string_view id_twofactor_reset_in_progress{ "id_twofactor_reset_in_progress" };
+        inline constexpr std::string_view id_twofactor_settings{ "id_twofactor_settings" }; // Two-Factor Settings
+        inline constexpr std::string_view id_twofactor_threshold{ "id_twofactor_threshold" }; // Two-Factor threshold
+        inline constexpr std::string_view id_tx_count{ "id_tx_count" }; // TX Count
+        inline constexpr std::string_view id_txid{ "id_txid" }; // TXID
+        inline constexpr std::string_view id_type_the_next_word{ "id_type_the_next_word" }; // Type the next word
+        // Unable to contact the Green service. Please check your network connection and wait to be reconnected.
+        inline constexpr std::string_view id_unable_to_contact_the_green{ "id_unable_to_contact_the_green" };
+        inline constexpr std::string_view id_unarchive{ "id_unarchive" }; // Unarchive
+        inline constexpr std::string_view id_unarchive_account{ "id_unarchive_account" }; // Unarchive account
+        inline constexpr std::string_view id_unblinding_data{ "id_unblinding_data" }; // Unblinding data
+        inline constexpr std::string_view id_unconfirmed{ "id_unconfirmed" }; // Unconfirmed
+        inline constexpr std::string_view id_undo_2fa_dispute{ "id_undo_2fa_dispute" }; // Undo 2FA dispute
+        inline constexpr std::string_view id_unknown{ "id_unknown" }; // Unknown
+        // Unknown bip21 parameter
+        inline constexpr std::string_view id_unknown_bip21_parameter{ "id_unknown_bip21_parameter" };
+        inline constexpr std::string_view id_unknown_custom{ "id_unknown_custom" }; // Unknown (Custom)
+        inline constexpr std::string_view id_unknown_firmware{ "id_unknown_firmware" }; // Unknown firmware
+        inline constexpr std::string_view id_unlock{ "id_unlock" }; // Unlock
+        inline constexpr std::string_view id_unlock_green{ "id_unlock_green" }; // Unlock Green
+        // Unlock Jade to continue
+        inline constexpr std::string_view id_unlock_jade_to_continue{ "id_unlock_jade_to_continue" };
+        // Unlock your Device to continue
+        inline constexpr std::string_view id_unlock_your_device_to_continue{ "id_unlock_your_device_to_continue" };
+        // Unlocked coins can be spent and are included in your balance.
+        inline constexpr std::string_view id_unlocked_coins_can_be_spent_and{ "id_unlocked_coins_can_be_spent_and" };
+        inline constexpr std::string_view id_unlocking_coins{ "id_unlocking_coins" }; // Unlocking coins
+        // Unstable internet connection
+        inline constexpr std::string_view id_unstable_internet_connection{ "id_unstable_internet_connection" };
+        inline constexpr std::string_view id_update{ "id_update" }; // Update
+        inline constexpr std::string_view id_updated{ "id_updated" }; // updated
+        inline constexpr std::string_view id_updating_firmware{ "id_updating_firmware" }; // Updating firmware…
+        inline constexpr std::string_view id_uploading_firmware{ "id_uploading_firmware" }; // Uploading firmware
+        // Use a hardware wallet as your third recovery key.
+        inline constexpr std::string_view id_use_a_hardware_wallet_as_your{ "id_use_a_hardware_wallet_as_your" };
+        inline constexpr std::string_view id_use_a_public_key{ "id_use_a_public_key" }; // Use a public key
+        // Use all available coins
+        inline constexpr std::string_view id_use_all_available_coins{ "id_use_all_available_coins" };
+        // Use an existing recovery phrase as your third recovery key.
+        inline constexpr std::string_view id_use_an_existing_recovery_phrase{ "id_use_an_existing_recovery_phrase" };
+        // Use an xpub for which you own the corresponding private key as your third recovery key.
+        inline constexpr std::string_view id_use_an_xpub_for_which_you_own{ "id_use_an_xpub_for_which_you_own" };
+        // Use Android screen lock to log in
+        inline constexpr std::string_view id_use_android_screen_lock_to_log{ "id_use_android_screen_lock_to_log" };
+        // Use comma separated values or keep scanning
+        inline constexpr std::string_view id_use_comma_separated_values_or{ "id_use_comma_separated_values_or" };
+        inline constexpr std::string_view id_use_hardware_device{ "id_use_hardware_device" }; // Use Hardware Device
+        // Use Secure Display and Screen Lock
+        inline constexpr std::string_view id_use_secure_display_and_screen{ "id_use_secure_display_and_screen" };
+        // Use the jog-wheel to select the word that matches your recovery phrase.
+        inline constexpr std::string_view id_use_the_jogwheel_to_select_the{ "id_use_the_jogwheel_to_select_the" };
+        // Use this recovery phrase to restore your lightning account.\n\nWARNING: This recovery phrase does not restore
+        // all your other bitcoin or liquid accounts.
+        inline constexpr std::string_view id_use_this_recovery_phrase_to{ "id_use_this_recovery_phrase_to" };
+        // Use your email to receive recovery transactions and transactions notifications
+        inline constexpr std::string_view id_use_your_email_to_receive{ "id_use_your_email_to_receive" };
+        // User contact info, IP address, detailed location
+        inline constexpr std::string_view id_user_contact_info_ip_address{ "id_user_contact_info_ip_address" };
+        // User not found or invalid password
+        inline constexpr std::string_view id_user_not_found_or_invalid{ "id_user_not_found_or_invalid" };
+        inline constexpr std::string_view id_username{ "id_username" }; // Username
+        // Username not available
+        inline constexpr std::string_view id_username_not_available{ "id_username_not_available" };
+        // Value must be between 144 and 200000
+        inline constexpr std::string_view id_value_must_be_between_144_and{ "id_value_must_be_between_144_and" };
+        inline constexpr std::string_view id_verified{ "id_verified" }; // Verified
+        inline constexpr std::string_view id_verify{ "id_verify" }; // Verify
+        inline constexpr std::string_view id_verify_on_device{ "id_verify_on_device" }; // Verify on Device
+        // Verify Recovery Phrase
+        inline constexpr std::string_view id_verify_recovery_phrase{ "id_verify_recovery_phrase" };
+        // Verify your bitcoin transactions are included on the blockchain
+        inline constexpr std::string_view id_verify_your_bitcoin{ "id_verify_your_bitcoin" };
+        inline constexpr std::string_view id_verify_your_pin{ "id_verify_your_pin" }; // Verify Your PIN
+        // Verifying transactions…
+        inline constexpr std::string_view id_verifying_transactions{ "id_verifying_transactions" };
+        inline constexpr std::string_view id_version{ "id_version" }; // Version
+        inline constexpr std::string_view id_version_1s{ "id_version_1s" }; // Version: %1$s
+        inline constexpr std::string_view id_version_1s_2s{ "id_version_1s_2s" }; // Version %1$s %2$s
+        inline constexpr std::string_view id_view_account{ "id_view_account" }; // View account
+        // View Archived Accounts
+        inline constexpr std::string_view id_view_archived_accounts{ "id_view_archived_accounts" };
+        // View archived accounts (%d)
+        inline constexpr std::string_view id_view_archived_accounts_d{ "id_view_archived_accounts_d" };
+        inline constexpr std::string_view id_view_in_explorer{ "id_view_in_explorer" }; // View in Explorer
+        inline constexpr std::string_view id_view_more{ "id_view_more" }; // View More
+        // Visit %s for further information about the software
+        inline constexpr std::string_view id_visit_s_for_further_information{ "id_visit_s_for_further_information" };
+        // Visit the Blockstream Help Center
+        inline constexpr std::string_view id_visit_the_blockstream_help{ "id_visit_the_blockstream_help" };
+        // Waiting for transaction…
+        inline constexpr std::string_view id_waiting_for_transaction{ "id_waiting_for_transaction" };
+        inline constexpr std::string_view id_wallet{ "id_wallet" }; // Wallet
+        // Wallet already restored
+        inline constexpr std::string_view id_wallet_already_restored{ "id_wallet_already_restored" };
+        inline constexpr std::string_view id_wallet_assets{ "id_wallet_assets" }; // Wallet Assets
+        inline constexpr std::string_view id_wallet_backup{ "id_wallet_backup" }; // Wallet Backup
+        // Wallet coins will require two-factor reactivation once a year to remain protected by two-factor
+        // authentication.
+        inline constexpr std::string_view id_wallet_coins_will_require{ "id_wallet_coins_will_require" };
+        // Wallet creation failed
+        inline constexpr std::string_view id_wallet_creation_failed{ "id_wallet_creation_failed" };
+        inline constexpr std::string_view id_wallet_found{ "id_wallet_found" }; // Wallet found
+        inline constexpr std::string_view id_wallet_name{ "id_wallet_name" }; // Wallet Name
+        inline constexpr std::string_view id_wallet_not_found{ "id_wallet_not_found" }; // Wallet not found
+        inline constexpr std::string_view id_wallet_pockets{ "id_wallet_pockets" }; // Wallet Pockets
+        inline constexpr std::string_view id_wallet_transactions{ "id_wallet_transactions" }; // Wallet Transactions
+        inline constexpr std::string_view id_wallets{ "id_wallets" }; // Wallets
+        inline constexpr std::string_view id_warning{ "id_warning" }; // Warning!
+        // Warning: No trusted node set!
+        inline constexpr std::string_view id_warning_no_trusted_node_set{ "id_warning_no_trusted_node_set" };
+        // Warning: Non-.onion address detected!
+        inline constexpr std::string_view id_warning_nononion_address{ "id_warning_nononion_address" };
+        // WARNING: Resetting Two-Factor authentication will lock your wallet
+        inline constexpr std::string_view id_warning_resetting_twofactor{ "id_warning_resetting_twofactor" };
+        // WARNING: There is already a request to reset Two-Factor authentication for your wallet. If you now request
+        // with a new email address, your wallet will become disputed and likely permanently unavailable to you.
+        inline constexpr std::string_view id_warning_there_is_already_a{ "id_warning_there_is_already_a" };
+        // WARNING: Wallet locked by Two-Factor dispute. Contact support for more information.
+        inline constexpr std::string_view id_warning_wallet_locked_by{ "id_warning_wallet_locked_by" };
+        // Warning: Watch-only credentials will be saved on your device
+        inline constexpr std::string_view id_warning_watchonly_credentials{ "id_warning_watchonly_credentials" };
+        // Warning! You need a positive L-BTC balance to be able to send transactions.
+        inline constexpr std::string_view id_warning_you_need_a_positive{ "id_warning_you_need_a_positive" };
+        inline constexpr std::string_view id_watchonly{ "id_watchonly" }; // Watch-only
+        // Watch-only credentials
+        inline constexpr std::string_view id_watchonly_credentials{ "id_watchonly_credentials" };
+        inline constexpr std::string_view id_watchonly_details{ "id_watchonly_details" }; // Watch-only details
+        inline constexpr std::string_view id_watchonly_disabled{ "id_watchonly_disabled" }; // Watch-only disabled
+        inline constexpr std::string_view id_watchonly_login{ "id_watchonly_login" }; // Watch-only login
+        // Watch-only mode can be activated from settings after logging in with your PIN, mnemonic, or hardware wallet.
+        inline constexpr std::string_view id_watchonly_mode_can_be_activated{ "id_watchonly_mode_can_be_activated" };
+        // Watch-only mode cannot be activated on Liquid as your funds are fully confidential.
+        inline constexpr std::string_view id_watchonly_mode_cannot_be{ "id_watchonly_mode_cannot_be" };
+        inline constexpr std::string_view id_watchonly_wallet{ "id_watchonly_wallet" }; // Watch-Only Wallet
+        // We use the camera to scan QR codes
+        inline constexpr std::string_view id_we_use_the_camera_to_scan_qr{ "id_we_use_the_camera_to_scan_qr" };
+        // We will do our best to find a wallet corresponding to this recovery phrase
+        inline constexpr std::string_view id_we_will_do_our_best_to_find_a{ "id_we_will_do_our_best_to_find_a" };
+        inline constexpr std::string_view id_welcome{ "id_welcome" }; // Welcome
+        inline constexpr std::string_view id_welcome_to{ "id_welcome_to" }; // Welcome to
+        // Welcome to Blockstream Jade
+        inline constexpr std::string_view id_welcome_to_blockstream_jade{ "id_welcome_to_blockstream_jade" };
+        // Welcome to your Wallet!
+        inline constexpr std::string_view id_welcome_to_your_wallet{ "id_welcome_to_your_wallet" };
+        // Well done, you can continue
+        inline constexpr std::string_view id_well_done_you_can_continue{ "id_well_done_you_can_continue" };
+        // Well done, you can continue with your password
+        inline constexpr std::string_view id_well_done_you_can_continue_with{ "id_well_done_you_can_continue_with" };
+        // We\'ll get you set up in no time. Make sure you have a pen and paper ready!
+        inline constexpr std::string_view id_well_get_you_set_up_in_no_time{ "id_well_get_you_set_up_in_no_time" };
+        // We\'ll get you set up with an AMP wallet in no time. Note that you can alternatively create AMP accounts in
+        // any existing Liquid wallet.
+        inline constexpr std::string_view id_well_get_you_set_up_with_an_amp{ "id_well_get_you_set_up_with_an_amp" };
+        // What is word number %s?
+        inline constexpr std::string_view id_what_is_word_number_s{ "id_what_is_word_number_s" };
+        // What type of account would you like to add?
+        inline constexpr std::string_view id_what_type_of_account_would_you{ "id_what_type_of_account_would_you" };
+        inline constexpr std::string_view id_whats_collected{ "id_whats_collected" }; // What\'s collected
+        inline constexpr std::string_view id_whats_new{ "id_whats_new" }; // What\'s new?
+        inline constexpr std::string_view id_whats_not_collected{ "id_whats_not_collected" }; // What\'s NOT collected
+        // Where would you like to transfer the funds?
+        inline constexpr std::string_view id_where_would_you_like_to{ "id_where_would_you_like_to" };
+        // Whomever can access your recovery phrase, can steal your funds.
+        inline constexpr std::string_view id_whomever_can_access_your{ "id_whomever_can_access_your" };
+        inline constexpr std::string_view id_wireless{ "id_wireless" }; // Wireless
+        inline constexpr std::string_view id_withdraw{ "id_withdraw" }; // Withdraw
+        // Withdraw limits: %s - %s
+        inline constexpr std::string_view id_withdraw_limits_s__s{ "id_withdraw_limits_s__s" };
+        inline constexpr std::string_view id_word{ "id_word" }; // Word
+        inline constexpr std::string_view id_word_d_of_d{ "id_word_d_of_d" }; // Word %d of %d
+        inline constexpr std::string_view id_write_down_the_words{ "id_write_down_the_words" }; // Write down the words
+        // Write down your recovery phrase in the correct order
+        inline constexpr std::string_view id_write_down_your_recovery_phrase{ "id_write_down_your_recovery_phrase" };
+        // Wrong choice. Check your mnemonic and try again.
+        inline constexpr std::string_view id_wrong_choice_check_your{ "id_wrong_choice_check_your" };
+        inline constexpr std::string_view id_xpub{ "id_xpub" }; // xPub
+        inline constexpr std::string_view id_year{ "id_year" }; // year
+        inline constexpr std::string_view id_years{ "id_years" }; // years
+        // You are not connected
+        inline constexpr std::string_view id_you_are_not_connected{ "id_you_are_not_connected" };
+        // You are not connected, please wait
+        inline constexpr std::string_view id_you_are_not_connected_please{ "id_you_are_not_connected_please" };
+        // You are now connected
+        inline constexpr std::string_view id_you_are_now_connected{ "id_you_are_now_connected" };
+        // You are redeeming funds from %s
+        inline constexpr std::string_view id_you_are_redeeming_funds_from_s{ "id_you_are_redeeming_funds_from_s" };
+        // You can change these later on.
+        inline constexpr std::string_view id_you_can_change_these_later_on{ "id_you_can_change_these_later_on" };
+        inline constexpr std::string_view id_you_can_send_up_to{ "id_you_can_send_up_to" }; // You can send up to:
+        // You can still receive funds, but they won’t be shown on your total balance.
+        inline constexpr std::string_view id_you_can_still_receive_funds_but{ "id_you_can_still_receive_funds_but" };
+        // You can sweep %s of your funds to your onchain account.
+        inline constexpr std::string_view id_you_can_sweep_s_of_your_funds{ "id_you_can_sweep_s_of_your_funds" };
+        // You can use your wallet to anonymously sign and authorize an action on:
+        inline constexpr std::string_view id_you_can_use_your_wallet_to{ "id_you_can_use_your_wallet_to" };
+        // You cannot create or restore a wallet on %s as you already have a PIN protected wallet.
+        inline constexpr std::string_view id_you_cannot_create_or_restore_a{ "id_you_cannot_create_or_restore_a" };
+        // You cannot receive more than %s (%s) on this account. Reduce the amount and try again.
+        inline constexpr std::string_view id_you_cannot_receive_more_than_s{ "id_you_cannot_receive_more_than_s" };
+        // You have a significant amount of funds here, consider protecting them with 2FA.
+        inline constexpr std::string_view id_you_have_a_significant_amount{ "id_you_have_a_significant_amount" };
+        // You have clicked a Payment URI, select a wallet to handle it
+        inline constexpr std::string_view id_you_have_clicked_a_payment_uri{ "id_you_have_clicked_a_payment_uri" };
+        // You have clicked a URI, select a wallet to handle it
+        inline constexpr std::string_view id_you_have_clicked_a_uri_select_a{ "id_you_have_clicked_a_uri_select_a" };
+        // You have control on your funds
+        inline constexpr std::string_view id_you_have_control_on_your_funds{ "id_you_have_control_on_your_funds" };
+        // You have just received %s.
+        inline constexpr std::string_view id_you_have_just_received_s{ "id_you_have_just_received_s" };
+        // You have no coins to send. Generate an address to receive some bitcoins.
+        inline constexpr std::string_view id_you_have_no_coins_to_send{ "id_you_have_no_coins_to_send" };
+        inline constexpr std::string_view id_you_have_received_s{ "id_you_have_received_s" }; // You have received %s
+        // You have successfully changed your PIN
+        inline constexpr std::string_view id_you_have_successfully_changed{ "id_you_have_successfully_changed" };
+        // You have successfully sent a transaction. Please give us your feedback to improve Green.
+        inline constexpr std::string_view id_you_have_successfully_sent_a{ "id_you_have_successfully_sent_a" };
+        // You have to Authenticate using biometrics
+        inline constexpr std::string_view id_you_have_to_authenticate_using{ "id_you_have_to_authenticate_using" };
+        // You have Tor enabled, are you sure you want to open this webpage?
+        inline constexpr std::string_view id_you_have_tor_enabled_are_you{ "id_you_have_tor_enabled_are_you" };
+        // You must first log out before logging in.
+        inline constexpr std::string_view id_you_must_first_log_out_before{ "id_you_must_first_log_out_before" };
+        // You MUST save this mnemonic NOW
+        inline constexpr std::string_view id_you_must_save_this_mnemonic_now{ "id_you_must_save_this_mnemonic_now" };
+        // You need a Liquid account in order to receive it.
+        inline constexpr std::string_view id_you_need_a_liquid_account_in{ "id_you_need_a_liquid_account_in" };
+        // You only have one Two-Factor authentication method enabled
+        inline constexpr std::string_view id_you_only_have_one_twofactor{ "id_you_only_have_one_twofactor" };
+        // You will be asked to enter your passphrase at every login.
+        inline constexpr std::string_view id_you_will_be_asked_to_enter_your{ "id_you_will_be_asked_to_enter_your" };
+        // You will need to re-enter your mnemonic to login again if you do not set up a PIN. Press "OK" to continue.
+        inline constexpr std::string_view id_you_will_need_to_reenter_your{ "id_you_will_need_to_reenter_your" };
+        // You will see your coins here
+        inline constexpr std::string_view id_you_will_see_your_coins_here{ "id_you_will_see_your_coins_here" };
+        // You’ll need to back up your recovery phrase before you can send or receive funds, but you can still check out
+        // the wallet for now.
+        inline constexpr std::string_view id_youll_need_to_back_up_your{ "id_youll_need_to_back_up_your" };
+        // You\'ll need your PIN to log in to your wallet. This PIN secures the wallet on this device only.
+        inline constexpr std::string_view id_youll_need_your_pin_to_log_in{ "id_youll_need_your_pin_to_log_in" };
+        // You\'ll need your recovery phrase to restore this wallet
+        inline constexpr std::string_view id_youll_need_your_recovery_phrase{ "id_youll_need_your_recovery_phrase" };
+        // You\'ll see your coins here when you receive funds
+        inline constexpr std::string_view id_youll_see_your_coins_here_when{ "id_youll_see_your_coins_here_when" };
+        // Your 2FA expires, so that if you lose access to your 2FA method, or the Blockstream Green service becomes
+        // unavailable, you can always recover your bitcoin using this open source tool
+        inline constexpr std::string_view id_your_2fa_expires_so_that_if_you{ "id_your_2fa_expires_so_that_if_you" };
+        // Your bitcoin and Liquid assets are stored on the blockchain, and can only be spent using the keys stored on
+        // Jade.
+        inline constexpr std::string_view id_your_bitcoin_and_liquid_assets{ "id_your_bitcoin_and_liquid_assets" };
+        // Your Bluetooth adapter is disabled
+        inline constexpr std::string_view id_your_bluetooth_adapter_is{ "id_your_bluetooth_adapter_is" };
+        // Your current receive capacity is %s.
+        inline constexpr std::string_view id_your_current_receive_capacity{ "id_your_current_receive_capacity" };
+        // Your device was disconnected
+        inline constexpr std::string_view id_your_device_was_disconnected{ "id_your_device_was_disconnected" };
+        // Your favourite exchange rate is not available at the moment. You can change it from settings.
+        inline constexpr std::string_view id_your_favourite_exchange_rate_is{ "id_your_favourite_exchange_rate_is" };
+        // Your funds are secured by multiple keys, with one key on your device and another on our servers protected by
+        // your 2FA. Select this option for enhanced security.
+        inline constexpr std::string_view id_your_funds_are_secured_by{ "id_your_funds_are_secured_by" };
+        // Your funds are secured by a single key held on your device. Simpler to set up and operate than multisig. If
+        // in doubt, select this option.
+        inline constexpr std::string_view id_your_funds_are_secured_by_a{ "id_your_funds_are_secured_by_a" };
+        // Your funds are secured by your PIN. Easy to use, standard and portable on most bitcoin wallets.
+        inline constexpr std::string_view id_your_funds_are_secured_by_your{ "id_your_funds_are_secured_by_your" };
+        // Your funds have grown recently.\n\nConsider using a 2FA protected account, so all your outgoing transactions
+        // will have an extra layer of protection.\nFor that you will need to:\n\n1. Create a 2FA protected account;\n2.
+        // Setup your 2FA method;\n3. Move funds to the new account;\n4. Archive the old account;
+        inline constexpr std::string_view id_your_funds_have_grown{ "id_your_funds_have_grown" };
+        // Your Green wallet is now ready to use.
+        inline constexpr std::string_view id_your_green_wallet_is_now_ready{ "id_your_green_wallet_is_now_ready" };
+        // Your iOS device might not be supported
+        inline constexpr std::string_view id_your_ios_device_might_not_be{ "id_your_ios_device_might_not_be" };
+        // Your keys secure your coins on the blockchain
+        inline constexpr std::string_view id_your_keys_secure_your_coins_on{ "id_your_keys_secure_your_coins_on" };
+        // Your notifications will be shown here.
+        inline constexpr std::string_view id_your_notifications_will_be{ "id_your_notifications_will_be" };
+        // Your PIN or your mnemonic will be required to access the wallet.
+        inline constexpr std::string_view id_your_pin_or_your_mnemonic_will{ "id_your_pin_or_your_mnemonic_will" };
+        // Your %s sent to %s has been confirmed
+        inline constexpr std::string_view id_your_s_sent_to_s_has_been{ "id_your_s_sent_to_s_has_been" };
+        // Your settings are unsaved.\n\nDo you want to continue?
+        inline constexpr std::string_view id_your_settings_are_unsavednndo{ "id_your_settings_are_unsavednndo" };
+        // Your Swap Proposal is generated!
+        inline constexpr std::string_view id_your_swap_proposal_is_generated{ "id_your_swap_proposal_is_generated" };
+        // Your transactions will be shown here.
+        inline constexpr std::string_view id_your_transactions_will_be_shown{ "id_your_transactions_will_be_shown" };
+        // Your Two-Factor threshold is %s.
+        inline constexpr std::string_view id_your_twofactor_threshold_is_s{ "id_your_twofactor_threshold_is_s" };
+        // Your wallet backup is made of 24 words, also known as your mnemonic. Make sure you have a backup and keep it
+        // safe. Anyone who finds it can steal your money. You can use it to restore your Blockstream Green wallet on
+        // another device in case yours is lost, damaged or stolen.
+        inline constexpr std::string_view id_your_wallet_backup_is_made_of{ "id_your_wallet_backup_is_made_of" };
+        // Your wallet is locked for a Two-Factor Authentication reset. The reset will be completed in %d days.
+        inline constexpr std::string_view id_your_wallet_is_locked_for_a{ "id_your_wallet_is_locked_for_a" };
+        // Your wallet is locked under 2FA dispute.
+        inline constexpr std::string_view id_your_wallet_is_locked_under_2fa{ "id_your_wallet_is_locked_under_2fa" };
+        // Your wallet is not yet fully secured.\nPlease enable Two-Factor authentication.
+        inline constexpr std::string_view id_your_wallet_is_not_yet_fully{ "id_your_wallet_is_not_yet_fully" };
+        // Your watch-only username and password will be stored un-encrypted on this device. If your device is
+        // compromised third parties can get access to your transaction history. Press "OK" to continue.
+        inline constexpr std::string_view id_your_watchonly_username_and{ "id_your_watchonly_username_and" };
+        // You\'ve entered an invalid PIN too many times.
+        inline constexpr std::string_view id_youve_entered_an_invalid_pin{ "id_youve_entered_an_invalid_pin" };
 
     } // namespace res
 
@@ -3,6 +3,7 @@
 #include <boost/algorithm/string/predicate.hpp>
 #include <ctime>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -13,6 +14,7 @@
 #include "ga_tx.hpp"
 #include "json_utils.hpp"
 #include "logging.hpp"
+#include "metrics.hpp"
 #include "session_impl.hpp"
 #include "signer.hpp"
 #include "transaction_utils.hpp"
@@ -625,7 +627,9 @@ namespace green {
         static void pick_utxos(session_impl& session, Tx& tx, nlohmann::json& result, nlohmann::json& src_utxos,
             addressee_details_t& addressee, const amount& fee_rate, bool manual_selection)
         {
-            // Select the inputs to use
+            // Select the inputs to use.
+            // src_utxos is the caller's JSON, keyed by hex asset id, and is looked
+            // up once per asset, so it is not re-keyed by binary asset id here
             nlohmann::json empty = nlohmann::json::array_t{};
             const auto& net_params = session.get_network_parameters();
             const bool is_policy_asset = addressee.asset_id == net_params.get_policy_asset();
@@ -726,6 +730,8 @@ namespace green {
                 tx.set_anti_snipe_locktime(current_block_height);
             }
 
+            // Ordered by hex asset id: iteration order determines the order in
+            // which change outputs are added, so this is not a hashed txid/asset map
             std::map<std::string, addressee_details_t> asset_addressees;
 
             // Make sure we have details for the policy asset
@@ -863,6 +869,39 @@ namespace green {
             const bool is_valid = is_liquid && sighash_flags == SIGHASH_SINGLE_ANYONECANPAY;
             GDK_USER_ASSERT(is_valid, "Unsupported sighash type");
         }
+
+        // The blinding data and proofs for a single output being blinded
+        struct output_blinding_t {
+            output_blinding_t() = default;
+            output_blinding_t(const output_blinding_t&) = default;
+            output_blinding_t& operator=(const output_blinding_t&) = default;
+            output_blinding_t(output_blinding_t&&) = default;
+            output_blinding_t& operator=(output_blinding_t&&) = default;
+            ~output_blinding_t()
+            {
+                if (eph_private_key.has_value()) {
+                    wally_bzero(eph_private_key->data(), eph_private_key->size());
+                }
+            }
+
+            size_t index;
+            asset_id_t asset_id;
+            std::vector<unsigned char> abf;
+            vbf_t vbf;
+            std::array<unsigned char, ASSET_GENERATOR_LEN> generator;
+            std::vector<unsigned char> value_commitment;
+            std::vector<unsigned char> eph_public_key;
+            // Inputs for generating a new rangeproof, if required
+            std::optional<priv_key_t> eph_private_key;
+            std::vector<unsigned char> blinding_pubkey;
+            std::vector<unsigned char> scriptpubkey;
+            uint64_t value;
+            // Surjection proof entropy, if a surjection proof is required
+            std::optional<std::array<unsigned char, 32>> entropy;
+            // The resulting proofs
+            std::vector<unsigned char> rangeproof;
+            std::vector<unsigned char> surjectionproof;
+        };
     } // namespace
 
     void Tx::tx_deleter::operator()(struct wally_tx* p) { wally_tx_free(p); }
@@ -1441,7 +1480,7 @@ namespace green {
         txhashes.reserve(tx_inputs.size() * WALLY_TXHASH_LEN);
         output_indices.reserve(tx_inputs.size());
         for (const auto& utxo : tx_inputs) {
-            const auto txhash_bin = j_rbytesref(utxo, "txhash", WALLY_TXHASH_LEN);
+            const auto txhash_bin = j_txidref(utxo);
             txhashes.insert(txhashes.end(), txhash_bin.begin(), txhash_bin.end());
             output_indices.emplace_back(j_uint32ref(utxo, "pt_idx"));
         }
@@ -1482,6 +1521,8 @@ namespace green {
 
     void blind_transaction(session_impl& session, nlohmann::json& details, const nlohmann::json& blinding_data)
     {
+        // Times range and surjection proof generation
+        metrics::scoped_timer timer("blind_transaction");
         const auto& net_params = session.get_network_parameters();
         const bool is_liquid = net_params.is_liquid();
         GDK_RUNTIME_ASSERT(is_liquid);
@@ -1525,7 +1566,7 @@ namespace green {
         values.reserve(num_in_outs);
 
         for (const auto& utxo : tx_inputs) {
-            const auto asset_id = j_rbytesref(utxo, "asset_id");
+            const auto asset_id = j_asset_idref(is_liquid, utxo);
             assets.insert(assets.end(), std::begin(asset_id), std::end(asset_id));
             const auto abf = j_rbytesref(utxo, "assetblinder");
             const auto generator = asset_generator_from_bytes(asset_id, abf);
@@ -1550,12 +1591,19 @@ namespace green {
             blinding_nonces.reserve(transaction_outputs.size());
         }
 
+        // Blinding is done in two passes: first we compute the blinders
+        // and commitments for each output, which must be done in order
+        // as the final vbf depends on all prior outputs. We then generate
+        // the (expensive, but independent) proofs for each output in parallel.
+        std::vector<output_blinding_t> blinded;
+        blinded.reserve(transaction_outputs.size());
+
         for (size_t i = 0; i < transaction_outputs.size(); ++i) {
             auto& output = transaction_outputs[i];
             if (j_str_is_empty(output, "scriptpubkey")) {
                 continue; // Fee
             }
-            const auto asset_id = j_rbytesref(output, "asset_id");
+            const auto asset_id = j_asset_idref(is_liquid, output);
             const auto value = j_amountref(output, "satoshi");
 
             // If an output has a vbf, it contributes to the final vbf calculation.
@@ -1622,24 +1670,21 @@ namespace green {
             }
 
             const auto& o = tx.get_output(i);
-            const auto generator = asset_generator_from_bytes(asset_id, abf);
-            std::vector<unsigned char> value_commitment;
+            auto& b = blinded.emplace_back();
+            b.index = i;
+            b.asset_id = asset_id;
+            b.generator = asset_generator_from_bytes(asset_id, abf);
             if (for_final_vbf) {
-                value_commitment = asset_value_commitment(value.value(), vbf, generator);
+                b.value_commitment = asset_value_commitment(value.value(), vbf, b.generator);
             } else {
-                value_commitment = { o.value, o.value + o.value_len };
+                b.value_commitment = { o.value, o.value + o.value_len };
             }
 
-            const auto scriptpubkey = j_bytesref(output, "scriptpubkey");
-
-            std::vector<unsigned char> eph_public_key;
-            std::vector<unsigned char> rangeproof;
-
-            if (is_blinded(o) && !memcmp(o.asset, generator.data(), o.asset_len)
-                && !memcmp(o.value, value_commitment.data(), o.value_len)) {
+            if (is_blinded(o) && !memcmp(o.asset, b.generator.data(), o.asset_len)
+                && !memcmp(o.value, b.value_commitment.data(), o.value_len)) {
                 // Rangeproof already created for the same commitments
-                eph_public_key.assign(o.nonce, o.nonce + o.nonce_len);
-                rangeproof.assign(o.rangeproof, o.rangeproof + o.rangeproof_len);
+                b.eph_public_key.assign(o.nonce, o.nonce + o.nonce_len);
+                b.rangeproof.assign(o.rangeproof, o.rangeproof + o.rangeproof_len);
                 if (blinding_nonces_required) {
                     // Add the pre-blinded outputs blinding nonce
                     GDK_RUNTIME_ASSERT(output.contains("blinding_nonce"));
@@ -1647,29 +1692,43 @@ namespace green {
                 }
             } else {
                 GDK_RUNTIME_ASSERT(!output.contains("nonce_commitment"));
-                priv_key_t eph_private_key;
-                std::tie(eph_private_key, eph_public_key) = get_ephemeral_keypair();
-                output["eph_public_key"] = b2h(eph_public_key);
-                const auto blinding_pubkey = j_bytesref(output, "blinding_key");
+                // Held only in b, which wipes it when destroyed
+                auto& eph_private_key = b.eph_private_key.emplace();
+                std::tie(eph_private_key, b.eph_public_key) = get_ephemeral_keypair();
+                output["eph_public_key"] = b2h(b.eph_public_key);
+                b.blinding_pubkey = j_bytesref(output, "blinding_key");
                 GDK_RUNTIME_ASSERT(!output.contains("blinding_nonce"));
                 if (blinding_nonces_required) {
                     // Generate the blinding nonce for the caller
-                    const auto nonce = sha256(ecdh(blinding_pubkey, eph_private_key));
+                    const auto nonce = sha256(ecdh(b.blinding_pubkey, eph_private_key));
                     blinding_nonces.emplace_back(b2h(nonce));
                 }
-
-                rangeproof = asset_rangeproof(value.value(), blinding_pubkey, eph_private_key, asset_id, abf, vbf,
-                    value_commitment, scriptpubkey, generator);
+                b.scriptpubkey = j_bytesref(output, "scriptpubkey");
+                b.value = value.value();
             }
-
-            std::vector<unsigned char> surjectionproof;
+            b.abf = std::move(abf);
+            b.vbf = vbf;
             if (!is_partial) {
-                const auto entropy = get_random_bytes<32>();
-                surjectionproof
-                    = asset_surjectionproof(asset_id, abf, generator, entropy, assets, all_abfs, generators);
+                b.entropy = get_random_bytes<32>();
+            }
+        }
+
+        // Generate the rangeproofs and surjection proofs
+        parallel_for_each_index(blinded.size(), [&blinded, &assets, &all_abfs, &generators](size_t n) {
+            auto& b = blinded[n];
+            if (b.eph_private_key.has_value()) {
+                b.rangeproof = asset_rangeproof(b.value, b.blinding_pubkey, *b.eph_private_key, b.asset_id, b.abf,
+                    b.vbf, b.value_commitment, b.scriptpubkey, b.generator);
+            }
+            if (b.entropy.has_value()) {
+                b.surjectionproof
+                    = asset_surjectionproof(b.asset_id, b.abf, b.generator, *b.entropy, assets, all_abfs, generators);
             }
+        });
 
-            tx.set_output_commitments(i, generator, value_commitment, eph_public_key, surjectionproof, rangeproof);
+        for (const auto& b : blinded) {
+            tx.set_output_commitments(
+                b.index, b.generator, b.value_commitment, b.eph_public_key, b.surjectionproof, b.rangeproof);
         }
 
         details["is_blinded"] = true;
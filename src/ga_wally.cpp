@@ -412,20 +412,21 @@ namespace green {
     //
     // Strings/Addresses
     //
-    std::string b2h(byte_span_t data)
-    {
-        char* ret;
-        GDK_VERIFY(wally_hex_from_bytes(data.data(), data.size(), &ret));
-        return make_string(ret);
+    template <typename Iter> static std::string b2h_impl(Iter begin, Iter end)
+    {
+        static constexpr char hex_chars[] = "0123456789abcdef";
+        std::string ret(static_cast<size_t>(std::distance(begin, end)) * 2, '\0');
+        auto out = ret.begin();
+        for (auto it = begin; it != end; ++it) {
+            *out++ = hex_chars[*it >> 4];
+            *out++ = hex_chars[*it & 0xf];
+        }
+        return ret;
     }
 
-    std::string b2h_rev(byte_span_t data)
-    {
-        char* ret;
-        std::vector<unsigned char> buff(data.rbegin(), data.rend());
-        GDK_VERIFY(wally_hex_from_bytes(buff.data(), buff.size(), &ret));
-        return make_string(ret);
-    }
+    std::string b2h(byte_span_t data) { return b2h_impl(data.begin(), data.end()); }
+
+    std::string b2h_rev(byte_span_t data) { return b2h_impl(data.rbegin(), data.rend()); }
 
     static auto h2b(const char* hex, size_t siz, bool rev, uint8_t prefix = 0)
     {
@@ -2,6 +2,7 @@
 #define GDK_CORE_WALLY_HPP
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <memory>
@@ -9,6 +10,7 @@
 #include <vector>
 
 #include "gsl_wrapper.hpp"
+#include "hash_types.hpp"
 #include "wally_wrapper.h"
 
 #include "assertion.hpp"
@@ -46,13 +48,14 @@ namespace green {
     using pub_key_t = std::array<unsigned char, EC_PUBLIC_KEY_LEN>;
     using priv_key_t = std::array<unsigned char, EC_PRIVATE_KEY_LEN>;
 
-    using asset_id_t = std::array<unsigned char, ASSET_TAG_LEN>;
+    static_assert(std::tuple_size_v<asset_id_t> == ASSET_TAG_LEN);
     using vbf_t = std::array<unsigned char, 32>;
     using abf_t = std::array<unsigned char, 32>;
     using abf_vbf_t = std::array<unsigned char, WALLY_ABF_VBF_LEN>;
     using unblind_t = std::tuple<asset_id_t, vbf_t, abf_t, uint64_t>;
     using cvalue_t = std::array<unsigned char, WALLY_TX_ASSET_CT_VALUE_UNBLIND_LEN>;
     using blinding_key_t = std::array<unsigned char, HMAC_SHA512_LEN>;
+    static_assert(std::tuple_size_v<txid_t> == WALLY_TXHASH_LEN);
 
     struct wally_string_dtor {
         void operator()(char* p) { wally_free_string(p); }
@@ -203,25 +206,18 @@ namespace green {
 
     template <std::size_t N> std::array<unsigned char, N> h2b(const std::string& hex)
     {
-        GDK_RUNTIME_ASSERT(hex.size() / 2 == N);
-        std::array<unsigned char, N> buff{ { 0 } };
-
-        const std::vector<unsigned char> bin = h2b(hex);
-        GDK_RUNTIME_ASSERT(bin.size() == N);
-
-        std::copy(std::begin(bin), std::end(bin), buff.begin());
+        GDK_RUNTIME_ASSERT(hex.size() == N * 2);
+        std::array<unsigned char, N> buff;
+        size_t written;
+        GDK_VERIFY(wally_hex_to_bytes(hex.c_str(), buff.data(), buff.size(), &written));
+        GDK_RUNTIME_ASSERT(written == N);
         return buff;
     }
 
     template <std::size_t N> std::array<unsigned char, N> h2b_rev(const std::string& hex)
     {
-        GDK_RUNTIME_ASSERT(hex.size() / 2 == N);
-        std::array<unsigned char, N> buff{ { 0 } };
-
-        const std::vector<unsigned char> bin = h2b_rev(hex);
-        GDK_RUNTIME_ASSERT(bin.size() == N);
-
-        std::copy(std::begin(bin), std::end(bin), buff.begin());
+        auto buff = h2b<N>(hex);
+        std::reverse(buff.begin(), buff.end());
         return buff;
     }
 
@@ -0,0 +1,36 @@
+#ifndef GDK_HASH_TYPES_HPP
+#define GDK_HASH_TYPES_HPP
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <unordered_map>
+
+namespace green {
+
+    // Binary ids which are hash outputs, kept free of wally so that
+    // lightweight headers can use them
+    using hash32_t = std::array<unsigned char, 32>;
+
+    // An asset id, in internal (not display) byte order
+    using asset_id_t = hash32_t;
+    // A txid, in internal (not display) byte order
+    using txid_t = hash32_t;
+
+    // Hasher for txids and asset ids. These are hash outputs, so their
+    // leading bytes are already uniformly distributed.
+    struct hash32_hash {
+        size_t operator()(const hash32_t& v) const noexcept
+        {
+            size_t ret;
+            std::memcpy(&ret, v.data(), sizeof(ret));
+            return ret;
+        }
+    };
+    template <typename T> using txid_map_t = std::unordered_map<txid_t, T, hash32_hash>;
+    template <typename T> using asset_id_map_t = std::unordered_map<asset_id_t, T, hash32_hash>;
+
+} // namespace green
+
+#endif
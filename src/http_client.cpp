@@ -190,10 +190,9 @@ namespace green {
         return ctx;
     }
 
-    http_client::http_client(boost::asio::io_context& io)
-        : m_resolver(asio::make_strand(io))
+    http_client::http_client(const asio::any_io_executor& executor)
+        : m_resolver(executor)
         , m_timeout(HTTP_TIMEOUT)
-        , m_io(io)
     {
     }
 
@@ -248,12 +247,9 @@ namespace green {
         m_accept = params.value("accept", "");
 
         if (!proxy_uri.empty()) {
-            get_lowest_layer().expires_after(m_timeout);
-            auto proxy = std::make_shared<socks_client>(m_io, get_next_layer());
-            GDK_RUNTIME_ASSERT(proxy != nullptr);
-            auto f = proxy->run(m_host + ":" + m_port, proxy_uri);
-            f.get();
-            async_handshake();
+            // The proxy handshake runs asynchronously under the request
+            // timeout, continuing with our handshake once connected
+            async_proxy_connect(proxy_uri);
         } else {
             async_resolve(m_host, m_port);
         }
@@ -270,6 +266,17 @@ namespace green {
         async_connect(std::move(results));
     }
 
+    void http_client::on_proxy_connect(const std::string& error)
+    {
+        GDK_LOG(debug) << "http_client:on_proxy_connect";
+
+        if (!error.empty()) {
+            set_exception("on proxy connect: " + error);
+            return;
+        }
+        async_handshake();
+    }
+
     void http_client::on_write(beast::error_code ec, size_t __attribute__((unused)) bytes_transferred)
     {
         GDK_LOG(debug) << "http_client:on_write";
@@ -374,9 +381,9 @@ namespace green {
         m_promise.set_exception(std::make_exception_ptr(std::runtime_error(what)));
     }
 
-    tls_http_client::tls_http_client(asio::io_context& io, asio::ssl::context& ssl_ctx)
-        : http_client(io)
-        , m_stream(asio::make_strand(io), ssl_ctx)
+    tls_http_client::tls_http_client(const asio::any_io_executor& executor, asio::ssl::context& ssl_ctx)
+        : http_client(executor)
+        , m_stream(executor, ssl_ctx)
     {
     }
 
@@ -405,6 +412,11 @@ namespace green {
 #define ASYNC_RESOLVE                                                                                                  \
     m_resolver.async_resolve(host, port, beast::bind_front_handler(&http_client::on_resolve, shared_from_this()));
 
+#define ASYNC_PROXY_CONNECT                                                                                            \
+    auto proxy = std::make_shared<socks_client>(get_next_layer());                                                     \
+    proxy->async_run(m_host + ":" + m_port, proxy_uri, m_timeout,                                                      \
+        [self = shared_from_this()](const std::string& error) { self->on_proxy_connect(error); });
+
 #define ASYNC_WRITE                                                                                                    \
     beast::http::async_write(                                                                                          \
         m_stream, m_request, beast::bind_front_handler(&http_client::on_write, shared_from_this()));
@@ -437,6 +449,8 @@ namespace green {
 
     void tls_http_client::async_resolve(const std::string& host, const std::string& port) { ASYNC_RESOLVE; }
 
+    void tls_http_client::async_proxy_connect(const std::string& proxy_uri) { ASYNC_PROXY_CONNECT; }
+
     void tls_http_client::preamble(const std::string& host)
     {
         if (!SSL_set_tlsext_host_name(m_stream.native_handle(), host.c_str())) {
@@ -445,9 +459,9 @@ namespace green {
         }
     }
 
-    tcp_http_client::tcp_http_client(boost::asio::io_context& io)
-        : http_client(io)
-        , m_stream(asio::make_strand(io))
+    tcp_http_client::tcp_http_client(const asio::any_io_executor& executor)
+        : http_client(executor)
+        , m_stream(executor)
     {
     }
 
@@ -480,6 +494,8 @@ namespace green {
 
     void tcp_http_client::async_resolve(const std::string& host, const std::string& port) { ASYNC_RESOLVE; }
 
+    void tcp_http_client::async_proxy_connect(const std::string& proxy_uri) { ASYNC_PROXY_CONNECT; }
+
     void tcp_http_client::on_connect(boost::beast::error_code ec,
         __attribute__((unused)) const boost::asio::ip::tcp::resolver::results_type::endpoint_type& type)
     {
@@ -491,6 +507,7 @@ namespace green {
     }
 
 #undef ASYNC_WRITE
+#undef ASYNC_PROXY_CONNECT
 #undef ASYNC_RESOLVE
 #undef ASYNC_READ
 
@@ -2,6 +2,7 @@
 #define GDK_HTTP_CLIENT_HPP
 #pragma once
 
+#include <boost/asio/any_io_executor.hpp>
 #include <boost/beast/core.hpp>
 #include <boost/beast/http.hpp>
 #include <boost/beast/ssl.hpp>
@@ -25,12 +26,14 @@ namespace green {
         std::future<nlohmann::json> request(boost::beast::http::verb verb, const nlohmann::json& params);
 
         void on_resolve(boost::beast::error_code ec, boost::asio::ip::tcp::resolver::results_type results);
+        void on_proxy_connect(const std::string& error);
         void on_write(boost::beast::error_code ec, size_t bytes_transferred);
         void on_read(boost::beast::error_code ec, size_t bytes_transferred);
         void on_shutdown(boost::beast::error_code ec);
 
     protected:
-        explicit http_client(boost::asio::io_context& io);
+        // All async operations run on executor, which must be a strand
+        explicit http_client(const boost::asio::any_io_executor& executor);
 
         virtual boost::beast::tcp_stream& get_lowest_layer() = 0;
         virtual boost::beast::tcp_stream& get_next_layer() = 0;
@@ -40,6 +43,7 @@ namespace green {
         virtual void async_shutdown() = 0;
         virtual void async_handshake() = 0;
         virtual void async_resolve(const std::string& host, const std::string& port) = 0;
+        virtual void async_proxy_connect(const std::string& proxy_uri) = 0;
         virtual void preamble(const std::string& host);
 
         void set_result();
@@ -55,13 +59,11 @@ namespace green {
         std::string m_accept;
 
         std::promise<nlohmann::json> m_promise;
-
-        boost::asio::io_context& m_io;
     };
 
     class tls_http_client final : public std::enable_shared_from_this<tls_http_client>, public http_client {
     public:
-        explicit tls_http_client(boost::asio::io_context& io, boost::asio::ssl::context& ssl_ctx);
+        explicit tls_http_client(const boost::asio::any_io_executor& executor, boost::asio::ssl::context& ssl_ctx);
 
     private:
         boost::beast::tcp_stream& get_lowest_layer() override;
@@ -72,6 +74,7 @@ namespace green {
         void async_shutdown() override;
         void async_handshake() override;
         void async_resolve(const std::string& host, const std::string& port) override;
+        void async_proxy_connect(const std::string& proxy_uri) override;
         void preamble(const std::string& host) override;
 
         void on_connect(
@@ -83,7 +86,7 @@ namespace green {
 
     class tcp_http_client final : public std::enable_shared_from_this<tcp_http_client>, public http_client {
     public:
-        explicit tcp_http_client(boost::asio::io_context& io);
+        explicit tcp_http_client(const boost::asio::any_io_executor& executor);
 
     private:
         boost::beast::tcp_stream& get_lowest_layer() override;
@@ -94,6 +97,7 @@ namespace green {
         void async_shutdown() override;
         void async_handshake() override;
         void async_resolve(const std::string& host, const std::string& port) override;
+        void async_proxy_connect(const std::string& proxy_uri) override;
 
         void on_connect(
             boost::beast::error_code ec, const boost::asio::ip::tcp::resolver::results_type::endpoint_type& type);
@@ -105,10 +109,10 @@ namespace green {
         const std::vector<std::string>& roots, const std::vector<std::string>& pins, uint32_t cert_expiry_threshold);
 
     inline std::shared_ptr<http_client> make_http_client(
-        boost::asio::io_context& io, boost::asio::ssl::context* ssl_ctx)
+        const boost::asio::any_io_executor& executor, boost::asio::ssl::context* ssl_ctx)
     {
-        return ssl_ctx != nullptr ? std::shared_ptr<http_client>(new tls_http_client(io, *ssl_ctx))
-                                  : std::shared_ptr<http_client>(new tcp_http_client(io));
+        return ssl_ctx != nullptr ? std::shared_ptr<http_client>(new tls_http_client(executor, *ssl_ctx))
+                                  : std::shared_ptr<http_client>(new tcp_http_client(executor));
     }
 
 } // namespace green
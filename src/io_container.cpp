@@ -1,8 +1,15 @@
 
+#include <mutex>
+
 #include "io_runner.hpp"
 
 namespace green {
 
+    namespace {
+        static std::mutex shared_pool_mutex;
+        static std::weak_ptr<io_pool> shared_pool;
+    } // namespace
+
     io_container::io_container()
         : m_io(std::make_unique<boost::asio::io_context>())
         , m_work_guard(boost::asio::make_work_guard(m_io->get_executor()))
@@ -22,10 +29,60 @@ namespace green {
         no_std_exception_escape([wg = std::ref(m_work_guard)] { wg.get().reset(); }, "io_context m_work_guard");
         no_std_exception_escape(
             [pool = std::ref(pool)] {
-                std::for_each(pool.get().begin(), pool.get().end(), [](auto& thread) { thread.join(); });
-                ;
+                std::for_each(pool.get().begin(), pool.get().end(), [](auto& thread) {
+                    if (thread.get_id() == std::this_thread::get_id()) {
+                        thread.detach(); // Never join ourselves
+                    } else if (thread.joinable()) {
+                        thread.join();
+                    }
+                });
             },
             "io_context pool");
     }
 
+    io_pool::io_pool(size_t num_threads)
+        : m_threads(std::max(num_threads, size_t(1)))
+    {
+        m_io.start(m_threads);
+        if (m_threads.size() > 1) {
+            m_wamp_io = std::make_unique<io_container>();
+            m_wamp_thread.resize(1);
+            m_wamp_io->start(m_wamp_thread);
+        }
+    }
+
+    io_pool::~io_pool()
+    {
+        if (m_wamp_io) {
+            m_wamp_io->shutdown(m_wamp_thread);
+        }
+        m_io.shutdown(m_threads);
+    }
+
+    std::shared_ptr<io_pool> io_pool::get_shared_ref(size_t num_threads)
+    {
+        std::unique_lock<std::mutex> locker{ shared_pool_mutex };
+        auto pool = shared_pool.lock();
+        if (!pool) {
+            pool = std::make_shared<io_pool>(num_threads);
+            shared_pool = pool;
+        }
+        return pool;
+    }
+
+    io_pool::strand_t io_pool::make_strand() { return boost::asio::make_strand(m_io.get_io_context()); }
+
+    boost::asio::io_context& io_pool::get_wamp_io_context()
+    {
+        return m_wamp_io ? m_wamp_io->get_io_context() : m_io.get_io_context();
+    }
+
+    bool io_pool::running_in_pool() const
+    {
+        const auto id = std::this_thread::get_id();
+        auto&& is_current = [id](const auto& thread) { return thread.get_id() == id; };
+        return std::any_of(m_threads.begin(), m_threads.end(), is_current)
+            || std::any_of(m_wamp_thread.begin(), m_wamp_thread.end(), is_current);
+    }
+
 } // namespace green
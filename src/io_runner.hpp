@@ -3,11 +3,12 @@
 #pragma once
 
 #include <algorithm>
-#include <array>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/strand.hpp>
 #include <gsl/span>
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include "utils.hpp"
 
@@ -25,16 +26,44 @@ namespace green {
         void shutdown(gsl::span<std::thread> pool) noexcept;
     };
 
-    template <size_t PoolSize> class io_runner {
+    // A pool of threads running one io_context shared by all of its users.
+    // Sessions serialize their own handlers through a strand on the shared
+    // io_context. WAMP connections run on a separate single threaded
+    // io_context instead, since autobahn dispatches its session state
+    // directly to the io_context it is given and so requires that its
+    // handlers never run concurrently. A pool of one thread runs both on
+    // the same io_context.
+    class io_pool {
     public:
-        io_runner() { m_io.start(m_pool); }
+        using strand_t = boost::asio::strand<boost::asio::io_context::executor_type>;
 
-        ~io_runner() { m_io.shutdown(m_pool); }
-        boost::asio::io_context& get_io_context() { return m_io.get_io_context(); }
+        explicit io_pool(size_t num_threads);
+        ~io_pool();
+
+        io_pool(const io_pool&) = delete;
+        io_pool& operator=(const io_pool&) = delete;
+
+        // Get the process-wide pool shared between sessions, creating it
+        // if needed. The pool is destroyed when its last user releases it.
+        static std::shared_ptr<io_pool> get_shared_ref(size_t num_threads);
+
+        // Get a new strand on the shared io_context to run handlers on
+        strand_t make_strand();
+
+        // Get the io_context to run WAMP connections on
+        boost::asio::io_context& get_wamp_io_context();
+
+        // Whether the caller is running on one of the pools threads.
+        // Callers must not block on, or release the pool from, these threads.
+        bool running_in_pool() const;
+
+        size_t size() const { return m_threads.size(); }
 
     private:
         io_container m_io;
-        std::array<std::thread, PoolSize> m_pool;
+        std::vector<std::thread> m_threads;
+        std::unique_ptr<io_container> m_wamp_io;
+        std::vector<std::thread> m_wamp_thread;
     };
 
 } // namespace green
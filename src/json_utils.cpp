@@ -1,5 +1,6 @@
 #include "json_utils.hpp"
 
+#include <algorithm>
 #include <nlohmann/json.hpp>
 #include <optional>
 #include <type_traits>
@@ -180,6 +181,30 @@ namespace green {
         return "btc";
     }
 
+    asset_id_t j_asset_idref(bool is_liquid, const nlohmann::json& src, std::string_view key)
+    {
+        const auto asset_id_hex = j_assetref(is_liquid, src, key);
+        if (!is_liquid) {
+            return asset_id_t{ 0 };
+        }
+        return h2b_rev<ASSET_TAG_LEN>(asset_id_hex);
+    }
+
+    std::string asset_id_to_json(const asset_id_t& asset_id)
+    {
+        const bool is_btc = std::all_of(asset_id.begin(), asset_id.end(), [](auto b) { return b == 0; });
+        return is_btc ? std::string("btc") : b2h_rev(asset_id);
+    }
+
+    txid_t j_txidref(const nlohmann::json& src, std::string_view key)
+    {
+        const auto& hex = j_strref(src, key);
+        if (!validate_hex(hex, WALLY_TXHASH_LEN)) {
+            throw_user_error(std::string("key ") + std::string(key) + " is not a valid txid");
+        }
+        return h2b_rev<WALLY_TXHASH_LEN>(hex);
+    }
+
     bool j_boolref(const nlohmann::json& src, std::string_view key) { return get_or_throw(src, key)->get<bool>(); }
 
     std::optional<bool> j_bool(const nlohmann::json& src, std::string_view key)
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "gsl_wrapper.hpp"
+#include "hash_types.hpp"
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 #include <string_view>
@@ -49,6 +50,13 @@ namespace green {
 
     // hex asset id, or "btc" for bitcoin
     std::string j_assetref(bool is_liquid, const nlohmann::json& src, std::string_view key = "asset_id");
+    // binary asset id in internal byte order, or all zeros for bitcoin
+    asset_id_t j_asset_idref(bool is_liquid, const nlohmann::json& src, std::string_view key = "asset_id");
+    // Convert a binary asset id from j_asset_idref back to its JSON representation
+    std::string asset_id_to_json(const asset_id_t& asset_id);
+
+    // binary txid in internal byte order
+    txid_t j_txidref(const nlohmann::json& src, std::string_view key = "txhash");
 
     // bool
     bool j_boolref(const nlohmann::json& src, std::string_view key);
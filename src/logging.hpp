@@ -6,22 +6,63 @@
 #include <android/log.h>
 #endif
 
+#include <atomic>
+#include <boost/core/null_deleter.hpp>
 #include <boost/log/attributes/named_scope.hpp>
 #include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
 #include <boost/log/sinks/async_frontend.hpp>
 #include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/bounded_fifo_queue.hpp>
+#include <boost/log/sinks/drop_on_overflow.hpp>
+#include <boost/log/sinks/text_ostream_backend.hpp>
 #include <boost/log/sources/global_logger_storage.hpp>
 #include <boost/log/sources/logger.hpp>
 #include <boost/log/trivial.hpp>
+#include <iostream>
 #include <thread>
 
+// Log statements below this severity are removed at compile time.
+// Define as e.g. 2 (info) to compile out debug logging entirely.
+#ifndef GDK_MIN_LOG_LEVEL
+#define GDK_MIN_LOG_LEVEL 0
+#endif
+
 namespace green {
 
     namespace log_level = boost::log::trivial;
 
     using gdk_logger_t = boost::log::sources::severity_logger_mt<log_level::severity_level>;
 
+    // The minimum severity to log, set from the GA_init config. This is
+    // checked before a record is opened, so disabled log statements do not
+    // take the loggers lock or evaluate their arguments. Before GA_init is
+    // called, all severities are logged, matching boost.log's default.
+    inline std::atomic<int> gdk_log_level{ log_level::trace };
+
+    inline bool is_log_enabled(log_level::severity_level sev)
+    {
+        return sev >= GDK_MIN_LOG_LEVEL && sev >= gdk_log_level.load(std::memory_order_relaxed);
+    }
+
+    // Write log records to stderr from a background thread. Records are
+    // queued in a bounded buffer and formatted by the sinks thread. If the
+    // buffer is full, records are dropped rather than blocking the caller.
+    inline void start_async_logging()
+    {
+        namespace sinks = boost::log::sinks;
+        constexpr size_t MAX_QUEUED_RECORDS = 8192;
+        using queue_t = sinks::bounded_fifo_queue<MAX_QUEUED_RECORDS, sinks::drop_on_overflow>;
+        using sink_t = sinks::asynchronous_sink<sinks::text_ostream_backend, queue_t>;
+
+        auto backend = boost::make_shared<sinks::text_ostream_backend>();
+        backend->add_stream(boost::shared_ptr<std::ostream>(&std::clog, boost::null_deleter()));
+        auto sink = boost::make_shared<sink_t>(backend);
+        sink->set_formatter(boost::log::expressions::stream
+            << "[" << log_level::severity << "] " << boost::log::expressions::smessage);
+        boost::log::core::get()->add_sink(sink);
+    }
+
 #ifdef __ANDROID__
     class android_backend : public boost::log::sinks::basic_formatted_sink_backend<char> {
     public:
@@ -80,7 +121,10 @@ namespace green {
         return gdk_logger_t{};
     }
 
-#define GDK_LOG(sev) BOOST_LOG_SEV(::green::gdk_logger::get(), log_level::sev)
+#define GDK_LOG(sev)                                                                                                   \
+    if (!::green::is_log_enabled(log_level::sev)) {                                                                    \
+    } else                                                                                                             \
+        BOOST_LOG_SEV(::green::gdk_logger::get(), log_level::sev)
 
 } // namespace green
 
@@ -0,0 +1,106 @@
+#include "metrics.hpp"
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <shared_mutex>
+
+namespace green {
+    namespace metrics {
+
+        namespace {
+            // Bucket i counts samples taking less than 2^i microseconds which
+            // were not counted in a lower bucket. The last bucket also counts
+            // all longer samples (from 2^22 microseconds, a little over 4s).
+            constexpr size_t NUM_BUCKETS = 24;
+
+            struct histogram {
+                std::atomic<uint64_t> count;
+                std::atomic<uint64_t> total_us;
+                std::atomic<uint64_t> max_us;
+                std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets;
+            };
+
+            // Map nodes are never removed, so references to their
+            // values remain valid once the map lock is released
+            using counters_t = std::map<std::string, std::atomic<uint64_t>, std::less<>>;
+            using histograms_t = std::map<std::string, histogram, std::less<>>;
+
+            static std::shared_mutex metrics_mutex;
+            static counters_t counters;
+            static histograms_t histograms;
+
+            template <typename T> static typename T::mapped_type& get_or_create(T& metrics_map, const std::string& name)
+            {
+                {
+                    std::shared_lock<std::shared_mutex> locker(metrics_mutex);
+                    if (auto p = metrics_map.find(name); p != metrics_map.end()) {
+                        return p->second;
+                    }
+                }
+                std::unique_lock<std::shared_mutex> locker(metrics_mutex);
+                // Value-initialized, i.e. zeroed
+                return metrics_map.try_emplace(name).first->second;
+            }
+
+            static size_t get_bucket(uint64_t us)
+            {
+                size_t bucket = 0;
+                while (bucket < NUM_BUCKETS - 1 && (us >> bucket) != 0) {
+                    ++bucket;
+                }
+                return bucket;
+            }
+
+            static uint64_t get_value(std::atomic<uint64_t>& value, bool reset)
+            {
+                return reset ? value.exchange(0, std::memory_order_relaxed) : value.load(std::memory_order_relaxed);
+            }
+        } // namespace
+
+        void count(const std::string& name, uint64_t n)
+        {
+            get_or_create(counters, name).fetch_add(n, std::memory_order_relaxed);
+        }
+
+        void observe(const std::string& name, clock::duration elapsed)
+        {
+            using std::chrono::microseconds;
+            const auto us = static_cast<uint64_t>(std::chrono::duration_cast<microseconds>(elapsed).count());
+            auto& h = get_or_create(histograms, name);
+            h.count.fetch_add(1, std::memory_order_relaxed);
+            h.total_us.fetch_add(us, std::memory_order_relaxed);
+            h.buckets[get_bucket(us)].fetch_add(1, std::memory_order_relaxed);
+            auto max_us = h.max_us.load(std::memory_order_relaxed);
+            while (us > max_us && !h.max_us.compare_exchange_weak(max_us, us, std::memory_order_relaxed)) {
+                // No-op: max_us is updated by compare_exchange_weak on failure
+            }
+        }
+
+        nlohmann::json get(bool reset)
+        {
+            nlohmann::json counters_json = nlohmann::json::object();
+            nlohmann::json latencies_json = nlohmann::json::object();
+
+            std::shared_lock<std::shared_mutex> locker(metrics_mutex);
+            for (auto& [name, value] : counters) {
+                counters_json.emplace(name, get_value(value, reset));
+            }
+            for (auto& [name, h] : histograms) {
+                nlohmann::json::array_t buckets;
+                buckets.reserve(NUM_BUCKETS);
+                for (auto& bucket : h.buckets) {
+                    buckets.emplace_back(get_value(bucket, reset));
+                }
+                nlohmann::json latency = { { "count", get_value(h.count, reset) },
+                    { "total_us", get_value(h.total_us, reset) }, { "max_us", get_value(h.max_us, reset) },
+                    { "buckets", std::move(buckets) } };
+                latencies_json.emplace(name, std::move(latency));
+            }
+            return { { "counters", std::move(counters_json) }, { "latencies", std::move(latencies_json) } };
+        }
+
+    } // namespace metrics
+} // namespace green
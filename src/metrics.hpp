@@ -0,0 +1,56 @@
+#ifndef GDK_METRICS_HPP
+#define GDK_METRICS_HPP
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <nlohmann/json_fwd.hpp>
+#include <string>
+
+namespace green {
+
+    //
+    // Process-wide counters and latency histograms for hot paths such as
+    // WAMP calls, rust calls, cache persistence and unblinding, returned
+    // by GA_get_metrics.
+    //
+    // Metrics are created on first use. Updating an existing metric only
+    // takes a shared lock to find it, and is otherwise lock-free.
+    //
+    namespace metrics {
+        using clock = std::chrono::steady_clock;
+
+        // Add 'n' to the counter 'name'
+        void count(const std::string& name, uint64_t n = 1);
+
+        // Record a latency sample for 'name'
+        void observe(const std::string& name, clock::duration elapsed);
+
+        // Return all metrics as JSON, optionally resetting them to zero
+        nlohmann::json get(bool reset);
+
+        // Records the time from construction until destruction as a latency sample
+        class scoped_timer final {
+        public:
+            explicit scoped_timer(std::string name)
+                : m_name(std::move(name))
+                , m_start(clock::now())
+            {
+            }
+
+            scoped_timer(const scoped_timer&) = delete;
+            scoped_timer& operator=(const scoped_timer&) = delete;
+            scoped_timer(scoped_timer&&) = delete;
+            scoped_timer& operator=(scoped_timer&&) = delete;
+
+            ~scoped_timer() { observe(m_name, clock::now() - m_start); }
+
+        private:
+            const std::string m_name;
+            const clock::time_point m_start;
+        };
+    } // namespace metrics
+
+} // namespace green
+
+#endif
@@ -0,0 +1,125 @@
+#include "network_cache.hpp"
+#include "assertion.hpp"
+#include "ga_tx.hpp"
+
+namespace green {
+
+    namespace {
+        // Maximum number of raw transactions held per network
+        static constexpr size_t MAX_RAW_TXS = 4096;
+
+        static std::mutex s_caches_mutex;
+        static std::map<std::string, std::weak_ptr<network_cache>> s_caches;
+    } // namespace
+
+    network_cache::network_cache(std::string network)
+        : m_network(std::move(network))
+    {
+    }
+
+    std::shared_ptr<network_cache> network_cache::get_shared_ref(const std::string& network)
+    {
+        std::unique_lock<std::mutex> locker{ s_caches_mutex };
+        // Prune caches for networks that are no longer in use
+        for (auto it = s_caches.begin(); it != s_caches.end();) {
+            it = it->second.expired() ? s_caches.erase(it) : std::next(it);
+        }
+        auto& weak = s_caches[network];
+        auto shared = weak.lock();
+        if (!shared) {
+            weak = shared = std::make_shared<network_cache>(network);
+        }
+        return shared;
+    }
+
+    network_cache::raw_tx_t network_cache::get_raw_tx(const txid_t& txid) const
+    {
+        std::unique_lock<std::mutex> locker{ m_mutex };
+        const auto p = m_raw_txs.find(txid);
+        return p == m_raw_txs.end() ? raw_tx_t() : p->second;
+    }
+
+    void network_cache::set_raw_tx(const txid_t& txid, const Tx& tx)
+    {
+        // Never share a tx under another txid, e.g. one returned in error
+        GDK_RUNTIME_ASSERT_MSG(tx.get_txid() == txid, "transaction does not match txid");
+        auto tx_bin = std::make_shared<const std::vector<unsigned char>>(tx.to_bytes());
+        std::unique_lock<std::mutex> locker{ m_mutex };
+        if (!m_raw_txs.emplace(txid, std::move(tx_bin)).second) {
+            return; // Already cached
+        }
+        m_raw_tx_order.push_back(txid);
+        if (m_raw_tx_order.size() > MAX_RAW_TXS) {
+            m_raw_txs.erase(m_raw_tx_order.front());
+            m_raw_tx_order.pop_front();
+        }
+    }
+
+    nlohmann::json network_cache::get_fee_estimates(clock::duration max_age) const
+    {
+        std::unique_lock<std::mutex> locker{ m_mutex };
+        if (m_fee_estimates.is_null() || clock::now() - m_fee_estimates_ts > max_age) {
+            return nlohmann::json();
+        }
+        return m_fee_estimates;
+    }
+
+    void network_cache::set_fee_estimates(const nlohmann::json& fee_estimates)
+    {
+        std::unique_lock<std::mutex> locker{ m_mutex };
+        m_fee_estimates = fee_estimates;
+        m_fee_estimates_ts = clock::now();
+    }
+
+    void network_cache::on_new_block(const std::string& block_hash)
+    {
+        std::unique_lock<std::mutex> locker{ m_mutex };
+        if (block_hash == m_block_hash) {
+            return; // Already seen via another session
+        }
+        m_block_hash = block_hash;
+        m_fee_estimates = nlohmann::json(); // Estimates change with each block
+    }
+
+    nlohmann::json network_cache::get_assets(
+        const std::string& registry, const std::vector<std::string>& asset_ids) const
+    {
+        nlohmann::json assets = nlohmann::json::object(), icons = nlohmann::json::object();
+        std::unique_lock<std::mutex> locker{ m_mutex };
+        const auto registry_p = m_assets.find(registry);
+        if (registry_p == m_assets.end()) {
+            return nlohmann::json(); // Not cached
+        }
+        const auto& cached = registry_p->second;
+        for (const auto& asset_id : asset_ids) {
+            const auto p = cached.assets.find(asset_id);
+            if (p == cached.assets.end()) {
+                return nlohmann::json(); // Not cached
+            }
+            assets.emplace(asset_id, *p);
+            if (const auto icon_p = cached.icons.find(asset_id); icon_p != cached.icons.end()) {
+                icons.emplace(asset_id, *icon_p);
+            }
+        }
+        return { { "assets", std::move(assets) }, { "icons", std::move(icons) } };
+    }
+
+    void network_cache::set_assets(const std::string& registry, const nlohmann::json& assets)
+    {
+        std::unique_lock<std::mutex> locker{ m_mutex };
+        auto& cached = m_assets[registry];
+        if (const auto p = assets.find("assets"); p != assets.end() && p->is_object()) {
+            cached.assets.update(*p);
+        }
+        if (const auto p = assets.find("icons"); p != assets.end() && p->is_object()) {
+            cached.icons.update(*p);
+        }
+    }
+
+    void network_cache::invalidate_assets()
+    {
+        std::unique_lock<std::mutex> locker{ m_mutex };
+        m_assets.clear();
+    }
+
+} // namespace green
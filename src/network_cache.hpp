@@ -0,0 +1,88 @@
+#ifndef GDK_NETWORK_CACHE_HPP
+#define GDK_NETWORK_CACHE_HPP
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ga_wally.hpp"
+
+namespace green {
+
+    class Tx;
+
+    //
+    // In-memory cache of network-wide data, shared between all sessions in
+    // the process that are connected to the same network.
+    //
+    // Only data that is either immutable (raw txs, asset details) or global
+    // to the network (fee estimates) is held here; wallet specific data lives
+    // in each sessions own encrypted cache. Block headers for SPV are already
+    // shared between sessions through the on-disk headers chain.
+    //
+    class network_cache final {
+    public:
+        using clock = std::chrono::steady_clock;
+        using raw_tx_t = std::shared_ptr<const std::vector<unsigned char>>;
+
+        explicit network_cache(std::string network);
+
+        network_cache(const network_cache&) = delete;
+        network_cache& operator=(const network_cache&) = delete;
+
+        // Get the cache for a network, creating it if needed. The cache is
+        // destroyed when the last session using it releases its reference.
+        static std::shared_ptr<network_cache> get_shared_ref(const std::string& network);
+
+        const std::string& get_network() const { return m_network; }
+
+        // Raw transactions, keyed by txid. Bounded; oldest entries are evicted.
+        // Throws if the transaction does not have the given txid.
+        raw_tx_t get_raw_tx(const txid_t& txid) const;
+        void set_raw_tx(const txid_t& txid, const Tx& tx);
+
+        // Fee estimates in server format, or null if absent or older than max_age
+        nlohmann::json get_fee_estimates(clock::duration max_age) const;
+        void set_fee_estimates(const nlohmann::json& fee_estimates);
+
+        // Called by each session on a new block notification. The first
+        // session to see a given block invalidates the cached fee estimates.
+        void on_new_block(const std::string& block_hash);
+
+        // Registry asset details/icons for the given asset ids, in the same
+        // format as GA_get_assets. Returns null unless all ids are cached.
+        // Assets are cached separately for each registry, identified by the
+        // registry connection string the session uses.
+        nlohmann::json get_assets(const std::string& registry, const std::vector<std::string>& asset_ids) const;
+        void set_assets(const std::string& registry, const nlohmann::json& assets);
+        void invalidate_assets();
+
+    private:
+        const std::string m_network;
+        mutable std::mutex m_mutex;
+
+        txid_map_t<raw_tx_t> m_raw_txs;
+        std::deque<txid_t> m_raw_tx_order;
+
+        nlohmann::json m_fee_estimates;
+        clock::time_point m_fee_estimates_ts;
+
+        std::string m_block_hash;
+
+        struct registry_assets {
+            nlohmann::json assets = nlohmann::json::object();
+            nlohmann::json icons = nlohmann::json::object();
+        };
+        std::map<std::string, registry_assets> m_assets;
+    };
+
+} // namespace green
+
+#endif
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <boost/algorithm/string/predicate.hpp>
 #include <mutex>
 
@@ -747,6 +748,9 @@ static std::map<std::string, std::shared_ptr<nlohmann::json>> registered_network
 namespace green {
 
     namespace {
+        // The largest number of addresses fetched in one address pool refill
+        constexpr uint32_t MAX_ADDRESS_POOL_SIZE = 1000;
+
         static std::string get_url(
             const nlohmann::json& details, const char* url_key, const char* onion_key, bool use_tor)
         {
@@ -790,6 +794,8 @@ namespace green {
             set_override(defaults, "blob_server_onion_url", user_overrides, empty);
             set_override(defaults, "blob_server_url", user_overrides, empty);
             set_override(defaults, "gap_limit", user_overrides, 20);
+            set_override(defaults, "optimistic_login", user_overrides, false);
+            set_override(defaults, "address_pool_size", user_overrides, 0);
             set_override(defaults, "address_explorer_url", user_overrides, empty);
             set_override(defaults, "address_explorer_onion_url", user_overrides, empty);
             set_override(defaults, "tx_explorer_url", user_overrides, empty);
@@ -935,6 +941,7 @@ namespace green {
     bool network_parameters::is_electrum() const { return m_details.value("server_type", std::string()) == "electrum"; }
     bool network_parameters::use_tor() const { return m_details.value("use_tor", false); }
     bool network_parameters::is_spv_enabled() const { return m_details.at("spv_enabled"); }
+    bool network_parameters::is_optimistic_login() const { return m_details.value("optimistic_login", false); }
     std::string network_parameters::user_agent() const { return m_details.value("user_agent", std::string()); }
     std::string network_parameters::get_connection_string(const std::string& config_prefix) const
     {
@@ -970,6 +977,10 @@ namespace green {
     // a weeks worth of blocks without cache deletion, and for testnet still allows cache finalization
     // testing while being unnaffected by normal chain operation.
     uint32_t network_parameters::get_max_reorg_blocks() const { return m_details.at("max_reorg_blocks"); }
+    uint32_t network_parameters::get_address_pool_size() const
+    {
+        return std::min(m_details.value("address_pool_size", 0u), MAX_ADDRESS_POOL_SIZE);
+    }
     std::optional<uint32_t> network_parameters::get_min_fee_rate() const { return j_uint32(m_details, "min_fee_rate"); }
     std::string network_parameters::get_price_url() const
     {
@@ -59,6 +59,7 @@ namespace green {
         bool is_electrum() const;
         bool use_tor() const;
         bool is_spv_enabled() const;
+        bool is_optimistic_login() const;
         bool electrum_tls() const;
         std::string user_agent() const;
         std::string get_connection_string(const std::string& prefix) const;
@@ -69,6 +70,7 @@ namespace green {
         bool is_valid_csv_value(uint32_t csv_blocks) const;
         uint32_t cert_expiry_threshold() const;
         uint32_t get_max_reorg_blocks() const;
+        uint32_t get_address_pool_size() const;
         std::optional<uint32_t> get_min_fee_rate() const;
         std::string get_price_url() const;
 
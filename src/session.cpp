@@ -4,6 +4,7 @@
 #include <mutex>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "session.hpp"
@@ -61,6 +62,15 @@ namespace green {
             config.emplace("registrydir", datadir + "/registry");
         }
 
+        if (!config.contains("io_threads")) {
+            config.emplace("io_threads", 0);
+        }
+        GDK_RUNTIME_ASSERT(config["io_threads"].is_number_integer());
+        if (config["io_threads"] < 0) {
+            // Size the shared io pool to the number of cores
+            config["io_threads"] = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
         if (init_done) {
             // It is invalid to call GA_init() with different configs.
             // Calling with the existing config is a no-op.
@@ -93,6 +103,12 @@ namespace green {
             global_log_level = log_level::severity_level::error;
         }
         boost::log::core::get()->set_filter(log_level::severity >= global_log_level);
+        gdk_log_level = global_log_level;
+#ifndef __ANDROID__
+        if (global_log_level != log_level::severity_level::fatal && j_bool_or_false(global_config, "log_async")) {
+            start_async_logging();
+        }
+#endif
 
         GDK_VERIFY(wally_init(0));
         auto entropy = get_random_bytes<WALLY_SECP_RANDOMIZE_LEN>();
@@ -136,6 +152,8 @@ namespace green {
     {
         GDK_RUNTIME_ASSERT(init_done);
         global_tor_ctrl.reset();
+        // Write out any queued log records
+        boost::log::core::get()->flush();
         return GA_OK;
     }
 
@@ -418,7 +436,19 @@ namespace green {
             }
             // The session is not connected. Conversion to fiat will
             // be attempted using any provided fallback fiat values.
-            return amount::convert(amount_json, std::string(), std::string());
+            return amount::convert(amount_json, std::string(), fiat_rate());
+        });
+    }
+
+    nlohmann::json session::convert_amounts(const nlohmann::json& amounts_json)
+    {
+        return exception_wrapper([&] {
+            auto p = get_impl();
+            if (p) {
+                return p->convert_amounts(amounts_json);
+            }
+            // As for convert_amount, use any provided fallback fiat values
+            return amount::convert_batch(amounts_json, std::string(), fiat_rate());
         });
     }
 
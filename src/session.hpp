@@ -68,6 +68,7 @@ namespace green {
         std::string get_system_message();
 
         nlohmann::json convert_amount(const nlohmann::json& amount_json);
+        nlohmann::json convert_amounts(const nlohmann::json& amounts_json);
 
         const network_parameters& get_network_parameters() const;
 
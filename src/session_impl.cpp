@@ -2,6 +2,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/strand.hpp>
+#include <boost/asio/use_future.hpp>
+#include <thread>
 
 #include "client_blob.hpp"
 #include "exception.hpp"
@@ -15,6 +17,8 @@
 #include "io_runner.hpp"
 #include "json_utils.hpp"
 #include "logging.hpp"
+#include "metrics.hpp"
+#include "network_cache.hpp"
 #include "session.hpp"
 #include "session_impl.hpp"
 #include "signer.hpp"
@@ -43,6 +47,28 @@ namespace green {
             return msgpack::unpack(reinterpret_cast<const char*>(buffer.data()), buffer.size());
         }
 
+        static std::shared_ptr<io_pool> get_session_io_pool()
+        {
+            const auto io_threads = gdk_config().value("io_threads", 0);
+            if (io_threads) {
+                return io_pool::get_shared_ref(io_threads);
+            }
+            return std::make_shared<io_pool>(1); // Use a dedicated thread
+        }
+
+        // Destroy a session, handing off to a new thread if called from one
+        // of the sessions io threads (e.g. from a notification handler).
+        // Destruction waits for the sessions pending handlers and may
+        // release the last reference to its io_pool, neither of which can
+        // be done from within the pool.
+        static void destroy_session_impl(session_impl* impl)
+        {
+            if (impl->running_in_io_pool()) {
+                std::thread([impl] { delete impl; }).detach();
+            } else {
+                delete impl;
+            }
+        }
     } // namespace
 
     std::shared_ptr<session_impl> session_impl::create(const nlohmann::json& net_params)
@@ -51,16 +77,17 @@ namespace green {
         network_parameters np{ net_params, defaults };
 
         if (np.is_electrum()) {
-            return std::make_shared<ga_rust>(std::move(np));
+            return std::shared_ptr<session_impl>(new ga_rust(std::move(np)), destroy_session_impl);
         }
-        return std::make_shared<ga_session>(std::move(np));
+        return std::shared_ptr<session_impl>(new ga_session(std::move(np)), destroy_session_impl);
     }
 
     session_impl::session_impl(network_parameters&& net_params)
         : m_net_params(net_params)
-        , m_io()
-        , m_strand(std::make_unique<boost::asio::io_context::strand>(m_io.get_io_context()))
+        , m_io(get_session_io_pool())
+        , m_strand(std::make_unique<io_pool::strand_t>(m_io->make_strand()))
         , m_user_proxy(socksify(m_net_params.get_json().value("proxy", std::string())))
+        , m_network_cache(network_cache::get_shared_ref(m_net_params.network()))
         , m_notification_handler(nullptr)
         , m_notification_context(nullptr)
         , m_login_data{}
@@ -82,7 +109,7 @@ namespace green {
         if (!m_net_params.get_blob_server_url().empty()) {
             constexpr bool is_mandatory = false;
             m_blobserver = std::make_shared<wamp_transport>(
-                m_net_params, *m_strand,
+                m_net_params, m_io->get_wamp_io_context(), *m_strand,
                 [](nlohmann::json details, bool) { GDK_LOG(info) << "blob_server notification: " << details.dump(); },
                 "blob_server", is_mandatory);
             m_wamp_connections.push_back(m_blobserver);
@@ -100,6 +127,15 @@ namespace green {
                 },
                 "ga_session wamp_transport");
         };
+        // Wait for any handlers posted by this session to complete, since
+        // our io_context may outlive us if it is shared with other sessions.
+        // All of our connections are closed above, so no more can be posted.
+        // Sessions created by create() are never destroyed on a pool thread,
+        // see destroy_session_impl(); blocking there could deadlock.
+        if (!running_in_io_pool()) {
+            no_std_exception_escape(
+                [this] { boost::asio::post(*m_strand, boost::asio::use_future).get(); }, "session_impl drain");
+        }
         no_std_exception_escape([this] { m_strand.reset(); }, "session_impl m_strand");
     }
 
@@ -158,9 +194,16 @@ namespace green {
     {
         // By default, ignore the async flag
         if (m_notify && m_notification_handler) {
+            const bool is_block = j_str_or_empty(details, "event") == "block";
             // We use 'new' here as it is the handlers responsibility to 'delete'
             const auto details_p = reinterpret_cast<GA_json*>(new nlohmann::json(std::move(details)));
             m_notification_handler(m_notification_context, details_p);
+            if (is_block && j_bool_or_false(gdk_config(), "metrics_notifications")) {
+                // Follow each new block with the current metrics
+                nlohmann::json metrics_details = { { "event", "metrics" }, { "metrics", metrics::get(false) } };
+                const auto metrics_p = reinterpret_cast<GA_json*>(new nlohmann::json(std::move(metrics_details)));
+                m_notification_handler(m_notification_context, metrics_p);
+            }
         }
     }
 
@@ -227,7 +270,7 @@ namespace green {
 
             std::shared_ptr<http_client> client;
             auto&& get = [&] {
-                client = make_http_client(m_io.get_io_context(), ssl_ctx.get());
+                client = make_http_client(*m_strand, ssl_ctx.get());
                 GDK_RUNTIME_ASSERT(client != nullptr);
 
                 const auto verb = boost::beast::http::string_to_verb(params["method"]);
@@ -281,6 +324,8 @@ namespace green {
 
         try {
             rust_call("refresh_assets", params);
+            // Asset details may have been updated by the refresh
+            m_network_cache->invalidate_assets();
         } catch (const std::exception& ex) {
             GDK_LOG(error) << "error refreshing assets: " << ex.what();
         }
@@ -290,6 +335,17 @@ namespace green {
     {
         GDK_RUNTIME_ASSERT(m_net_params.is_liquid());
 
+        // Lookups by asset id only can be served from the shared cache
+        const auto registry_config = get_registry_config();
+        const auto& registry = j_strref(registry_config, "url");
+        const bool is_id_lookup = params.size() == 1 && params.contains("assets_id");
+        if (is_id_lookup) {
+            const auto asset_ids = params["assets_id"].get<std::vector<std::string>>();
+            if (auto cached = m_network_cache->get_assets(registry, asset_ids); !cached.is_null()) {
+                return cached;
+            }
+        }
+
         // We only need to set the xpub if we're accessing the registry cache,
         // which in turn only happens if we're querying via asset ids.
         if (params.contains("assets_id")) {
@@ -300,10 +356,14 @@ namespace green {
                 }
             }
         }
-        params["config"] = get_registry_config();
+        params["config"] = registry_config;
 
         try {
-            return rust_call("get_assets", params);
+            auto result = rust_call("get_assets", params);
+            if (is_id_lookup && !result.contains("error")) {
+                m_network_cache->set_assets(registry, result);
+            }
+            return result;
         } catch (const std::exception& ex) {
             GDK_LOG(error) << "error fetching assets: " << ex.what();
             return { { "assets", nlohmann::json::object() }, { "icons", nlohmann::json::object() },
@@ -804,6 +864,16 @@ namespace green {
 
     nlohmann::json session_impl::get_scriptpubkey_data(byte_span_t /*scriptpubkey*/) { return nlohmann::json(); }
 
+    nlohmann::json session_impl::get_scriptpubkeys_data(gsl::span<const byte_span_t> scriptpubkeys)
+    {
+        nlohmann::json::array_t ret;
+        ret.reserve(scriptpubkeys.size());
+        for (const auto& scriptpubkey : scriptpubkeys) {
+            ret.emplace_back(get_scriptpubkey_data(scriptpubkey));
+        }
+        return ret;
+    }
+
     nlohmann::json session_impl::get_address_data(const nlohmann::json& /*details*/)
     {
         GDK_RUNTIME_ASSERT(false); // Only used by rust
@@ -1010,6 +1080,12 @@ namespace green {
         return nlohmann::json();
     }
 
+    nlohmann::json session_impl::query_transactions(const nlohmann::json& /*details*/)
+    {
+        // Overriden for multisig
+        throw user_error("Querying transactions is not supported for singlesig wallets");
+    }
+
     void session_impl::store_transactions(uint32_t /*subaccount*/, nlohmann::json& /*txs*/)
     {
         // Overriden for multisig
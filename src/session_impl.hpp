@@ -21,6 +21,7 @@ namespace green {
     class green_pubkeys;
     class user_pubkeys;
     class green_recovery_pubkeys;
+    class network_cache;
     class signer;
     class Tx;
     struct tor_controller;
@@ -42,6 +43,9 @@ namespace green {
         // Factory method
         static std::shared_ptr<session_impl> create(const nlohmann::json& net_params);
 
+        // Whether the caller is running on one of this sessions io threads
+        bool running_in_io_pool() const { return m_io->running_in_pool(); }
+
         // UTXOs
         using utxo_cache_value_t = std::shared_ptr<const nlohmann::json>;
 
@@ -110,6 +114,7 @@ namespace green {
         virtual void change_settings_limits(const nlohmann::json& limit_details, const nlohmann::json& twofactor_data)
             = 0;
         virtual nlohmann::json get_transactions(const nlohmann::json& details) = 0;
+        virtual nlohmann::json query_transactions(const nlohmann::json& details);
         virtual nlohmann::json sync_transactions(uint32_t subaccount, unique_pubkeys_and_scripts_t& missing);
         virtual void store_transactions(uint32_t subaccount, nlohmann::json& txs);
         virtual void postprocess_transactions(nlohmann::json& tx_list);
@@ -167,6 +172,9 @@ namespace green {
             const std::string& nonce_hex, const std::string& blinding_pubkey_hex);
         virtual void encache_new_scriptpubkeys(uint32_t subaccount);
         virtual nlohmann::json get_scriptpubkey_data(byte_span_t scriptpubkey);
+        // Look up multiple scriptpubkeys at once, returning an array with
+        // an (empty if not a wallet scriptpubkey) element for each one
+        virtual nlohmann::json get_scriptpubkeys_data(gsl::span<const byte_span_t> scriptpubkeys);
         virtual nlohmann::json get_address_data(const nlohmann::json& details);
         virtual void upload_confidential_addresses(
             uint32_t subaccount, const std::vector<std::string>& confidential_addresses)
@@ -197,6 +205,7 @@ namespace green {
         nlohmann::json cache_control(const nlohmann::json& details);
 
         virtual nlohmann::json convert_amount(const nlohmann::json& amount_json) const = 0;
+        virtual nlohmann::json convert_amounts(const nlohmann::json& amounts_json) const = 0;
 
         virtual amount get_min_fee_rate() const = 0;
         virtual amount get_default_fee_rate() const = 0;
@@ -209,6 +218,7 @@ namespace green {
         virtual void disable_all_pin_logins() = 0;
 
         const network_parameters& get_network_parameters() const { return m_net_params; }
+        network_cache& get_network_cache() const { return *m_network_cache; }
         std::shared_ptr<signer> get_nonnull_signer(locker_t& locker);
         std::shared_ptr<signer> get_nonnull_signer();
         std::shared_ptr<signer> get_signer();
@@ -301,11 +311,13 @@ namespace green {
 
         // Immutable upon construction
         const network_parameters m_net_params;
-        io_runner<1> m_io;
-        std::unique_ptr<boost::asio::io_context::strand> m_strand;
+        std::shared_ptr<io_pool> m_io; // Shared between sessions if "io_threads" is set
+        std::unique_ptr<io_pool::strand_t> m_strand; // Serializes this sessions handlers
 
         const std::string m_user_proxy;
         std::shared_ptr<tor_controller> m_tor_ctrl;
+        // Network-wide data, shared with other sessions on the same network
+        const std::shared_ptr<network_cache> m_network_cache;
 
         // Immutable once set by the caller (prior to connect)
         GA_notification_handler m_notification_handler;
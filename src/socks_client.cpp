@@ -4,12 +4,11 @@
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/trim.hpp>
-#include <boost/asio/io_context.hpp>
 #include <boost/asio/read.hpp>
-#include <boost/asio/strand.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/beast/core.hpp>
 #include <chrono>
+#include <utility>
 
 #include "assertion.hpp"
 #include "logging.hpp"
@@ -23,17 +22,21 @@ namespace beast = boost::beast;
 
 namespace green {
 
-    socks_client::socks_client(asio::io_context& io, boost::beast::tcp_stream& stream)
-        : m_resolver(asio::make_strand(io))
+    socks_client::socks_client(boost::beast::tcp_stream& stream)
+        : m_resolver(stream.get_executor())
+        , m_resolve_timer(stream.get_executor())
         , m_stream(stream)
     {
     }
 
-    std::future<void> socks_client::run(const std::string& endpoint, const std::string& proxy_uri)
+    void socks_client::async_run(const std::string& endpoint, const std::string& proxy_uri,
+        std::chrono::steady_clock::duration timeout, completion_fn fn)
     {
-        GDK_LOG(debug) << "socks_client:run";
+        GDK_LOG(debug) << "socks_client:async_run";
 
+        GDK_RUNTIME_ASSERT(fn);
         m_endpoint = endpoint;
+        m_completion_fn = std::move(fn);
 
         std::string proxy = algo::trim_copy(proxy_uri);
         GDK_RUNTIME_ASSERT(algo::starts_with(proxy, "socks5://"));
@@ -46,9 +49,14 @@ namespace green {
         const auto host = proxy_parts[0];
         const auto port = proxy_parts[1];
 
+        // The stream expiry bounds connecting and the handshake. Resolving
+        // doesn't use the stream, so bound it by a timer to the same deadline
+        m_deadline = std::chrono::steady_clock::now() + timeout;
+        m_stream.expires_at(m_deadline);
+        m_resolve_timer.expires_at(m_deadline);
+        m_resolve_timer.async_wait(
+            beast::bind_front_handler(&socks_client::on_resolve_timeout, shared_from_this()));
         m_resolver.async_resolve(host, port, beast::bind_front_handler(&socks_client::on_resolve, shared_from_this()));
-
-        return m_promise.get_future();
     }
 
     void socks_client::shutdown()
@@ -62,10 +70,28 @@ namespace green {
         }
     }
 
+    void socks_client::on_resolve_timeout(beast::error_code ec)
+    {
+        if (ec == asio::error::operation_aborted) {
+            return; // Resolved in time
+        }
+        // Cancelling doesn't interrupt a lookup in progress, so fail now
+        // rather than waiting for it to return
+        m_resolver.cancel();
+        set_exception("timed out resolving proxy host");
+    }
+
     void socks_client::on_resolve(beast::error_code ec, const asio::ip::tcp::resolver::results_type& results)
     {
         GDK_LOG(debug) << "socks_client:on_resolve";
 
+        m_resolve_timer.cancel();
+        if (!m_completion_fn) {
+            return; // Already timed out
+        }
+        if (std::chrono::steady_clock::now() >= m_deadline) {
+            return set_exception("timed out resolving proxy host");
+        }
         NET_ERROR_CODE_CHECK("socks_client", ec);
         m_stream.async_connect(results, beast::bind_front_handler(&socks_client::on_connect, shared_from_this()));
     }
@@ -146,7 +172,7 @@ namespace green {
             asio::async_read(m_stream, asio::buffer(m_response),
                 beast::bind_front_handler(&socks_client::on_domain_name_read, shared_from_this()));
         } else {
-            m_promise.set_value();
+            set_result();
         }
     }
 
@@ -157,7 +183,7 @@ namespace green {
 
         NET_ERROR_CODE_CHECK("socks_client", ec);
 
-        m_promise.set_value();
+        set_result();
     }
 
     asio::const_buffer socks_client::method_selection_request()
@@ -224,9 +250,19 @@ namespace green {
         __builtin_unreachable();
     }
 
+    void socks_client::set_result()
+    {
+        if (auto fn = std::exchange(m_completion_fn, nullptr)) {
+            fn(std::string());
+        }
+    }
+
     void socks_client::set_exception(const std::string& what)
     {
-        m_promise.set_exception(std::make_exception_ptr(std::runtime_error(what)));
+        GDK_RUNTIME_ASSERT(!what.empty());
+        if (auto fn = std::exchange(m_completion_fn, nullptr)) {
+            fn(what);
+        }
     }
 
 } // namespace green
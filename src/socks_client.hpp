@@ -2,9 +2,10 @@
 #define GDK_SOCKS_CLIENT_HPP
 #pragma once
 
-#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/beast/core.hpp>
-#include <future>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -13,7 +14,8 @@ namespace green {
 
     class socks_client final : public std::enable_shared_from_this<socks_client> {
     public:
-        explicit socks_client(boost::asio::io_context& io, boost::beast::tcp_stream& stream);
+        // Runs on the executor of stream
+        explicit socks_client(boost::beast::tcp_stream& stream);
 
         socks_client(const socks_client&) = delete;
         socks_client(socks_client&&) = delete;
@@ -21,7 +23,15 @@ namespace green {
         socks_client& operator=(socks_client&&) = delete;
         ~socks_client() = default;
 
-        std::future<void> run(const std::string& endpoint, const std::string& proxy_uri);
+        // Called once the proxy connection is established, with an empty
+        // string on success or an error message on failure
+        using completion_fn = std::function<void(const std::string& error)>;
+
+        // Connect to endpoint via the proxy without blocking the caller.
+        // Resolving the proxy host, connecting to it and the handshake must
+        // all complete within timeout. Sets the expiry of the stream.
+        void async_run(const std::string& endpoint, const std::string& proxy_uri,
+            std::chrono::steady_clock::duration timeout, completion_fn fn);
         void shutdown();
 
     private:
@@ -39,6 +49,7 @@ namespace green {
 
         enum class negotiation_phase { method_selection, connect };
 
+        void on_resolve_timeout(boost::beast::error_code ec);
         void on_resolve(boost::beast::error_code ec, const boost::asio::ip::tcp::resolver::results_type& results);
         void on_connect(
             boost::beast::error_code ec, const boost::asio::ip::tcp::resolver::results_type::endpoint_type& type);
@@ -48,6 +59,7 @@ namespace green {
         void on_domain_name_read(boost::beast::error_code ec, size_t bytes_transferred);
 
         std::string get_error_string(uint8_t response);
+        void set_result();
         void set_exception(const std::string& what);
 
         // SOCKS5 request. TODO: this is a simplified version of the code PR'd to websocketpp
@@ -55,6 +67,8 @@ namespace green {
         boost::asio::const_buffer connect_request(const std::string& url);
 
         boost::asio::ip::tcp::resolver m_resolver;
+        boost::asio::steady_timer m_resolve_timer;
+        std::chrono::steady_clock::time_point m_deadline;
         boost::beast::tcp_stream& m_stream;
         std::string m_endpoint;
 
@@ -62,7 +76,7 @@ namespace green {
         std::vector<unsigned char> m_response;
         negotiation_phase m_negotiation_phase{ negotiation_phase::method_selection };
 
-        std::promise<void> m_promise;
+        completion_fn m_completion_fn;
     };
 
 } // namespace green
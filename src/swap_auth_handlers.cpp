@@ -1,6 +1,7 @@
 #include "swap_auth_handlers.hpp"
 #include "ga_auth_handlers.hpp"
 
+#include "amount.hpp"
 #include "assertion.hpp"
 #include "exception.hpp"
 #include "ga_strings.hpp"
@@ -8,6 +9,7 @@
 #include "ga_wally.hpp"
 #include "json_utils.hpp"
 #include "logging.hpp"
+#include "memory.hpp"
 #include "session.hpp"
 #include "session_impl.hpp"
 #include "signer.hpp"
@@ -16,11 +18,17 @@
 #include "validate.hpp"
 #include "xpub_hdkey.hpp"
 
+#include <algorithm>
+#include <map>
+#include <optional>
+
 namespace green {
 
     namespace {
         static const std::string LIQUIDEX_STR("liquidex_v1");
         static constexpr uint32_t LIQUIDEX_VERSION = 1;
+        // Maximum serialized proposal length for each maker input/output pair
+        static constexpr size_t LIQUIDEX_MAX_LEN_PER_OUTPUT = 20000;
 
         static void add_asset_utxos(
             const nlohmann::json& utxos, const std::string& asset_id, nlohmann::json::array_t& tx_inputs)
@@ -59,20 +67,10 @@ namespace green {
             return res;
         }
 
-        static nlohmann::json::array_t liquidex_aggregate_scalars(
-            nlohmann::json::array_t& inputs, nlohmann::json::array_t& outputs)
-        {
-            GDK_RUNTIME_ASSERT(inputs.size() == 1 && outputs.size() == 1);
-            const auto input_scalar = j_bytesref(inputs[0], "scalar");
-            const auto output_scalar = j_bytesref(outputs[0], "scalar");
-            outputs[0].erase("scalar");
-            inputs[0].erase("scalar");
-            return { b2h(ec_scalar_subtract(input_scalar, output_scalar)) };
-        }
-
-        static nlohmann::json liquidex_get_maker_input(const Tx& tx, const nlohmann::json& proposal_input)
+        static nlohmann::json liquidex_get_maker_input(
+            const Tx& tx, size_t index, const nlohmann::json& proposal_input)
         {
-            auto maker_input = tx.input_to_json(0);
+            auto maker_input = tx.input_to_json(index);
             if (!maker_input.contains("witness")) {
                 throw user_error("Maker input is not segwit");
             }
@@ -87,18 +85,18 @@ namespace green {
         }
 
         static nlohmann::json liquidex_get_maker_addressee(
-            const network_parameters& net_params, const Tx& tx, const nlohmann::json& proposal_output)
+            const network_parameters& net_params, const Tx& tx, size_t index, const nlohmann::json& proposal_output)
         {
-            GDK_RUNTIME_ASSERT(tx.get_num_outputs());
-            const auto& tx_output = tx.get_output(0);
+            GDK_RUNTIME_ASSERT(index < tx.get_num_outputs());
+            const auto& tx_output = tx.get_output(index);
             const auto rangeproof = gsl::make_span(tx_output.rangeproof, tx_output.rangeproof_len);
             const auto commitment = gsl::make_span(tx_output.value, tx_output.value_len);
             const auto nonce = gsl::make_span(tx_output.nonce, tx_output.nonce_len);
             const auto scriptpubkey = gsl::make_span(tx_output.script, tx_output.script_len);
 
             nlohmann::json ret = { { "address", get_address_from_scriptpubkey(net_params, scriptpubkey) },
-                { "is_confidential", false }, { "index", 0 }, { "nonce_commitment", b2h(nonce) },
-                { "is_blinded", true }, { "index", 0 }, { "nonce_commitment", b2h(nonce) },
+                { "is_confidential", false }, { "index", index }, { "nonce_commitment", b2h(nonce) },
+                { "is_blinded", true },
                 { "commitment", b2h(commitment) }, { "range_proof", b2h(rangeproof) },
                 { "asset_id", proposal_output.at("asset") }, { "assetblinder", proposal_output.at("asset_blinder") },
                 { "satoshi", j_amountref(proposal_output).value() } };
@@ -108,42 +106,200 @@ namespace green {
             return ret;
         }
 
-        static std::unique_ptr<Tx> liquidex_validate_proposal(const nlohmann::json& proposal)
+        static std::unique_ptr<Tx> liquidex_validate_proposal(const nlohmann::json& proposal, size_t proposal_len)
         {
             constexpr bool is_liquid = true;
             GDK_RUNTIME_ASSERT_MSG(proposal.at("version") == LIQUIDEX_VERSION, "unknown version");
-            GDK_RUNTIME_ASSERT_MSG(proposal.dump().length() < 20000, "proposal exceeds maximum length");
-            const auto& proposal_input = j_arrayref(proposal, "inputs", 1).at(0);
-            const auto& proposal_output = j_arrayref(proposal, "outputs", 1).at(0);
-            const auto scalar = h2b(j_arrayref(proposal, "scalars", 1).at(0));
-            GDK_RUNTIME_ASSERT_MSG(ec_scalar_verify(scalar), "invalid scalar");
+            // Each maker input is paired with the maker output of the same
+            // index by its SIGHASH_SINGLE signature, and each output has a
+            // scalar to be applied when the taker blinds.
+            const auto& proposal_inputs = j_arrayref(proposal, "inputs");
+            const auto& proposal_outputs = j_arrayref(proposal, "outputs");
+            const auto& scalars = j_arrayref(proposal, "scalars");
+            const size_t num_outputs = proposal_outputs.size();
+            const bool is_paired = proposal_inputs.size() == num_outputs && scalars.size() == num_outputs;
+            GDK_RUNTIME_ASSERT_MSG(num_outputs && is_paired, "unexpected number of inputs or outputs");
             GDK_RUNTIME_ASSERT_MSG(
-                proposal_input.at("asset") != proposal_output.at("asset"), "cannot swap the same asset");
+                proposal_len < LIQUIDEX_MAX_LEN_PER_OUTPUT * num_outputs, "proposal exceeds maximum length");
+            for (const auto& scalar : scalars) {
+                GDK_RUNTIME_ASSERT_MSG(ec_scalar_verify(h2b(scalar)), "invalid scalar");
+            }
+            // A proposal swaps a single asset for a single other asset
+            const auto& input_asset = proposal_inputs.front().at("asset");
+            const auto& output_asset_hex = proposal_outputs.front().at("asset");
+            for (size_t i = 0; i < num_outputs; ++i) {
+                GDK_RUNTIME_ASSERT_MSG(proposal_inputs[i].at("asset") == input_asset
+                        && proposal_outputs[i].at("asset") == output_asset_hex,
+                    "proposal inputs or outputs have mixed assets");
+            }
+            GDK_RUNTIME_ASSERT_MSG(input_asset != output_asset_hex, "cannot swap the same asset");
             auto tx = std::make_unique<Tx>(j_strref(proposal, "transaction"), is_liquid);
-            GDK_RUNTIME_ASSERT_MSG(
-                tx->get_num_inputs() == 1 && tx->get_num_outputs() == 1, "unexpected number of inputs or outputs");
-
-            // Verify unblinded values match the transaction commitments
-            // TODO: obtain the previous output and verify the input commitments
-            const auto output_asset = j_rbytesref(proposal_output, "asset");
-            const auto output_abf = j_rbytesref(proposal_output, "asset_blinder");
-            const auto output_value = j_amountref(proposal_output).value();
-            const auto value_blind_proof = j_bytesref(proposal_output, "value_blind_proof");
-            const auto output_asset_commitment = asset_generator_from_bytes(output_asset, output_abf);
-            const auto& tx_output = tx->get_output(0);
-            const auto output_value_commitment = gsl::make_span(tx_output.value, tx_output.value_len);
-
-            bool have_matched_asset_commitment = tx_output.asset_len == output_asset_commitment.size()
-                && !memcmp(tx_output.asset, output_asset_commitment.data(), tx_output.asset_len);
-            GDK_RUNTIME_ASSERT_MSG(have_matched_asset_commitment, "unblinded asset does not match commitment");
-
-            bool value_verifies = explicit_rangeproof_verify(
-                value_blind_proof, output_value, output_value_commitment, output_asset_commitment);
-            GDK_RUNTIME_ASSERT_MSG(value_verifies, "cannot verify unblinded value matches commitment");
+            GDK_RUNTIME_ASSERT_MSG(tx->get_num_inputs() == num_outputs && tx->get_num_outputs() == num_outputs,
+                "unexpected number of inputs or outputs");
+
+            // Verify unblinded values match the transaction commitments.
+            // The input commitments are in the previous outputs, which are
+            // verified by the taker when completing the swap.
+            const auto output_asset = j_rbytesref(proposal_outputs.front(), "asset");
+            for (size_t i = 0; i < num_outputs; ++i) {
+                const auto& proposal_output = proposal_outputs[i];
+                const auto output_abf = j_rbytesref(proposal_output, "asset_blinder");
+                const auto output_value = j_amountref(proposal_output).value();
+                const auto value_blind_proof = j_bytesref(proposal_output, "value_blind_proof");
+                const auto output_asset_commitment = asset_generator_from_bytes(output_asset, output_abf);
+                const auto& tx_output = tx->get_output(i);
+                const auto output_value_commitment = gsl::make_span(tx_output.value, tx_output.value_len);
+
+                bool have_matched_asset_commitment = tx_output.asset_len == output_asset_commitment.size()
+                    && !memcmp(tx_output.asset, output_asset_commitment.data(), tx_output.asset_len);
+                GDK_RUNTIME_ASSERT_MSG(have_matched_asset_commitment, "unblinded asset does not match commitment");
+
+                bool value_verifies = explicit_rangeproof_verify(
+                    value_blind_proof, output_value, output_value_commitment, output_asset_commitment);
+                GDK_RUNTIME_ASSERT_MSG(value_verifies, "cannot verify unblinded value matches commitment");
+            }
             return tx;
         }
+
+        static std::unique_ptr<Tx> liquidex_validate_proposal(const nlohmann::json& proposal)
+        {
+            return liquidex_validate_proposal(proposal, proposal.dump().length());
+        }
+
+        static void liquidex_verify_maker_inputs(
+            session_impl& session, const Tx& tx, const nlohmann::json::array_t& proposal_inputs)
+        {
+            // Verify unblinded values match the previous output commitments
+            const auto input_asset = j_rbytesref(proposal_inputs.front(), "asset");
+            for (size_t i = 0; i < proposal_inputs.size(); ++i) {
+                const auto& proposal_input = proposal_inputs[i];
+                const auto& tx_input = tx.get_input(i);
+                const auto txhash_hex = b2h_rev({ tx_input.txhash, sizeof(tx_input.txhash) });
+                const auto prev_tx = session.get_raw_transaction_details(txhash_hex);
+                GDK_RUNTIME_ASSERT_MSG(tx_input.index < prev_tx.get_num_outputs(), "maker input not found");
+                const auto& prevout = prev_tx.get_output(tx_input.index);
+
+                const auto input_abf = j_rbytesref(proposal_input, "asset_blinder");
+                const auto input_value = j_amountref(proposal_input).value();
+                const auto value_blind_proof = j_bytesref(proposal_input, "value_blind_proof");
+                const auto input_asset_commitment = asset_generator_from_bytes(input_asset, input_abf);
+                const auto input_value_commitment = gsl::make_span(prevout.value, prevout.value_len);
+
+                bool have_matched_asset_commitment = prevout.asset_len == input_asset_commitment.size()
+                    && !memcmp(prevout.asset, input_asset_commitment.data(), prevout.asset_len);
+                GDK_RUNTIME_ASSERT_MSG(have_matched_asset_commitment, "unblinded asset does not match commitment");
+
+                bool value_verifies = explicit_rangeproof_verify(
+                    value_blind_proof, input_value, input_value_commitment, input_asset_commitment);
+                GDK_RUNTIME_ASSERT_MSG(value_verifies, "cannot verify unblinded value matches commitment");
+            }
+        }
     } // namespace
 
+    nlohmann::json::array_t liquidex_aggregate_scalars(
+        nlohmann::json::array_t& inputs, nlohmann::json::array_t& outputs)
+    {
+        // Inputs and outputs are paired by SIGHASH_SINGLE
+        GDK_RUNTIME_ASSERT(!inputs.empty() && inputs.size() == outputs.size());
+        // Sum the input scalars, less the output scalars
+        auto scalar = ec_scalar_subtract(j_bytesref(inputs[0], "scalar"), j_bytesref(outputs[0], "scalar"));
+        for (size_t i = 1; i < inputs.size(); ++i) {
+            scalar = ec_scalar_add(scalar, j_bytesref(inputs[i], "scalar"));
+            scalar = ec_scalar_subtract(scalar, j_bytesref(outputs[i], "scalar"));
+        }
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            inputs[i].erase("scalar");
+            outputs[i].erase("scalar");
+        }
+        // The taker must provide one scalar per pre-blinded output
+        // when blinding, so split the aggregate into random shares
+        // with the same sum, one per output.
+        nlohmann::json::array_t scalars;
+        scalars.reserve(outputs.size());
+        for (size_t i = 1; i < outputs.size(); ++i) {
+            std::array<unsigned char, EC_SCALAR_LEN> share;
+            do {
+                share = get_random_bytes<EC_SCALAR_LEN>();
+            } while (!ec_scalar_verify(share));
+            scalar = ec_scalar_subtract(scalar, share);
+            scalars.emplace_back(b2h(share));
+        }
+        GDK_RUNTIME_ASSERT(ec_scalar_verify(scalar));
+        scalars.emplace_back(b2h(scalar));
+        return scalars;
+    }
+
+    nlohmann::json::array_t liquidex_validate_proposals(const nlohmann::json& proposals)
+    {
+        GDK_RUNTIME_ASSERT_MSG(proposals.is_array(), "proposals must be an array");
+        const size_t num_proposals = proposals.size();
+
+        // Identical proposals are only validated once
+        struct unique_proposal_t {
+            size_t index; // Index of the first occurrence in proposals
+            size_t length; // Length of its serialized JSON
+            std::vector<std::pair<txid_t, uint32_t>> maker_inputs; // Set if valid
+            nlohmann::json::array_t errors;
+        };
+        std::vector<unique_proposal_t> unique;
+        std::vector<size_t> unique_indices(num_proposals);
+        {
+            std::map<std::array<unsigned char, SHA256_LEN>, size_t> seen;
+            for (size_t i = 0; i < num_proposals; ++i) {
+                const auto dumped = proposals[i].dump();
+                const auto [p, inserted] = seen.emplace(sha256(ustring_span(dumped)), unique.size());
+                if (inserted) {
+                    unique.push_back({ i, dumped.size(), {}, {} });
+                }
+                unique_indices[i] = p->second;
+            }
+        }
+
+        // Validate the unique proposals in parallel
+        parallel_for_each_index(unique.size(), [&proposals, &unique](size_t n) {
+            auto& u = unique[n];
+            try {
+                const auto tx = liquidex_validate_proposal(proposals[u.index], u.length);
+                for (const auto& input : tx->get_inputs()) {
+                    txid_t txid;
+                    std::copy(std::begin(input.txhash), std::end(input.txhash), txid.begin());
+                    u.maker_inputs.emplace_back(txid, input.index);
+                }
+            } catch (const std::exception& e) {
+                u.errors.emplace_back(e.what());
+            }
+        });
+
+        // Return per-proposal results, rejecting proposals that spend any
+        // of the same maker inputs as an earlier valid proposal
+        nlohmann::json::array_t results;
+        results.reserve(num_proposals);
+        std::map<std::pair<txid_t, uint32_t>, size_t> maker_inputs;
+        for (size_t i = 0; i < num_proposals; ++i) {
+            const auto& u = unique[unique_indices[i]];
+            std::optional<size_t> duplicate_of;
+            for (const auto& maker_input : u.maker_inputs) {
+                if (const auto p = maker_inputs.find(maker_input); p != maker_inputs.end()) {
+                    duplicate_of = p->second;
+                    break;
+                }
+            }
+            nlohmann::json result = { { "is_valid", false }, { "errors", u.errors } };
+            if (duplicate_of.has_value()) {
+                result["errors"].emplace_back(
+                    "proposal spends a maker input of proposal " + std::to_string(*duplicate_of));
+                result["duplicate_of"] = *duplicate_of;
+            } else if (u.errors.empty()) {
+                result["is_valid"] = true;
+                for (const auto& maker_input : u.maker_inputs) {
+                    maker_inputs.emplace(maker_input, i);
+                }
+            }
+            results.emplace_back(std::move(result));
+        }
+        return results;
+    }
+
     //
     // Create swap transaction
     //
@@ -170,14 +326,21 @@ namespace green {
     auth_handler::state_type create_swap_transaction_call::liquidex_impl()
     {
         const auto& liquidex_details = m_details.at(LIQUIDEX_STR);
-        const auto& send = j_arrayref(liquidex_details, "send", 1).at(0);
-        const auto& receive = j_arrayref(liquidex_details, "receive", 1).at(0);
+        const auto& send = j_arrayref(liquidex_details, "send");
+        const auto& receive = j_arrayref(liquidex_details, "receive");
+        // Each send utxo is paired with the receive output of the same index
+        GDK_RUNTIME_ASSERT_MSG(!send.empty() && send.size() == receive.size(), "send and receive sizes must match");
+        for (size_t i = 1; i < send.size(); ++i) {
+            GDK_RUNTIME_ASSERT_MSG(send[i].at("asset_id") == send[0].at("asset_id")
+                    && receive[i].at("asset_id") == receive[0].at("asset_id"),
+                "send and receive must each contain a single asset");
+        }
         // TODO: We may wish to allow receiving to a different subaccount.
         //       For now, receive to the same subaccount we are sending from
-        const uint32_t subaccount = send.at("subaccount");
+        const uint32_t subaccount = send.front().at("subaccount");
 
-        if (m_receive_address.empty()) {
-            // Fetch a new address to receive the swapped asset on
+        if (m_receive_addresses.size() < receive.size()) {
+            // Fetch a new address to receive each swapped output on
             // TODO: Further validate the inputs
             const nlohmann::json addr_details = { { "subaccount", subaccount } };
             add_next_handler(new get_receive_address_call(m_session_parent, addr_details));
@@ -185,14 +348,19 @@ namespace green {
         }
         if (m_create_details.empty()) {
             // Call create_transaction to create the swap tx
-            nlohmann::json addressee = std::move(m_receive_address);
-            m_receive_address["used"] = true; // Make sure m_receive_address.empty() isn't true
-            addressee.update(receive);
-            nlohmann::json::array_t addressees{ std::move(addressee) };
-            std::vector<nlohmann::json> tx_inputs{ send };
-            nlohmann::json utxos{ { send.at("asset_id"), tx_inputs } };
+            nlohmann::json::array_t addressees;
+            addressees.reserve(receive.size());
+            for (size_t i = 0; i < receive.size(); ++i) {
+                nlohmann::json addressee = std::move(m_receive_addresses[i]);
+                addressee.update(receive[i]);
+                addressees.emplace_back(std::move(addressee));
+            }
+            nlohmann::json::array_t tx_inputs(send.begin(), send.end());
+            nlohmann::json utxos{ { send.front().at("asset_id"), tx_inputs } };
+            // Inputs must not be re-ordered, as they are paired with outputs
             nlohmann::json create_details = { { "addressees", std::move(addressees) }, { "is_partial", true },
-                { "utxo_strategy", "manual" }, { "utxos", utxos }, { "transaction_inputs", std::move(tx_inputs) } };
+                { "utxo_strategy", "manual" }, { "utxos", std::move(utxos) },
+                { "transaction_inputs", std::move(tx_inputs) }, { "randomize_inputs", false } };
             add_next_handler(new create_transaction_call(m_session_parent, create_details));
             return state_type::make_call;
         }
@@ -208,7 +376,9 @@ namespace green {
 
         // Call sign_transaction to sign the callers side
         constexpr uint32_t sighash_flags = WALLY_SIGHASH_SINGLE | WALLY_SIGHASH_ANYONECANPAY;
-        m_create_details.at("transaction_inputs").at(0)["user_sighash"] = sighash_flags;
+        for (auto& tx_input : m_create_details.at("transaction_inputs")) {
+            tx_input["user_sighash"] = sighash_flags;
+        }
         // For AMP, skip server signing for multisig. The taker will ask the
         // backend to sign the completed swap since AMP only signs SIGHASH_ALL
         const bool is_amp_tx = m_create_details.contains("blinding_nonces");
@@ -219,9 +389,10 @@ namespace green {
 
     void create_swap_transaction_call::on_next_handler_complete(auth_handler* next_handler)
     {
-        if (m_receive_address.empty()) {
-            // Call result is our new receive address
-            m_receive_address = std::move(next_handler->move_result());
+        const auto& receive = j_arrayref(m_details.at(LIQUIDEX_STR), "receive");
+        if (m_receive_addresses.size() < receive.size()) {
+            // Call result is a new receive address
+            m_receive_addresses.emplace_back(std::move(next_handler->move_result()));
         } else if (m_create_details.empty()) {
             // Call result is our created/blinded tx
             m_create_details = std::move(next_handler->move_result());
@@ -234,14 +405,15 @@ namespace green {
             nlohmann::json::array_t inputs = liquidex_get_fields(tx_inputs);
             nlohmann::json::array_t outputs = liquidex_get_fields(tx_outputs);
             nlohmann::json::array_t scalars = liquidex_aggregate_scalars(inputs, outputs);
-            GDK_RUNTIME_ASSERT(!inputs[0].contains("scalar") && !outputs[0].contains("scalar"));
             auto proposal = nlohmann::json({ { "version", LIQUIDEX_VERSION },
                 { "transaction", std::move(result["transaction"]) }, { "inputs", std::move(inputs) },
                 { "outputs", std::move(outputs) }, { "scalars", std::move(scalars) } });
             if (auto p = result.find("blinding_nonces"); p != result.end()) {
-                // AMP: Make the prevout script and blinding nonce available
-                proposal["inputs"][0]["script"] = std::move(tx_inputs.at(0).at("prevout_script"));
-                proposal["outputs"][0]["blinding_nonce"] = p->at(0);
+                // AMP: Make the prevout scripts and blinding nonces available
+                for (size_t i = 0; i < tx_inputs.size(); ++i) {
+                    proposal["inputs"][i]["script"] = std::move(tx_inputs.at(i).at("prevout_script"));
+                    proposal["outputs"][i]["blinding_nonce"] = p->at(i);
+                }
             }
             m_result[LIQUIDEX_STR] = nlohmann::json::object();
             m_result[LIQUIDEX_STR]["proposal"] = std::move(proposal);
@@ -277,15 +449,24 @@ namespace green {
 
     auth_handler::state_type complete_swap_transaction_call::liquidex_impl()
     {
-        // TODO: allow to take multiple proposal at once
-        const auto& proposal = j_arrayref(m_details.at(LIQUIDEX_STR), "proposals", 1).at(0);
+        const auto& proposals = j_arrayref(m_details.at(LIQUIDEX_STR), "proposals");
+        if (proposals.size() != 1) {
+            // Each proposal is signed by its maker over its own transaction,
+            // so taking several would require merging them into one tx.
+            throw user_error("Only one LiquiDEX proposal can be completed at a time");
+        }
+        const auto& proposal = proposals.front();
         if (!m_tx) {
-            m_tx = liquidex_validate_proposal(proposal);
+            auto tx = liquidex_validate_proposal(proposal);
+            liquidex_verify_maker_inputs(*m_session, *tx, j_arrayref(proposal, "inputs"));
+            m_tx = std::move(tx);
         }
-        const auto& proposal_input = proposal.at("inputs").at(0);
-        const std::string maker_asset_id = proposal_input.at("asset");
-        const auto& proposal_output = proposal.at("outputs").at(0);
-        const std::string taker_asset_id = proposal_output.at("asset");
+        // Validation ensures that all maker inputs are of one asset, and
+        // all maker outputs are of one other asset
+        const auto& proposal_inputs = proposal.at("inputs");
+        const std::string maker_asset_id = proposal_inputs.at(0).at("asset");
+        const auto& proposal_outputs = proposal.at("outputs");
+        const std::string taker_asset_id = proposal_outputs.at(0).at("asset");
         const auto& utxos = m_details.at("utxos");
         // Get the subaccount from the first taker_asset_id utxo
         const uint32_t subaccount = utxos.at(taker_asset_id).at(0).at("subaccount");
@@ -297,20 +478,28 @@ namespace green {
             return state_type::make_call;
         }
         if (m_create_details.empty()) {
-            // Get the input UTXOs
-            auto maker_input = liquidex_get_maker_input(*m_tx, proposal_input);
-            nlohmann::json::array_t tx_inputs = { std::move(maker_input) };
+            // Get the input UTXOs: the maker inputs must come first, in order
+            nlohmann::json::array_t tx_inputs;
+            amount maker_satoshi;
+            for (size_t i = 0; i < proposal_inputs.size(); ++i) {
+                tx_inputs.emplace_back(liquidex_get_maker_input(*m_tx, i, proposal_inputs[i]));
+                maker_satoshi += j_amountref(proposal_inputs[i]);
+            }
             std::set<std::string> asset_ids{ maker_asset_id, taker_asset_id, m_net_params.get_policy_asset() };
             for (const auto& asset_id : asset_ids) {
                 add_asset_utxos(utxos, asset_id, tx_inputs);
             }
 
-            auto maker_addressee = liquidex_get_maker_addressee(m_net_params, *m_tx, proposal_output);
+            // The maker outputs must likewise come first, in order
+            nlohmann::json::array_t addressees;
+            for (size_t i = 0; i < proposal_outputs.size(); ++i) {
+                addressees.emplace_back(liquidex_get_maker_addressee(m_net_params, *m_tx, i, proposal_outputs[i]));
+            }
             nlohmann::json taker_addressee = std::move(m_receive_address);
             m_receive_address["used"] = true; // Make sure m_receive_address.empty() isn't true
             taker_addressee["asset_id"] = maker_asset_id; // Taker is receiving the makers asset
-            taker_addressee["satoshi"] = j_amountref(proposal_input).value();
-            nlohmann::json::array_t addressees = { std::move(maker_addressee), std::move(taker_addressee) };
+            taker_addressee["satoshi"] = maker_satoshi.value();
+            addressees.emplace_back(std::move(taker_addressee));
 
             nlohmann::json create_details
                 = { { "addressees", std::move(addressees) }, { "transaction_version", m_tx->get_version() },
@@ -348,7 +537,20 @@ namespace green {
     bool validate_call::is_liquidex() const { return m_details.contains(LIQUIDEX_STR); }
     void validate_call::liquidex_impl()
     {
-        const auto& proposal = m_details.at(LIQUIDEX_STR).at("proposal");
+        const auto& liquidex_details = m_details.at(LIQUIDEX_STR);
+        if (const auto p = liquidex_details.find("proposals"); p != liquidex_details.end()) {
+            // Batch validation: results are returned per proposal, and
+            // the batch is only valid if every proposal is
+            auto results = liquidex_validate_proposals(*p);
+            const bool all_valid = std::all_of(results.begin(), results.end(),
+                [](const nlohmann::json& result) { return result.at("is_valid").get<bool>(); });
+            if (!all_valid) {
+                m_result["errors"].emplace_back("one or more proposals are invalid");
+            }
+            m_result[LIQUIDEX_STR] = { { "results", std::move(results) } };
+            return;
+        }
+        const auto& proposal = liquidex_details.at("proposal");
         liquidex_validate_proposal(proposal);
     }
 
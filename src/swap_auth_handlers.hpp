@@ -8,6 +8,18 @@ namespace green {
 
     class Tx;
 
+    // Validate an array of LiquiDEX v1 proposals, returning a result
+    // for each proposal in the same order. Proposals are validated in
+    // parallel, and identical proposals are only validated once. A proposal
+    // spending a maker input of an earlier valid proposal is invalid.
+    nlohmann::json::array_t liquidex_validate_proposals(const nlohmann::json& proposals);
+
+    // Aggregate the "scalar" of each LiquiDEX maker input less that of its
+    // paired output, removing them. Returns the aggregate split into random
+    // shares, one per output, for the taker to apply when blinding.
+    nlohmann::json::array_t liquidex_aggregate_scalars(
+        nlohmann::json::array_t& inputs, nlohmann::json::array_t& outputs);
+
     class create_swap_transaction_call : public auth_handler_impl {
     public:
         create_swap_transaction_call(session& session, const nlohmann::json& details);
@@ -19,7 +31,7 @@ namespace green {
         state_type liquidex_impl();
 
         nlohmann::json m_details;
-        nlohmann::json m_receive_address;
+        std::vector<nlohmann::json> m_receive_addresses;
         nlohmann::json m_create_details;
         bool m_is_signed;
     };
@@ -318,6 +318,10 @@ public class Session {
         return try jsonFuncToCallHandlerWrapper(input: details, fun: GA_get_transactions)
     }
 
+    public func queryTransactions(details: [String: Any]) throws -> TwoFactorCall {
+        return try jsonFuncToCallHandlerWrapper(input: details, fun: GA_query_transactions)
+    }
+
     public func getUnspentOutputs(details: [String: Any]) throws -> TwoFactorCall {
         return try jsonFuncToCallHandlerWrapper(input: details, fun: GA_get_unspent_outputs)
     }
@@ -370,6 +374,10 @@ public class Session {
         return try jsonFuncToJsonWrapper(input: input, fun: GA_convert_amount)
     }
 
+    public func convertAmounts(input: [String: Any]) throws -> [String: Any]? {
+        return try jsonFuncToJsonWrapper(input: input, fun: GA_convert_amounts)
+    }
+
     public func createTransaction(details: [String: Any]) throws -> TwoFactorCall {
         return try jsonFuncToCallHandlerWrapper(input: details, fun: GA_create_transaction)
     }
@@ -590,6 +598,16 @@ public func getNetworks() throws -> [String: Any]? {
     return try convertOpaqueJsonToDict(o: result!)
 }
 
+public func getMetrics(details: [String: Any]) throws -> [String: Any]? {
+    var details_json: OpaquePointer = try convertDictToJSON(dict: details)
+    defer {
+        GA_destroy_json(details_json)
+    }
+    var result: OpaquePointer? = nil
+    try callWrapper(fun: GA_get_metrics(details_json, &result))
+    return try convertOpaqueJsonToDict(o: result!)
+}
+
 public func getUniformUInt32(upper_bound: UInt32) throws -> UInt32 {
     var result: UInt32 = 0
     try callWrapper(fun: GA_get_uniform_uint32_t(upper_bound, &result))
@@ -499,6 +499,7 @@ LOCALFUNC jbyteArray create_array(JNIEnv *jenv, const unsigned char* p, size_t l
 %returns_struct(GA_cache_control, GA_json)
 %returns_void__(GA_connect)
 %returns_struct(GA_convert_amount, GA_json)
+%returns_struct(GA_convert_amounts, GA_json)
 %returns_string(GA_convert_json_to_string)
 %returns_string(GA_convert_json_value_to_string)
 %returns_struct(GA_convert_string_to_json, GA_json)
@@ -526,6 +527,7 @@ LOCALFUNC jbyteArray create_array(JNIEnv *jenv, const unsigned char* p, size_t l
 %returns_struct(GA_get_balance, GA_auth_handler)
 %returns_struct(GA_get_credentials, GA_auth_handler)
 %returns_struct(GA_get_fee_estimates, GA_json)
+%returns_struct(GA_get_metrics, GA_json)
 %returns_struct(GA_get_networks, GA_json)
 %returns_struct(GA_get_previous_addresses, GA_auth_handler)
 %returns_array_(GA_get_random_bytes, 2, 3, jarg1)
@@ -536,6 +538,7 @@ LOCALFUNC jbyteArray create_array(JNIEnv *jenv, const unsigned char* p, size_t l
 %returns_struct(GA_update_subaccount, GA_auth_handler)
 %returns_string(GA_get_system_message)
 %returns_struct(GA_get_transactions, GA_auth_handler)
+%returns_struct(GA_query_transactions, GA_auth_handler)
 %returns_struct(GA_get_twofactor_config, GA_json)
 %returns_struct(GA_get_unspent_outputs, GA_auth_handler)
 %returns_struct(GA_get_unspent_outputs_for_private_key, GA_auth_handler)
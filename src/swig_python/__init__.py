@@ -200,6 +200,9 @@ class Session(object):
     def get_transactions(self, details={'subaccount': 0, 'first': 0, 'count': 30}):
         return Call(get_transactions(self.session_obj, self._to_json(details)))
 
+    def query_transactions(self, details):
+        return Call(query_transactions(self.session_obj, self._to_json(details)))
+
     def get_receive_address(self, details=None):
         details = details or {}
         return Call(get_receive_address(self.session_obj, self._to_json(details)))
@@ -222,6 +225,9 @@ class Session(object):
     def convert_amount(self, details):
         return json.loads(convert_amount(self.session_obj, self._to_json(details)))
 
+    def convert_amounts(self, details):
+        return json.loads(convert_amounts(self.session_obj, self._to_json(details)))
+
     def get_balance(self, details={'subaccount': 0, 'num_confs': 0}):
         return Call(get_balance(self.session_obj, self._to_json(details)))
 
@@ -340,6 +346,10 @@ _old_get_networks = get_networks
 def get_networks():
     return json.loads(_old_get_networks())
 
+_old_get_metrics = get_metrics
+def get_metrics(details={}):
+    return json.loads(_old_get_metrics(Session._to_json(details)))
+
 _old_register_network = register_network
 def register_network(name, details):
     return _old_register_network(name, Session._to_json(details))
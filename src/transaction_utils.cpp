@@ -433,12 +433,12 @@ namespace green {
         return script;
     }
 
-    void set_tx_error(nlohmann::json& result, const std::string& error, bool overwrite)
+    void set_tx_error(nlohmann::json& result, std::string_view error, bool overwrite)
     {
         GDK_RUNTIME_ASSERT(!error.empty());
         auto& e = result["error"];
         if (overwrite || e.empty() || e.get<std::string>().empty()) {
-            e = error;
+            e = std::string(error);
         }
         if (!result.contains("transaction_inputs")) {
             // Callers expect to have transaction_inputs present even when an
@@ -733,7 +733,7 @@ namespace green {
                 } catch (const user_error& ex) {
                     return ex.what();
                 } catch (const std::exception& ex) {
-                    return res::id_invalid_amount;
+                    return std::string(res::id_invalid_amount);
                 }
             }
 
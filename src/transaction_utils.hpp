@@ -59,7 +59,7 @@ namespace green {
     void utxo_remove_wallet_keys(nlohmann::json& utxo);
 
     // Set the error in a transaction, if it hasn't been set already
-    void set_tx_error(nlohmann::json& result, const std::string& error, bool overwrite = false);
+    void set_tx_error(nlohmann::json& result, std::string_view error, bool overwrite = false);
 
     // Add a UTXO to a transaction, and optionally to "transaction_inputs".
     // Sets "sequence" and "user_path" in the source UTXO, and creates dummy
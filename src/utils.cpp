@@ -10,9 +10,12 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -44,6 +47,7 @@
 #include "gsl_wrapper.hpp"
 #include "json_utils.hpp"
 #include "memory.hpp"
+#include "metrics.hpp"
 #include "network_parameters.hpp"
 #include "signer.hpp"
 #include "utils.hpp"
@@ -242,6 +246,7 @@ namespace green {
 
     nlohmann::json rust_call(const std::string& method, const nlohmann::json& details, void* session)
     {
+        metrics::scoped_timer timer("rust." + method);
         return rust_call_impl(method, details, session);
     }
 
@@ -274,6 +279,21 @@ namespace green {
         }
     }
 
+    nlohmann::json spv_verify_txs(const nlohmann::json& details)
+    {
+        const size_t num_txs = details.at("txs").size();
+        try {
+            auto spv_results = rust_call("spv_verify_txs", details);
+            GDK_RUNTIME_ASSERT(spv_results.is_array() && spv_results.size() == num_txs);
+            GDK_LOG(debug) << "spv_verify_txs: verified " << num_txs << " txs";
+            return spv_results;
+        } catch (const std::exception& e) {
+            GDK_LOG(warning) << "spv_verify_txs exception:" << e.what();
+            const nlohmann::json disabled = { { "spv_status", SPV_STATUS_DISABLED } };
+            return nlohmann::json(num_txs, disabled);
+        }
+    }
+
     std::string spv_get_status_string(uint32_t spv_status)
     {
         GDK_RUNTIME_ASSERT_MSG(spv_status < SPV_STATUS_NAMES.size(), "Unknown SPV status");
@@ -303,6 +323,58 @@ namespace green {
         return m_entropy[m_index];
     }
 
+    namespace {
+        // Threads available to parallel_for_each_index beyond its calling
+        // threads. Shared by all calls, so that concurrent calls (e.g. from
+        // several sessions) together use at most one thread per core
+        std::atomic_size_t num_free_worker_threads{ std::max(std::thread::hardware_concurrency(), 1u) - 1 };
+
+        // Take up to 'wanted' free worker threads, returning the number taken
+        static size_t take_worker_threads(size_t wanted)
+        {
+            size_t available = num_free_worker_threads.load();
+            size_t taken;
+            do {
+                taken = std::min(wanted, available);
+            } while (taken && !num_free_worker_threads.compare_exchange_weak(available, available - taken));
+            return taken;
+        }
+    } // namespace
+
+    void parallel_for_each_index(size_t count, const std::function<void(size_t)>& fn)
+    {
+        const size_t num_workers = count > 1 ? take_worker_threads(count - 1) : 0;
+        const auto release_workers = gsl::finally([num_workers] { num_free_worker_threads += num_workers; });
+
+        std::atomic_size_t next_index{ 0 };
+        std::atomic_bool has_failed{ false };
+        std::exception_ptr first_error;
+        auto worker_fn = [&next_index, &has_failed, &first_error, count, &fn] {
+            try {
+                for (size_t i = next_index++; i < count && !has_failed; i = next_index++) {
+                    fn(i);
+                }
+            } catch (...) {
+                // Stop all workers from starting new calls, keeping the first error
+                if (!has_failed.exchange(true)) {
+                    first_error = std::current_exception();
+                }
+            }
+        };
+        std::vector<std::future<void>> workers;
+        workers.reserve(num_workers);
+        for (size_t i = 0; i < num_workers; ++i) {
+            workers.emplace_back(std::async(std::launch::async, worker_fn));
+        }
+        worker_fn(); // Run on the calling thread as well
+        for (auto& worker : workers) {
+            worker.get();
+        }
+        if (first_error) {
+            std::rethrow_exception(first_error);
+        }
+    }
+
     std::string decrypt_mnemonic(const std::string& encrypted_mnemonic, const std::string& password)
     {
         if (password.empty()) {
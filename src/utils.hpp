@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <string>
 
 #include "ga_wally.hpp"
@@ -44,6 +45,12 @@ namespace green {
         size_t m_index;
     };
 
+    // Call fn(i) for each i in [0, count), spreading the calls across up
+    // to one thread per core, shared by all concurrent callers. Once fn
+    // throws no further calls are started, and the first exception thrown
+    // is rethrown once any calls already running have returned.
+    void parallel_for_each_index(size_t count, const std::function<void(size_t)>& fn);
+
     bool nsee_log_info(std::string message, const char* context);
     std::string get_diagnostic_information(const boost::exception& e);
 
@@ -140,6 +147,12 @@ namespace green {
     // Return the SPV verification status of a tx
     uint32_t spv_verify_tx(const nlohmann::json& details);
 
+    // Return the SPV verification status of each of the txs in details["txs"],
+    // given as {"txid", "height"} elements with an optional "block_hash" of
+    // a previous verification. Each result is a {"spv_status"} element with
+    // the "block_hash" the tx was verified in, if known.
+    nlohmann::json spv_verify_txs(const nlohmann::json& details);
+
     // Convert an SPV status into one of:
     // "in_progress", "verified", "not_verified", "disabled", "not_longest", "unconfirmed"
     std::string spv_get_status_string(uint32_t spv_status);
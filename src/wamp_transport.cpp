@@ -81,14 +81,14 @@ namespace green {
 
         void write(wlog::level l, const std::string& s)
         {
-            if (dynamic_test(l)) {
+            if (dynamic_test(l) && is_log_enabled(get_severity_level(l))) {
                 BOOST_LOG_SEV(m_log, get_severity_level(l)) << s;
             }
         }
 
         void write(wlog::level l, char const* s)
         {
-            if (dynamic_test(l)) {
+            if (dynamic_test(l) && is_log_enabled(get_severity_level(l))) {
                 BOOST_LOG_SEV(m_log, get_severity_level(l)) << s;
             }
         }
@@ -301,9 +301,10 @@ namespace green {
 
     nlohmann::json wamp_cast_json(const autobahn::wamp_call_result& result) { return wamp_cast_json_impl(result); }
 
-    wamp_transport::wamp_transport(const network_parameters& net_params, boost::asio::io_context::strand& strand,
-        wamp_transport::notify_fn_t fn, std::string server_prefix, bool is_mandatory)
+    wamp_transport::wamp_transport(const network_parameters& net_params, boost::asio::io_context& io,
+        wamp_transport::strand_t& strand, wamp_transport::notify_fn_t fn, std::string server_prefix, bool is_mandatory)
         : m_net_params(net_params)
+        , m_io(io)
         , m_strand(strand)
         , m_server_prefix(std::move(server_prefix))
         , m_server(m_net_params.get_connection_string(m_server_prefix))
@@ -332,7 +333,7 @@ namespace green {
         if (!m_net_params.is_tls_connection(m_server_prefix)) {
             m_client = std::make_unique<client>();
             m_client->set_pong_timeout_handler(std::bind(&wamp_transport::heartbeat_timeout_cb, this, _1, _2));
-            m_client->init_asio(&m_strand.context());
+            m_client->init_asio(&m_io);
             return;
         }
 
@@ -342,7 +343,7 @@ namespace green {
             return tls_init(m_wamp_host_name, m_net_params.gait_wamp_cert_roots(), m_net_params.gait_wamp_cert_pins(),
                 m_net_params.cert_expiry_threshold());
         });
-        m_client_tls->init_asio(&m_strand.context());
+        m_client_tls->init_asio(&m_io);
     }
 
     wamp_transport::~wamp_transport()
@@ -510,7 +511,7 @@ namespace green {
     {
         const bool is_tls = m_net_params.is_tls_connection(m_server_prefix);
         const bool is_debug = j_str_or_empty(gdk_config(), "log_level") == "debug";
-        const auto& executor = m_strand.context().get_executor();
+        const auto executor = m_io.get_executor();
 
         // The last failure number that we handled
         auto last_handled_failure_count = m_failure_count.load();
@@ -604,7 +605,7 @@ namespace green {
                 } else {
                     t = std::make_shared<transport>(*m_client, m_server, proxy, is_debug);
                 }
-                s = std::make_shared<autobahn::wamp_session>(m_strand.context(), is_debug);
+                s = std::make_shared<autobahn::wamp_session>(m_io, is_debug);
                 t->attach(std::static_pointer_cast<autobahn::wamp_transport_handler>(s));
                 bool failed = false;
                 if (no_std_exception_escape(
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/strand.hpp>
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 #include <string>
@@ -11,6 +12,7 @@
 #include "autobahn_wrapper.hpp"
 #include "exception.hpp"
 #include "logging.hpp"
+#include "metrics.hpp"
 #include "threading.hpp"
 
 namespace green {
@@ -47,8 +49,13 @@ namespace green {
         using notify_fn_t = std::function<void(nlohmann::json, bool)>;
         using subscribe_fn_t = std::function<void(nlohmann::json)>;
 
-        wamp_transport(const network_parameters& net_params, boost::asio::io_context::strand& strand, notify_fn_t fn,
-            std::string server_prefix, bool is_mandatory);
+        using strand_t = boost::asio::strand<boost::asio::io_context::executor_type>;
+
+        // The websocket connection and its wamp session run on io, which
+        // must not run handlers concurrently. Notifications are delivered
+        // through the owning sessions strand.
+        wamp_transport(const network_parameters& net_params, boost::asio::io_context& io, strand_t& strand,
+            notify_fn_t fn, std::string server_prefix, bool is_mandatory);
         ~wamp_transport();
 
         // Connect the transport. The proxy to use is passed to us as it can
@@ -78,6 +85,7 @@ namespace green {
         // The session mutex must not be held when calling this function.
         template <typename... Args> autobahn::wamp_call_result call(const std::string& method_name, Args&&... args)
         {
+            metrics::scoped_timer timer("wamp." + method_name);
             const std::string method{ m_wamp_call_prefix + method_name };
             auto st = get_session_and_transport();
             if (!st.first || !st.second) {
@@ -95,6 +103,33 @@ namespace green {
             return call(method_name, std::forward<Args>(args)...);
         }
 
+        // Make the same background WAMP call num_calls times, returning the
+        // results in order. The calls are pipelined so that they complete
+        // in a single round trip. The session mutex must not be held.
+        template <typename... Args>
+        std::vector<autobahn::wamp_call_result> call_many(
+            size_t num_calls, const std::string& method_name, const Args&... args)
+        {
+            metrics::scoped_timer timer("wamp." + method_name);
+            const std::string method{ m_wamp_call_prefix + method_name };
+            auto st = get_session_and_transport();
+            if (!st.first || !st.second) {
+                throw reconnect_error{};
+            }
+            const auto call_args = std::make_tuple(args...);
+            std::vector<boost::future<autobahn::wamp_call_result>> fns;
+            fns.reserve(num_calls);
+            for (size_t i = 0; i < num_calls; ++i) {
+                fns.emplace_back(st.first->call(method, call_args, m_wamp_call_options));
+            }
+            std::vector<autobahn::wamp_call_result> results;
+            results.reserve(num_calls);
+            for (auto& fn : fns) {
+                results.emplace_back(wamp_process_call(st.second, fn));
+            }
+            return results;
+        }
+
     private:
         using session_ptr = std::shared_ptr<autobahn::wamp_session>;
 
@@ -125,7 +160,8 @@ namespace green {
 
         // These members are immutable after construction
         const network_parameters& m_net_params;
-        boost::asio::io_context::strand& m_strand;
+        boost::asio::io_context& m_io;
+        strand_t& m_strand;
         std::thread m_reconnect_thread; // Runs the reconnection logic
         const std::string m_server_prefix;
         const std::string m_server;
@@ -227,6 +227,40 @@ pub struct SPVVerifyTxParams {
     pub height: u32,
 }
 
+#[derive(Serialize, Deserialize, Debug, Clone, Default)]
+pub struct SPVVerifyTxsItem {
+    /// The `txid` of the transaction to verify
+    pub txid: String,
+
+    /// The `height` of the block containing the transaction to be verified
+    pub height: u32,
+
+    /// The hash of the block the transaction was previously verified in, if any.
+    /// If the block at `height` still has this hash, the transaction is verified
+    /// without fetching its inclusion proof again.
+    #[serde(default)]
+    pub block_hash: Option<String>,
+}
+
+#[derive(Serialize, Deserialize, Debug, Clone, Default)]
+pub struct SPVVerifyTxsParams {
+    #[serde(flatten)]
+    pub params: SPVCommonParams,
+
+    /// The transactions to verify
+    pub txs: Vec<SPVVerifyTxsItem>,
+}
+
+#[derive(Serialize, Debug, Clone)]
+pub struct SPVVerifyTxsResultItem {
+    /// The verification status, as returned by `SPVVerifyTxResult::as_i32`
+    pub spv_status: i32,
+
+    /// The hash of the block the transaction was verified in, if known
+    #[serde(skip_serializing_if = "Option::is_none")]
+    pub block_hash: Option<String>,
+}
+
 #[derive(Serialize, Deserialize, Debug, Clone, Default)]
 pub struct SPVDownloadHeadersParams {
     #[serde(flatten)]
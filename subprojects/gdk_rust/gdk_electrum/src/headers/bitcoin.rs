@@ -14,12 +14,14 @@ use gdk_common::elements::hashes::Hash;
 use gdk_common::log::{info, warn};
 use gdk_common::once_cell::sync::Lazy;
 use std::collections::HashMap;
-use std::fs::{File, OpenOptions};
-use std::io::{Read, Seek, SeekFrom, Write};
+use std::convert::TryInto;
+use std::fs::{File, Metadata, OpenOptions};
+use std::io::{Read, Write};
 use std::iter::FromIterator;
 use std::path::{Path, PathBuf};
 use std::str::FromStr;
-use std::sync::Mutex;
+use std::sync::{Arc, Mutex, Weak};
+use std::time::SystemTime;
 
 pub static HEADERS_FILE_MUTEX: Lazy<HashMap<Network, Mutex<()>>> = Lazy::new(|| {
     HashMap::from_iter([
@@ -30,9 +32,70 @@ pub static HEADERS_FILE_MUTEX: Lazy<HashMap<Network, Mutex<()>>> = Lazy::new(||
     ])
 });
 
+/// Size of a serialized block header
+const HEADER_LEN: usize = 80;
+
+/// Offset and length of the merkle root within a serialized block header
+const MERKLE_ROOT_OFFSET: usize = 36;
+const MERKLE_ROOT_LEN: usize = 32;
+
+/// A chain file's contents as loaded into memory, with the size and modification time the file
+/// had when they were loaded or last written by us
+struct LoadedHeaders {
+    headers: Weak<Vec<u8>>,
+    len: u64,
+    modified: SystemTime,
+}
+
+/// The contents of each loaded chain file, keyed by path. Shared between every `HeadersChain`
+/// opened on the same file, so re-opening a chain does not re-read the file. Only weak references
+/// are kept, so a chain's headers are freed once no `HeadersChain` holds them. Access to a given
+/// chain file is serialized by `HEADERS_FILE_MUTEX`.
+static LOADED_HEADERS: Lazy<Mutex<HashMap<PathBuf, LoadedHeaders>>> =
+    Lazy::new(|| Mutex::new(HashMap::new()));
+
+/// Record `headers` as the contents of the chain file at `path`, as described by `metadata`
+fn cache_headers(
+    loaded: &mut HashMap<PathBuf, LoadedHeaders>,
+    path: &Path,
+    headers: &Arc<Vec<u8>>,
+    metadata: &Metadata,
+) -> Result<(), Error> {
+    loaded.retain(|_, l| l.headers.strong_count() > 0);
+    let entry = LoadedHeaders {
+        headers: Arc::downgrade(headers),
+        len: metadata.len(),
+        modified: metadata.modified()?,
+    };
+    loaded.insert(path.to_path_buf(), entry);
+    Ok(())
+}
+
+/// Return the serialized headers in the chain file at `path`, reading the file only if it is not
+/// loaded already or its size or modification time have changed since it was loaded
+fn load_headers(path: &Path) -> Result<Arc<Vec<u8>>, Error> {
+    let mut file = File::open(path)?;
+    let metadata = file.metadata()?;
+    let mut loaded = LOADED_HEADERS.lock()?;
+    if let Some(l) = loaded.get(path) {
+        if l.len == metadata.len() && l.modified == metadata.modified()? {
+            if let Some(headers) = l.headers.upgrade() {
+                return Ok(headers);
+            }
+        }
+    }
+    let mut headers = Vec::with_capacity(metadata.len() as usize);
+    file.read_to_end(&mut headers)?;
+    let headers = Arc::new(headers);
+    cache_headers(&mut loaded, path, &headers, &metadata)?;
+    Ok(headers)
+}
+
 #[derive(Debug)]
 pub struct HeadersChain {
     path: PathBuf,
+    /// Every header in the chain, serialized back to back and indexed by height
+    headers: Arc<Vec<u8>>,
     height: u32,
     last: block::Header,
     checkpoints: HashMap<u32, BlockHash>,
@@ -52,12 +115,16 @@ impl HeadersChain {
         if !filepath.exists() {
             info!("{:?} chain file doesn't exist, creating", filepath);
             let last = genesis_block(network).header;
+            let serialized = serialize(&last);
             let mut file = File::create(&filepath)?;
-            file.write_all(&serialize(&last))?;
+            file.write_all(&serialized)?;
             let height = 0;
+            let headers = Arc::new(serialized);
+            cache_headers(&mut *LOADED_HEADERS.lock()?, &filepath, &headers, &file.metadata()?)?;
 
             Ok(HeadersChain {
                 path: filepath,
+                headers,
                 height,
                 last,
                 checkpoints,
@@ -65,24 +132,16 @@ impl HeadersChain {
             })
         } else {
             info!("{:?} chain file exists, reading", filepath);
-            let mut file = File::open(&filepath)?;
-            let file_size = file.metadata()?.len();
-            if file_size % 80 != 0 || file_size < 80 {
+            let headers = load_headers(&filepath)?;
+            if headers.len() % HEADER_LEN != 0 || headers.len() < HEADER_LEN {
                 return Err(Error::InvalidHeaders);
             }
-            let wanted_seek = file_size - 80;
-            let effective_seek = file.seek(SeekFrom::Start(wanted_seek))?;
-            if wanted_seek != effective_seek {
-                warn!("Seek failed wanted:{} effective:{}", wanted_seek, effective_seek);
-                return Err(Error::Generic("failed seek".into()));
-            }
-            let mut buf = [0u8; 80];
-            file.read_exact(&mut buf)?;
-            let height = (file_size as u32 / 80) - 1;
-            let last: block::Header = deserialize(&buf)?;
+            let height = (headers.len() / HEADER_LEN) as u32 - 1;
+            let last: block::Header = deserialize(&headers[headers.len() - HEADER_LEN..])?;
 
             Ok(HeadersChain {
                 path: filepath,
+                headers,
                 height,
                 last,
                 checkpoints,
@@ -126,30 +185,44 @@ impl HeadersChain {
         }
     }
 
+    /// The serialized header at `height`
+    fn get_bytes(&self, height: u32) -> Result<&[u8], Error> {
+        let start = height as usize * HEADER_LEN;
+        self.headers
+            .get(start..start + HEADER_LEN)
+            .ok_or_else(|| Error::Generic(format!("no header at height {}", height)))
+    }
+
     pub fn get(&self, height: u32) -> Result<block::Header, Error> {
-        let mut file = File::open(&self.path)?;
-        let wanted_seek = height as u64 * 80;
-        let effective_seek = file.seek(SeekFrom::Start(wanted_seek))?;
-        if wanted_seek != effective_seek {
-            warn!("Seek failed wanted:{} effective:{}", wanted_seek, effective_seek);
-            return Err(Error::Generic("failed seek".into()));
-        }
-        let mut buf = [0u8; 80];
-        file.read_exact(&mut buf)?;
-        let header: block::Header = deserialize(&buf)?;
-        Ok(header)
+        Ok(deserialize(self.get_bytes(height)?)?)
+    }
+
+    /// The merkle root of the header at `height`, without deserializing the whole header
+    pub fn get_merkle_root(&self, height: u32) -> Result<TxMerkleNode, Error> {
+        let bytes = self.get_bytes(height)?;
+        let merkle_root = &bytes[MERKLE_ROOT_OFFSET..MERKLE_ROOT_OFFSET + MERKLE_ROOT_LEN];
+        Ok(TxMerkleNode::from_byte_array(merkle_root.try_into().expect("merkle root is 32 bytes")))
+    }
+
+    /// Apply `f` to our headers after `file` has been written, updating the shared copy
+    fn update_headers<F: FnOnce(&mut Vec<u8>)>(&mut self, file: &File, f: F) -> Result<(), Error> {
+        let mut loaded = LOADED_HEADERS.lock()?;
+        // The cache holds only a weak reference, so unless another chain shares our headers
+        // they are updated in place
+        f(Arc::make_mut(&mut self.headers));
+        cache_headers(&mut loaded, &self.path, &self.headers, &file.metadata()?)
     }
 
     /// to handle reorgs, it's necessary to remove some of the last headers
     pub fn remove(&mut self, headers_to_remove: u32) -> Result<(), Error> {
         let headers_to_remove = headers_to_remove.min(self.height);
         let new_height = self.height - headers_to_remove;
-        let new_size = (new_height + 1) as u64 * 80;
+        let new_size = (new_height + 1) as usize * HEADER_LEN;
         let file = OpenOptions::new().write(true).open(&self.path)?;
         self.last = self.get(new_height)?;
         self.height = new_height;
-        file.set_len(new_size)?;
-        Ok(())
+        file.set_len(new_size as u64)?;
+        self.update_headers(&file, |headers| headers.truncate(new_size))
     }
 
     pub fn tip(&self) -> block::Header {
@@ -159,7 +232,7 @@ impl HeadersChain {
     /// write new headers to the file if checks are passed
     pub fn push(&mut self, new_headers: Vec<block::Header>) -> Result<(), Error> {
         let mut curr_bits = self.curr_bits()?;
-        let mut serialized = Vec::with_capacity(new_headers.len() * 80);
+        let mut serialized = Vec::with_capacity(new_headers.len() * HEADER_LEN);
         let mut cache = HashMap::new();
         for new_header in new_headers {
             let new_height = self.height + 1;
@@ -228,8 +301,7 @@ impl HeadersChain {
         let calculated_merkle_root =
             TxMerkleNode::from_byte_array(compute_merkle_root(txid.to_byte_array(), merkle)?);
 
-        let header = self.get(height)?;
-        if header.merkle_root == calculated_merkle_root {
+        if self.get_merkle_root(height)? == calculated_merkle_root {
             info!("proof for txid {}, block height {}, merkle root matches", txid, height);
             Ok(())
         } else {
@@ -237,13 +309,14 @@ impl HeadersChain {
         }
     }
 
-    /// write `serialized` bytes to the file, forcing flush so we are sure next `get()` will have
-    /// also this data if requested
+    /// write `serialized` bytes to the file and our in-memory headers, so that the next `get()`
+    /// will also have this data if requested
     fn flush(&mut self, serialized: &mut Vec<u8>) -> Result<(), Error> {
         if !serialized.is_empty() {
             let mut file = OpenOptions::new().append(true).open(&self.path)?;
             file.write_all(&serialized)?;
             file.flush()?;
+            self.update_headers(&file, |headers| headers.extend_from_slice(serialized))?;
             serialized.clear();
         }
         Ok(())
@@ -311,6 +384,12 @@ mod test {
                 .unwrap(),
             chain.get(100).unwrap().block_hash()
         );
+        assert_eq!(chain.get(100).unwrap().merkle_root, chain.get_merkle_root(100).unwrap());
+
+        // Re-opening the chain shares the loaded headers
+        let reopened = HeadersChain::new(&temp, Network::Bitcoin).unwrap();
+        assert_eq!(reopened.height(), 199);
+        assert_eq!(reopened.tip(), chain.tip());
 
         // first non-coinbase tx
         let txid =
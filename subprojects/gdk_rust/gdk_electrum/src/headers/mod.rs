@@ -11,7 +11,7 @@ use gdk_common::elements;
 use gdk_common::log::{debug, info, warn};
 use gdk_common::model::{
     SPVCommonParams, SPVDownloadHeadersParams, SPVDownloadHeadersResult, SPVVerifyTxParams,
-    SPVVerifyTxResult,
+    SPVVerifyTxResult, SPVVerifyTxsItem, SPVVerifyTxsParams,
 };
 use gdk_common::store::{Decryptable, Encryptable};
 use gdk_common::NetworkId;
@@ -122,6 +122,32 @@ pub fn download_headers(
 ///
 /// used to expose SPV functionality through C interface
 pub fn spv_verify_tx(input: &SPVVerifyTxParams) -> Result<SPVVerifyTxResult, Error> {
+    let batch = SPVVerifyTxsParams {
+        params: input.params.clone(),
+        txs: vec![SPVVerifyTxsItem {
+            txid: input.txid.clone(),
+            height: input.height,
+            block_hash: None,
+        }],
+    };
+    Ok(spv_verify_txs(&batch)?.pop().expect("one result per tx").0)
+}
+
+/// Verify a batch of transactions as per `spv_verify_tx`, returning a result for each one.
+///
+/// The headers lock, verified cache, headers chain and electrum client are set up once and
+/// shared by every tx in the batch, and the verified cache is written once at the end.
+///
+/// A failure verifying one tx (e.g. an invalid txid or an unreachable server) marks only that
+/// tx as `Disabled`, the rest of the batch is still verified and cached.
+///
+/// Each result is returned with the hash of the block the tx was verified in, if known, which
+/// callers can persist and pass back as `block_hash` to avoid re-fetching the proof later.
+///
+/// used to expose SPV functionality through C interface
+pub fn spv_verify_txs(
+    input: &SPVVerifyTxsParams,
+) -> Result<Vec<(SPVVerifyTxResult, Option<String>)>, Error> {
     let mut _lock;
     if let NetworkId::Bitcoin(network) = input.params.network.id() {
         // Liquid hasn't a shared headers chain file
@@ -130,64 +156,151 @@ pub fn spv_verify_tx(input: &SPVVerifyTxParams) -> Result<SPVVerifyTxResult, Err
             .expect("unreachable because map populate with every enum variants")
             .lock()?;
     }
-    debug!("spv_verify_tx {:?}", input);
-    let txid = BETxid::from_hex(&input.txid, input.params.network.id())?;
+    debug!("spv_verify_txs {} txs", input.txs.len());
 
     let mut cache = input.params.verified_cache()?;
-    if cache.contains(&txid, input.height)? {
+    let chain = match input.params.bitcoin_network() {
+        Some(_) => Some(input.params.headers_chain()?),
+        None => None,
+    };
+    let mut client = None;
+    let mut cache_updated = false;
+
+    let mut results = Vec::with_capacity(input.txs.len());
+    for tx in input.txs.iter() {
+        let result = verify_txs_item(
+            &input.params,
+            tx,
+            &mut cache,
+            &mut cache_updated,
+            chain.as_ref(),
+            &mut client,
+        );
+        results.push(result.unwrap_or_else(|e| {
+            warn!("failed verifying {} at height {}: {:?}", tx.txid, tx.height, e);
+            (SPVVerifyTxResult::Disabled, None)
+        }));
+    }
+    if cache_updated {
+        cache.flush()?;
+    }
+    Ok(results)
+}
+
+/// Verify a single tx of a `spv_verify_txs` batch, adding it to the verified cache on success
+fn verify_txs_item(
+    params: &SPVCommonParams,
+    tx: &SPVVerifyTxsItem,
+    cache: &mut VerifiedCache,
+    cache_updated: &mut bool,
+    chain: Option<&HeadersChain>,
+    client: &mut Option<Client>,
+) -> Result<(SPVVerifyTxResult, Option<String>), Error> {
+    let txid = BETxid::from_hex(&tx.txid, params.network.id())?;
+    if cache.contains(&txid, tx.height)? {
         info!("verified cache hit for {}", txid);
-        return Ok(SPVVerifyTxResult::Verified);
+        let block_hash = match chain {
+            Some(chain) => chain.get(tx.height).ok().map(|h| h.block_hash().to_string()),
+            None => None,
+        };
+        return Ok((SPVVerifyTxResult::Verified, block_hash));
+    }
+    let expected_hash = tx.block_hash.as_deref();
+    let result = verify_tx(params, &txid, tx.height, expected_hash, chain, client)?;
+    if let SPVVerifyTxResult::Verified = result.0 {
+        cache.insert(&txid, tx.height);
+        *cache_updated = true;
     }
+    Ok(result)
+}
 
-    let client = input.params.build_client()?;
+/// Return the electrum client, connecting on first use
+fn get_client<'a>(
+    params: &SPVCommonParams,
+    client: &'a mut Option<Client>,
+) -> Result<&'a Client, Error> {
+    if client.is_none() {
+        *client = Some(params.build_client()?);
+    }
+    Ok(client.as_ref().expect("client set above"))
+}
 
-    match input.params.network.id() {
+fn verify_tx(
+    params: &SPVCommonParams,
+    txid: &BETxid,
+    height: u32,
+    expected_hash: Option<&str>,
+    chain: Option<&HeadersChain>,
+    client: &mut Option<Client>,
+) -> Result<(SPVVerifyTxResult, Option<String>), Error> {
+    match params.network.id() {
         NetworkId::Bitcoin(_bitcoin_network) => {
-            let chain = input.params.headers_chain().expect("match verified we are bitcoin type");
+            let chain = chain.expect("headers chain is loaded on bitcoin");
 
-            if input.height <= chain.height() {
+            if height <= chain.height() {
+                let block_hash = chain.get(height)?.block_hash().to_string();
+                if expected_hash == Some(block_hash.as_str()) {
+                    info!("block {} unchanged since {} was verified", height, txid);
+                    return Ok((SPVVerifyTxResult::Verified, Some(block_hash)));
+                }
                 let btxid = txid.ref_bitcoin().unwrap();
                 info!("chain height ({}) enough to verify, downloading proof", chain.height());
-                let proof = match client.transaction_get_merkle(btxid, input.height as usize) {
+                let client = get_client(params, client)?;
+                let proof = match client.transaction_get_merkle(btxid, height as usize) {
                     Ok(proof) => proof,
                     Err(e) => {
                         warn!("failed fetching merkle inclusion proof for {}: {:?}", txid, e);
-                        return Ok(SPVVerifyTxResult::NotVerified);
+                        return Ok((SPVVerifyTxResult::NotVerified, None));
                     }
                 };
-                if chain.verify_tx_proof(btxid, input.height, proof).is_ok() {
-                    cache.write(&txid, input.height)?;
-                    Ok(SPVVerifyTxResult::Verified)
+                if chain.verify_tx_proof(btxid, height, proof).is_ok() {
+                    Ok((SPVVerifyTxResult::Verified, Some(block_hash)))
                 } else {
-                    Ok(SPVVerifyTxResult::NotVerified)
+                    Ok((SPVVerifyTxResult::NotVerified, None))
                 }
             } else {
                 info!(
                     "chain height ({}) not enough to verify tx at height {}",
                     chain.height(),
-                    input.height
+                    height
                 );
 
-                Ok(SPVVerifyTxResult::InProgress)
+                Ok((SPVVerifyTxResult::InProgress, None))
             }
         }
         NetworkId::Elements(elements_network) => {
-            let proof =
-                match client.transaction_get_merkle(&txid.into_bitcoin(), input.height as usize) {
-                    Ok(proof) => proof,
-                    Err(e) => {
-                        warn!("failed fetching merkle inclusion proof for {}: {:?}", txid, e);
-                        return Ok(SPVVerifyTxResult::NotVerified);
-                    }
-                };
+            let client = get_client(params, client)?;
+            let header_bytes = match client.block_header_raw(height as usize) {
+                Ok(header_bytes) => header_bytes,
+                Err(e) => {
+                    warn!("failed fetching block header at height {}: {:?}", height, e);
+                    return Ok((SPVVerifyTxResult::NotVerified, None));
+                }
+            };
+            let header: elements::BlockHeader = match elements::encode::deserialize(&header_bytes) {
+                Ok(header) => header,
+                Err(e) => {
+                    warn!("invalid block header at height {}: {:?}", height, e);
+                    return Ok((SPVVerifyTxResult::NotVerified, None));
+                }
+            };
+            let block_hash = header.block_hash().to_string();
+            if expected_hash == Some(block_hash.as_str()) {
+                info!("block {} unchanged since {} was verified", height, txid);
+                return Ok((SPVVerifyTxResult::Verified, Some(block_hash)));
+            }
+            let proof = match client.transaction_get_merkle(&txid.into_bitcoin(), height as usize) {
+                Ok(proof) => proof,
+                Err(e) => {
+                    warn!("failed fetching merkle inclusion proof for {}: {:?}", txid, e);
+                    return Ok((SPVVerifyTxResult::NotVerified, None));
+                }
+            };
             let verifier = Verifier::new(elements_network);
-            let header_bytes = client.block_header_raw(input.height as usize)?;
-            let header: elements::BlockHeader = elements::encode::deserialize(&header_bytes)?;
             if verifier.verify_tx_proof(txid.ref_elements().unwrap(), proof, &header).is_ok() {
-                cache.write(&txid, input.height)?;
-                Ok(SPVVerifyTxResult::Verified)
+                Ok((SPVVerifyTxResult::Verified, Some(block_hash)))
             } else {
-                Ok(SPVVerifyTxResult::NotVerified)
+                Ok((SPVVerifyTxResult::NotVerified, None))
             }
         }
     }
@@ -249,9 +362,9 @@ impl VerifiedCache {
         Ok(self.set.contains(&(txid.clone(), height)))
     }
 
-    fn write(&mut self, txid: &BETxid, height: u32) -> Result<(), Error> {
+    /// Add a verified tx without persisting it, call `flush` afterwards
+    fn insert(&mut self, txid: &BETxid, height: u32) {
         self.set.insert((txid.clone(), height));
-        self.flush()
     }
 
     /// remove all verified txid with height greater than given height
@@ -272,3 +385,56 @@ impl VerifiedCache {
         Ok(())
     }
 }
+
+#[cfg(test)]
+mod test {
+    use super::{spv_verify_txs, ParamsMethods};
+    use gdk_common::be::BETxid;
+    use gdk_common::model::{
+        SPVCommonParams, SPVVerifyTxResult, SPVVerifyTxsItem, SPVVerifyTxsParams,
+    };
+    use gdk_common::network::NetworkParameters;
+    use tempfile::TempDir;
+
+    #[test]
+    fn test_spv_verify_txs_partial_failure() {
+        let temp = TempDir::new().unwrap();
+        let mut network = NetworkParameters::default(); // bitcoin testnet
+        network.state_dir = temp.path().to_str().unwrap().to_string();
+        let params = SPVCommonParams {
+            network,
+            timeout: None,
+            encryption_key: Some("key".to_string()),
+        };
+        // A fresh headers chain only contains the genesis block, a tx at height 0 with a
+        // matching block hash verifies without contacting the server
+        let genesis_hash = params.headers_chain().unwrap().get(0).unwrap().block_hash().to_string();
+        let txid = "4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b";
+        let batch = SPVVerifyTxsParams {
+            params: params.clone(),
+            txs: vec![
+                SPVVerifyTxsItem {
+                    txid: "not a txid".to_string(),
+                    height: 0,
+                    block_hash: None,
+                },
+                SPVVerifyTxsItem {
+                    txid: txid.to_string(),
+                    height: 0,
+                    block_hash: Some(genesis_hash.clone()),
+                },
+            ],
+        };
+
+        let results = spv_verify_txs(&batch).unwrap();
+        assert_eq!(results.len(), 2);
+        assert!(matches!(results[0], (SPVVerifyTxResult::Disabled, None)));
+        assert!(matches!(results[1].0, SPVVerifyTxResult::Verified));
+        assert_eq!(results[1].1.as_deref(), Some(genesis_hash.as_str()));
+
+        // the verified tx has been persisted despite the failure in the same batch
+        let cache = params.verified_cache().unwrap();
+        let txid = BETxid::from_hex(txid, params.network.id()).unwrap();
+        assert!(cache.contains(&txid, 0).unwrap());
+    }
+}
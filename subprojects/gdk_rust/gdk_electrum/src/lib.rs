@@ -1060,21 +1060,23 @@ impl ElectrumSession {
         let store = self.store()?;
         let store = store.lock()?;
         let accounts = self.get_accounts()?;
-        for account in accounts.iter() {
-            let account_cache = store.account_cache(account.num())?;
-            if let Ok(path) = account_cache.get_path(&script) {
-                let (is_internal, pointer) = parse_path(path)?;
-                return Ok(ScriptPubKeyData {
-                    subaccount: account.num(),
-                    branch: 1,
-                    pointer: pointer,
-                    subtype: 0,
-                    is_internal: is_internal,
-                    address_type: account.script_type().to_string(),
-                });
-            }
-        }
-        return Err(Error::ScriptPubkeyNotFound);
+        find_scriptpubkey_data(&store, &accounts, &script)?.ok_or(Error::ScriptPubkeyNotFound)
+    }
+
+    /// Look up multiple scriptpubkeys holding the store lock once.
+    /// Returns `None` for each scriptpubkey that is not in the wallet.
+    pub fn get_scriptpubkeys_data(
+        &self,
+        script_pubkeys: &[String],
+    ) -> Result<Vec<Option<ScriptPubKeyData>>, Error> {
+        let scripts = script_pubkeys
+            .iter()
+            .map(|s| BEScript::from_hex(s, self.network.id()))
+            .collect::<Result<Vec<_>, _>>()?;
+        let store = self.store()?;
+        let store = store.lock()?;
+        let accounts = self.get_accounts()?;
+        scripts.iter().map(|script| find_scriptpubkey_data(&store, &accounts, script)).collect()
     }
 
     pub fn set_transaction_memo(&self, txid: &str, memo: &str) -> Result<(), Error> {
@@ -1963,6 +1965,28 @@ fn unblind_output(
     }
 }
 
+fn find_scriptpubkey_data(
+    store: &StoreMeta,
+    accounts: &[Account],
+    script: &BEScript,
+) -> Result<Option<ScriptPubKeyData>, Error> {
+    for account in accounts.iter() {
+        let account_cache = store.account_cache(account.num())?;
+        if let Ok(path) = account_cache.get_path(script) {
+            let (is_internal, pointer) = parse_path(path)?;
+            return Ok(Some(ScriptPubKeyData {
+                subaccount: account.num(),
+                branch: 1,
+                pointer: pointer,
+                subtype: 0,
+                is_internal: is_internal,
+                address_type: account.script_type().to_string(),
+            }));
+        }
+    }
+    Ok(None)
+}
+
 fn wait_or_close(user_wants_to_sync: &Arc<AtomicBool>, interval: u32) -> bool {
     for _ in 0..(interval * 2) {
         if !user_wants_to_sync.load(Ordering::Relaxed) {
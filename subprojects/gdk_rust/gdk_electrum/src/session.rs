@@ -119,6 +119,10 @@ impl Session for ElectrumSession {
                     Error::Generic("get_scriptpubkey_data: input is not a string".into())
                 })?)
                 .to_json(),
+            "get_scriptpubkeys_data" => {
+                let script_pubkeys: Vec<String> = serde_json::from_value(input)?;
+                self.get_scriptpubkeys_data(&script_pubkeys).to_json()
+            }
             "broadcast_transaction" => self
                 .broadcast_transaction(input.as_str().ok_or_else(|| {
                     Error::Generic("broadcast_transaction: input not a string".into())
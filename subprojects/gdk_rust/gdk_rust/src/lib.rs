@@ -14,7 +14,10 @@ use std::str::FromStr;
 use std::sync::Once;
 use std::time::{Instant, SystemTime, UNIX_EPOCH};
 
-use gdk_common::model::{InitParam, SPVDownloadHeadersParams, SPVVerifyTxParams};
+use gdk_common::model::{
+    InitParam, SPVDownloadHeadersParams, SPVVerifyTxParams, SPVVerifyTxsParams,
+    SPVVerifyTxsResultItem,
+};
 
 use crate::error::Error;
 use gdk_common::log::{self, debug, info, LevelFilter, Metadata, Record};
@@ -315,6 +318,17 @@ fn handle_call(method: &str, input: &str) -> Result<String, Error> {
             let param: SPVVerifyTxParams = serde_json::from_str(input)?;
             to_string(&headers::spv_verify_tx(&param)?.as_i32())
         }
+        "spv_verify_txs" => {
+            let param: SPVVerifyTxsParams = serde_json::from_str(input)?;
+            let results = headers::spv_verify_txs(&param)?
+                .into_iter()
+                .map(|(result, block_hash)| SPVVerifyTxsResultItem {
+                    spv_status: result.as_i32(),
+                    block_hash,
+                })
+                .collect::<Vec<_>>();
+            to_string(&results)
+        }
         "spv_download_headers" => {
             let param: SPVDownloadHeadersParams = serde_json::from_str(input)?;
             to_string(&headers::download_headers(&param)?)
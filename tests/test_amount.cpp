@@ -0,0 +1,183 @@
+// Verify amount conversions against a high precision decimal reference,
+// for each denomination and at the edges of the valid range
+#include "src/amount.hpp"
+#include "src/assertion.hpp"
+#include "src/exception.hpp"
+#include "src/utils.hpp"
+#include <algorithm>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <cstring>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <vector>
+
+using namespace green;
+
+namespace {
+    using decimal = boost::multiprecision::cpp_dec_float_50;
+    using signed_value_type = amount::signed_value_type;
+
+    const signed_value_type MAX_SATOSHI = amount::get_max_satoshi();
+    const decimal COIN("100000000");
+
+    // Format with dp decimal places, rounding to nearest with ties to even
+    std::string ref_fmt(const decimal& value, size_t dp)
+    {
+        return value.str(dp, std::ios_base::fixed | std::ios_base::showpoint);
+    }
+
+    // The rate rounded to 8 DP, as format_amount does
+    decimal ref_rate(const std::string& rate_str) { return decimal(ref_fmt(decimal(rate_str), 8)); }
+
+    uint64_t random_u64()
+    {
+        const auto bytes = get_random_bytes<sizeof(uint64_t)>();
+        uint64_t v;
+        std::memcpy(&v, bytes.data(), sizeof(v));
+        return v;
+    }
+
+    signed_value_type random_satoshi()
+    {
+        const auto range = static_cast<uint64_t>(MAX_SATOSHI) * 2 + 1;
+        return static_cast<signed_value_type>(random_u64() % range) - MAX_SATOSHI;
+    }
+
+    // A rate with up to 5 integer and up to 10 decimal digits
+    std::string random_rate()
+    {
+        auto rate = std::to_string(random_u64() % 100000);
+        if (const size_t num_decimals = random_u64() % 11; num_decimals) {
+            const auto decimals = std::to_string(random_u64() % 10000000000);
+            rate += "." + (std::string(10, '0') + decimals).substr(decimals.size(), num_decimals);
+        }
+        return rate;
+    }
+
+    bool check(const std::string& what, const std::string& actual, const std::string& expected)
+    {
+        if (actual == expected) {
+            return true;
+        }
+        std::cerr << what << ": got " << actual << ", expected " << expected << std::endl;
+        return false;
+    }
+
+    bool check_conversion(signed_value_type satoshi, const std::string& rate_str)
+    {
+        const fiat_rate rate(rate_str);
+        const auto j = amount::convert({ { "satoshi", satoshi } }, "USD", rate);
+        const decimal value(satoshi);
+        const auto what = std::to_string(satoshi) + " @ " + rate_str;
+        bool ok = j.at("satoshi") == satoshi && j.at("fiat_rate") == rate_str;
+        ok &= check(what + " btc", j.at("btc"), ref_fmt(value / COIN, 8));
+        ok &= check(what + " mbtc", j.at("mbtc"), ref_fmt(value / 100000, 5));
+        ok &= check(what + " ubtc", j.at("ubtc"), ref_fmt(value / 100, 2));
+        ok &= check(what + " bits", j.at("bits"), ref_fmt(value / 100, 2));
+        ok &= check(what + " sats", j.at("sats"), std::to_string(satoshi));
+        ok &= check(what + " fiat", j.at("fiat"), ref_fmt(ref_rate(rate_str) * value / COIN, 2));
+
+        // Each denomination converts back to the same satoshi amount
+        for (const auto* key : { "btc", "mbtc", "ubtc", "bits", "sats" }) {
+            const auto back = amount::convert({ { key, j.at(key) } }, "USD", rate);
+            ok &= check(what + " from " + key, std::to_string(back.at("satoshi").get<signed_value_type>()),
+                std::to_string(satoshi));
+        }
+        return ok;
+    }
+
+    template <typename FN> bool throws_user_error(FN&& fn)
+    {
+        try {
+            fn();
+        } catch (const user_error&) {
+            return true;
+        }
+        return false;
+    }
+} // namespace
+
+int main()
+{
+    const std::vector<signed_value_type> edge_satoshis = { 0, 1, -1, 49, 50, -50, 99, 12345678, -12345678,
+        MAX_SATOSHI, -MAX_SATOSHI, MAX_SATOSHI - 1, -MAX_SATOSHI + 1 };
+    const std::vector<std::string> edge_rates = { "0.00000001", "1", "1.10000000", "12345.6789", "65432.10987654",
+        // More than 8 DP: rounded to nearest, with ties to even
+        "0.000000004", "0.000000005", "0.000000015", "0.123456785", "0.1234567851", "99999.999999999" };
+
+    bool ok = true;
+    for (const auto& rate : edge_rates) {
+        for (const auto satoshi : edge_satoshis) {
+            ok &= check_conversion(satoshi, rate);
+        }
+    }
+    for (size_t i = 0; i < 20000; ++i) {
+        ok &= check_conversion(random_satoshi(), random_rate());
+    }
+
+    // Rates are held with 8 DP, rounded as format_amount does
+    for (const auto& rate_str : edge_rates) {
+        const auto expected = std::to_string(fiat_rate(rate_str).value());
+        auto rate_8dp = amount::format_amount(rate_str, 8);
+        rate_8dp.erase(std::remove(rate_8dp.begin(), rate_8dp.end(), '.'), rate_8dp.end());
+        ok &= check("rate " + rate_str, std::to_string(std::stoull(rate_8dp)), expected);
+    }
+    ok &= fiat_rate("0.000000005").value() == 0;
+    ok &= fiat_rate("0.000000015").value() == 2;
+    ok &= fiat_rate("0.1234567851").value() == 12345679;
+    ok &= fiat_rate("99999.999999999").value() == 10000000000000;
+    // Fiat values round to the nearest cent with ties to even
+    ok &= check("tie down", amount::convert({ { "satoshi", 125 } }, "USD", fiat_rate("1000000")).at("fiat"), "1.25");
+    ok &= check("tie even", amount::convert({ { "satoshi", 5 } }, "USD", fiat_rate("2500000")).at("fiat"), "0.12");
+    ok &= check("tie odd", amount::convert({ { "satoshi", 7 } }, "USD", fiat_rate("2500000")).at("fiat"), "0.18");
+
+    // Small negative amounts which round to zero keep their sign
+    ok &= check("negative zero", amount::convert({ { "satoshi", -1 } }, "USD", fiat_rate("1")).at("fiat"), "-0.00");
+
+    // BTC inputs with more than 8 DP are truncated to whole satoshi
+    const fiat_rate rate("10000");
+    ok &= amount::convert({ { "btc", "0.123456789" } }, "USD", rate).at("satoshi") == 12345678;
+    ok &= amount::convert({ { "btc", "-0.123456789" } }, "USD", rate).at("satoshi") == -12345678;
+    // Fiat inputs convert using the rate
+    ok &= amount::convert({ { "fiat", "1.00" } }, "USD", rate).at("satoshi") == 10000;
+
+    // Asset amounts are formatted with the asset's precision
+    const std::string asset_id(64, 'a');
+    for (int precision = 0; precision <= 8; ++precision) {
+        const nlohmann::json asset_info = { { "asset_id", asset_id }, { "precision", precision } };
+        for (const auto satoshi : edge_satoshis) {
+            const auto j = amount::convert({ { "satoshi", satoshi }, { "asset_info", asset_info } }, "", fiat_rate());
+            decimal divisor(1);
+            for (int i = 0; i < precision; ++i) {
+                divisor *= 10;
+            }
+            const auto expected
+                = precision ? ref_fmt(decimal(satoshi) / divisor, precision) : std::to_string(satoshi);
+            ok &= check("asset precision " + std::to_string(precision), j.at(asset_id), expected);
+        }
+    }
+
+    // Amounts beyond the maximum are rejected, in either direction
+    for (const auto satoshi : { MAX_SATOSHI + 1, -MAX_SATOSHI - 1 }) {
+        ok &= throws_user_error([&] { amount::convert({ { "satoshi", satoshi } }, "USD", rate); });
+        const nlohmann::json batch = { { "satoshi", nlohmann::json::array({ satoshi }) } };
+        ok &= throws_user_error([&] { amount::convert_batch(batch, "USD", rate); });
+    }
+
+    // Batch conversion gives the same results as converting singly
+    nlohmann::json satoshis = edge_satoshis;
+    const auto batch = amount::convert_batch({ { "satoshi", satoshis } }, "USD", fiat_rate("65432.123456789"));
+    for (size_t i = 0; i < edge_satoshis.size(); ++i) {
+        const auto single
+            = amount::convert({ { "satoshi", edge_satoshis[i] } }, "USD", fiat_rate("65432.123456789"));
+        for (const auto* key : { "btc", "mbtc", "ubtc", "bits", "sats", "fiat" }) {
+            ok &= check(std::string("batch ") + key, batch.at(key).at(i), single.at(key));
+        }
+    }
+
+    if (!ok) {
+        return 1;
+    }
+    std::cout << "amount tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,140 @@
+// Verify that merging a newer server client blob re-applies only our unsynced
+// local changes, and never reverts concurrent edits made by other sessions
+#include "src/assertion.hpp"
+#include "src/client_blob.hpp"
+#include "src/session.hpp"
+#include "src/utils.hpp"
+#include <algorithm>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <vector>
+
+using namespace green;
+
+namespace {
+    // The blob as stored on the server
+    struct server_blob {
+        std::vector<unsigned char> data;
+        std::string hmac;
+    };
+
+    std::string txhash(size_t i) { return b2h(sha256(ustring_span("tx" + std::to_string(i)))); }
+
+    const auto PUBLIC_KEY = ec_public_key_from_private_key(sha256(ustring_span("client blob test")));
+
+    void init_blob(client_blob& blob)
+    {
+        blob.compute_keys(PUBLIC_KEY);
+        blob.set_server_is_mandatory();
+    }
+
+    // Save the blob to the server, as a session does once synced
+    server_blob save(client_blob& blob)
+    {
+        auto saved = blob.save();
+        blob.set_hmac(saved.second.at("hmac"));
+        blob.unset_requires_merge();
+        return { std::move(saved.first), saved.second.at("hmac") };
+    }
+
+    nlohmann::json subaccount(const std::string& name, bool is_hidden)
+    {
+        return { { "name", name }, { "hidden", is_hidden } };
+    }
+
+    bool check(const std::string& what, const nlohmann::json& actual, const nlohmann::json& expected)
+    {
+        if (actual == expected) {
+            return true;
+        }
+        std::cerr << what << ": got " << actual.dump() << ", expected " << expected.dump() << std::endl;
+        return false;
+    }
+} // namespace
+
+int main()
+{
+    nlohmann::json init_config;
+    init_config["datadir"] = ".";
+    gdk_init(init_config);
+
+    const nlohmann::json no_xpubs = nlohmann::json::object();
+
+    // Session A creates the initial blob, which session B then loads
+    client_blob a, b;
+    init_blob(a);
+    init_blob(b);
+    a.update_tx_memos({ { txhash(1), "one" }, { txhash(2), "two" }, { txhash(3), "three" }, { txhash(4), "four" } });
+    a.update_subaccounts_data({ { "1", subaccount("first", false) }, { "2", subaccount("second", false) } }, no_xpubs);
+    auto server = save(a);
+    b.load(server.data, server.hmac);
+
+    // A edits a memo and renames a subaccount, then syncs them to the server
+    a.set_tx_memo(txhash(1), "one from a");
+    a.set_tx_memo(txhash(4), ""); // Removed
+    a.update_subaccounts_data({ { "1", { { "name", "renamed by a" } } } }, no_xpubs);
+    server = save(a);
+
+    // Meanwhile B, whose blob is now outdated, makes its own changes
+    b.set_requires_merge();
+    b.set_tx_memo(txhash(2), "two from b");
+    b.set_tx_memo(txhash(3), ""); // Removed
+    b.set_tx_memo(txhash(5), "five from b");
+    b.update_subaccounts_data({ { "2", { { "hidden", true } } } }, no_xpubs);
+    const auto b_version = b.get_user_version();
+
+    // B merges A's blob: A's changes and B's changes must both be kept.
+    // B's local version is ahead of A's, which must not prevent the merge
+    b.load(server.data, server.hmac);
+    const nlohmann::json expected_memos = { { txhash(1), "one from a" }, { txhash(2), "two from b" },
+        { txhash(5), "five from b" } };
+    const nlohmann::json expected_subaccounts
+        = { { "1", { { "name", "renamed by a" } } }, { "2", subaccount("second", true) } };
+    bool ok = true;
+    ok &= check("merged memos", b.get_tx_memos(), expected_memos);
+    ok &= check("merged subaccounts", b.get_subaccounts_data(), expected_subaccounts);
+    ok &= b.is_modified() && b.get_user_version() > std::max(a.get_user_version(), b_version);
+
+    // When B saves the merged blob, A loads it with nothing reverted
+    server = save(b);
+    a.load(server.data, server.hmac);
+    ok &= check("synced memos", a.get_tx_memos(), expected_memos);
+    ok &= check("synced subaccounts", a.get_subaccounts_data(), expected_subaccounts);
+
+    // Once synced, B no longer re-applies its old changes: a later edit
+    // of the same entries by A is kept when B next merges
+    a.set_tx_memo(txhash(2), "two from a");
+    a.update_subaccounts_data({ { "2", { { "hidden", false } } } }, no_xpubs);
+    server = save(a);
+    b.set_requires_merge();
+    b.set_tx_memo(txhash(6), "six from b");
+    b.load(server.data, server.hmac);
+    ok &= check("later memo", b.get_tx_memo(txhash(2)), "two from a");
+    ok &= check("later subaccount", b.get_subaccount_data(2), { { "name", "second" } });
+    ok &= check("new memo", b.get_tx_memo(txhash(6)), "six from b");
+
+    // Where both sessions edit the same entry while unsynced, the merging
+    // session's edit wins, and the other session's edits elsewhere are kept
+    server = save(b);
+    a.load(server.data, server.hmac);
+    a.set_tx_memo(txhash(1), "one again from a");
+    a.set_tx_memo(txhash(7), "seven from a");
+    server = save(a);
+    b.set_requires_merge();
+    b.set_tx_memo(txhash(1), "one again from b");
+    b.load(server.data, server.hmac);
+    ok &= check("conflicting memo", b.get_tx_memo(txhash(1)), "one again from b");
+    ok &= check("other memo", b.get_tx_memo(txhash(7)), "seven from a");
+
+    // A blob with no unsynced changes is replaced by the server blob as-is
+    server = save(b);
+    a.load(server.data, server.hmac);
+    ok &= check("replaced memos", a.get_tx_memos(), b.get_tx_memos());
+    ok &= !a.is_modified();
+
+    if (!ok) {
+        return 1;
+    }
+    std::cout << "client blob tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,151 @@
+// Verify LiquiDEX maker scalar aggregation and N-input/N-output proposals
+#include "src/assertion.hpp"
+#include "src/ga_tx.hpp"
+#include "src/ga_wally.hpp"
+#include "src/swap_auth_handlers.hpp"
+#include "src/utils.hpp"
+#include <iostream>
+#include <nlohmann/json.hpp>
+
+using namespace green;
+
+namespace {
+    using scalar_t = std::array<unsigned char, EC_SCALAR_LEN>;
+
+    struct maker_side {
+        Tx tx{ 0, WALLY_TX_VERSION_2, true };
+        nlohmann::json::array_t inputs;
+        nlohmann::json::array_t outputs;
+        scalar_t expected; // Sum of the input scalars less the output scalars
+    };
+
+    scalar_t random_scalar()
+    {
+        scalar_t s;
+        do {
+            s = get_random_bytes<EC_SCALAR_LEN>();
+        } while (!ec_scalar_verify(s));
+        return s;
+    }
+
+    // Make the unblinded fields of a maker input or output, as the maker does
+    nlohmann::json make_fields(
+        byte_span_t asset, uint64_t satoshi, const scalar_t& abf, const scalar_t& vbf, std::vector<unsigned char>& gen)
+    {
+        const auto generator = asset_generator_from_bytes(asset, abf);
+        const auto commitment = asset_value_commitment(satoshi, vbf, generator);
+        const auto proof = explicit_rangeproof(satoshi, get_random_bytes<32>(), vbf, commitment, generator);
+        gen.assign(generator.begin(), generator.end());
+        return { { "asset", b2h_rev(asset) }, { "satoshi", satoshi }, { "asset_blinder", b2h_rev(abf) },
+            { "value_blind_proof", b2h(proof) }, { "scalar", b2h(asset_scalar_offset(satoshi, abf, vbf)) } };
+    }
+
+    maker_side make_maker_side(size_t num_pairs)
+    {
+        const auto maker_asset = get_random_bytes<32>();
+        const auto taker_asset = get_random_bytes<32>();
+        std::vector<unsigned char> script(22, 0x1);
+        script[0] = 0x0; // p2wpkh
+        script[1] = 0x14;
+
+        maker_side m;
+        std::vector<unsigned char> generator;
+        for (size_t i = 0; i < num_pairs; ++i) {
+            const uint64_t in_satoshi = 1000 + get_random_bytes<1>()[0];
+            const uint64_t out_satoshi = 2000 + get_random_bytes<1>()[0];
+            const auto in_abf = random_scalar(), in_vbf = random_scalar();
+            const auto out_abf = random_scalar(), out_vbf = random_scalar();
+
+            m.inputs.emplace_back(make_fields(maker_asset, in_satoshi, in_abf, in_vbf, generator));
+            const auto in_scalar = asset_scalar_offset(in_satoshi, in_abf, in_vbf);
+            m.outputs.emplace_back(make_fields(taker_asset, out_satoshi, out_abf, out_vbf, generator));
+            const auto out_scalar = asset_scalar_offset(out_satoshi, out_abf, out_vbf);
+            const auto pair_scalar = ec_scalar_subtract(in_scalar, out_scalar);
+            m.expected = i ? ec_scalar_add(m.expected, pair_scalar) : pair_scalar;
+
+            const auto commitment = asset_value_commitment(out_satoshi, out_vbf, generator);
+            m.tx.add_input(get_random_bytes<32>(), i, 0xffffffff, {});
+            m.tx.add_elements_output_at(i, script, generator, commitment, {}, {}, {});
+        }
+        return m;
+    }
+
+    scalar_t sum_scalars(const nlohmann::json::array_t& scalars)
+    {
+        auto sum = h2b_array<EC_SCALAR_LEN>(scalars.front());
+        for (size_t i = 1; i < scalars.size(); ++i) {
+            sum = ec_scalar_add(sum, h2b(scalars[i]));
+        }
+        return sum;
+    }
+
+    nlohmann::json make_proposal(maker_side& m)
+    {
+        auto scalars = liquidex_aggregate_scalars(m.inputs, m.outputs);
+        return { { "version", 1 }, { "transaction", m.tx.to_hex() }, { "inputs", m.inputs },
+            { "outputs", m.outputs }, { "scalars", std::move(scalars) } };
+    }
+
+    bool is_valid(const nlohmann::json& proposal)
+    {
+        const auto results = liquidex_validate_proposals(nlohmann::json::array({ proposal }));
+        GDK_RUNTIME_ASSERT(results.size() == 1);
+        return results[0].at("is_valid");
+    }
+} // namespace
+
+int main()
+{
+    for (size_t num_pairs = 1; num_pairs <= 4; ++num_pairs) {
+        // The aggregate is split into one valid random share per output,
+        // and the shares sum to the maker's blinding factor imbalance
+        auto m = make_maker_side(num_pairs);
+        auto inputs = m.inputs, outputs = m.outputs;
+        const auto scalars = liquidex_aggregate_scalars(inputs, outputs);
+        GDK_RUNTIME_ASSERT(scalars.size() == num_pairs);
+        for (const auto& scalar : scalars) {
+            GDK_RUNTIME_ASSERT(ec_scalar_verify(h2b(scalar)));
+        }
+        GDK_RUNTIME_ASSERT(sum_scalars(scalars) == m.expected);
+        for (size_t i = 0; i < num_pairs; ++i) {
+            GDK_RUNTIME_ASSERT(!inputs[i].contains("scalar") && !outputs[i].contains("scalar"));
+        }
+        if (num_pairs > 1) {
+            // The split is random, but always has the same sum
+            auto inputs_2 = m.inputs, outputs_2 = m.outputs;
+            const auto scalars_2 = liquidex_aggregate_scalars(inputs_2, outputs_2);
+            GDK_RUNTIME_ASSERT(scalars_2 != scalars);
+            GDK_RUNTIME_ASSERT(sum_scalars(scalars_2) == m.expected);
+        }
+
+        // A proposal of N maker inputs and N maker outputs validates
+        GDK_RUNTIME_ASSERT(is_valid(make_proposal(m)));
+    }
+
+    // Unpaired inputs and outputs are rejected when aggregating
+    auto m = make_maker_side(2);
+    auto unpaired_outputs = m.outputs;
+    unpaired_outputs.pop_back();
+    bool threw = false;
+    try {
+        liquidex_aggregate_scalars(m.inputs, unpaired_outputs);
+    } catch (const std::exception&) {
+        threw = true;
+    }
+    GDK_RUNTIME_ASSERT(threw);
+
+    // Proposals with mismatched input, output or scalar counts are invalid
+    const auto proposal = make_proposal(m);
+    for (const auto* key : { "inputs", "outputs", "scalars" }) {
+        auto bad_proposal = proposal;
+        bad_proposal[key].erase(bad_proposal[key].size() - 1);
+        GDK_RUNTIME_ASSERT(!is_valid(bad_proposal));
+    }
+    // As are proposals with invalid scalars
+    auto bad_proposal = proposal;
+    bad_proposal["scalars"][0] = b2h(std::array<unsigned char, EC_SCALAR_LEN>{});
+    GDK_RUNTIME_ASSERT(!is_valid(bad_proposal));
+
+    std::cout << "liquidex swap tests passed" << std::endl;
+    return 0;
+}
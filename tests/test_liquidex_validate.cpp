@@ -0,0 +1,88 @@
+// Validate synthetic LiquiDEX proposals in bulk, reporting throughput
+#include "src/assertion.hpp"
+#include "src/ga_tx.hpp"
+#include "src/swap_auth_handlers.hpp"
+#include "src/utils.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <nlohmann/json.hpp>
+
+using namespace green;
+
+// Make a proposal with num_pairs maker inputs and outputs
+static nlohmann::json make_proposal(uint32_t n, size_t num_pairs = 1)
+{
+    const auto maker_asset = get_random_bytes<32>();
+    const auto taker_asset = get_random_bytes<32>();
+    std::vector<unsigned char> script(22, 0x1);
+    script[0] = 0x0; // p2wpkh
+    script[1] = 0x14;
+
+    // Maker inputs spending synthetic outpoints, and blinded maker outputs
+    Tx tx(0, WALLY_TX_VERSION_2, true);
+    nlohmann::json inputs = nlohmann::json::array(), outputs = nlohmann::json::array();
+    nlohmann::json scalars = nlohmann::json::array();
+    for (size_t i = 0; i < num_pairs; ++i) {
+        const auto abf = get_random_bytes<32>();
+        const auto vbf = get_random_bytes<32>();
+        const uint64_t satoshi = 1000 + n;
+
+        const auto generator = asset_generator_from_bytes(taker_asset, abf);
+        const auto commitment = asset_value_commitment(satoshi, vbf, generator);
+        const auto nonce = get_random_bytes<32>();
+        const auto value_blind_proof = explicit_rangeproof(satoshi, nonce, vbf, commitment, generator);
+
+        const auto txhash = sha256(gsl::make_span(reinterpret_cast<const unsigned char*>(&n), sizeof(n)));
+        tx.add_input(txhash, i, 0xffffffff, {});
+        tx.add_elements_output_at(i, script, generator, commitment, {}, {}, {});
+
+        inputs.push_back({ { "asset", b2h_rev(maker_asset) }, { "satoshi", 5000 },
+            { "asset_blinder", b2h_rev(get_random_bytes<32>()) } });
+        outputs.push_back({ { "asset", b2h_rev(taker_asset) }, { "satoshi", satoshi },
+            { "asset_blinder", b2h_rev(abf) }, { "value_blind_proof", b2h(value_blind_proof) } });
+        scalars.push_back(b2h(get_random_bytes<32>()));
+    }
+    return { { "version", 1 }, { "transaction", tx.to_hex() }, { "inputs", std::move(inputs) },
+        { "outputs", std::move(outputs) }, { "scalars", std::move(scalars) } };
+}
+
+int main()
+{
+    const auto p = std::getenv("GDK_NUM_PROPOSALS");
+    const size_t num_proposals = p ? static_cast<size_t>(std::atoi(p)) : 500;
+    GDK_RUNTIME_ASSERT(num_proposals >= 3);
+
+    nlohmann::json proposals = nlohmann::json::array();
+    for (size_t i = 0; i < num_proposals - 2; ++i) {
+        // Include some multi-input/multi-output proposals
+        proposals.push_back(make_proposal(i, i % 10 ? 1 : 3));
+    }
+    // An identical copy of the first proposal
+    proposals.push_back(proposals[0]);
+    // A proposal with a tampered value
+    auto bad_proposal = make_proposal(0);
+    bad_proposal["outputs"][0]["satoshi"] = 1;
+    proposals.push_back(std::move(bad_proposal));
+
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    const auto results = liquidex_validate_proposals(proposals);
+    const std::chrono::duration<double> elapsed = clock::now() - start;
+
+    GDK_RUNTIME_ASSERT(results.size() == num_proposals);
+    for (size_t i = 0; i < num_proposals - 2; ++i) {
+        GDK_RUNTIME_ASSERT(results[i].at("is_valid") == true);
+    }
+    // The copy spends the first proposal's maker inputs, so is rejected
+    GDK_RUNTIME_ASSERT(!results[0].contains("duplicate_of"));
+    GDK_RUNTIME_ASSERT(results[num_proposals - 2].at("is_valid") == false);
+    GDK_RUNTIME_ASSERT(results[num_proposals - 2].at("duplicate_of") == 0);
+    GDK_RUNTIME_ASSERT(!results[num_proposals - 2].at("errors").empty());
+    GDK_RUNTIME_ASSERT(results[num_proposals - 1].at("is_valid") == false);
+    GDK_RUNTIME_ASSERT(!results[num_proposals - 1].at("errors").empty());
+
+    std::cout << "validated " << num_proposals << " proposals in " << elapsed.count() << "s ("
+              << static_cast<uint64_t>(num_proposals / elapsed.count()) << "/s)" << std::endl;
+    return 0;
+}
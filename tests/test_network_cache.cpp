@@ -0,0 +1,49 @@
+// Verify that the shared network cache only holds raw txs under their own
+// txid, and keeps asset details separate for each registry
+#include "src/assertion.hpp"
+#include "src/ga_tx.hpp"
+#include "src/network_cache.hpp"
+#include "src/utils.hpp"
+#include <iostream>
+#include <nlohmann/json.hpp>
+
+using namespace green;
+
+int main()
+{
+    network_cache c("localtest");
+
+    Tx tx(0, WALLY_TX_VERSION_2, false);
+    tx.add_input(get_random_bytes<32>(), 0, 0xffffffff, {});
+    tx.add_output(1000, std::vector<unsigned char>(22, 0x1));
+    const auto txid = tx.get_txid();
+
+    // A tx that does not hash to the requested txid is rejected
+    auto other_txid = txid;
+    other_txid[0] ^= 0x1;
+    bool threw = false;
+    try {
+        c.set_raw_tx(other_txid, tx);
+    } catch (const std::exception&) {
+        threw = true;
+    }
+    GDK_RUNTIME_ASSERT(threw);
+    GDK_RUNTIME_ASSERT(!c.get_raw_tx(other_txid));
+
+    c.set_raw_tx(txid, tx);
+    const auto cached = c.get_raw_tx(txid);
+    GDK_RUNTIME_ASSERT(cached && *cached == tx.to_bytes());
+
+    // Assets cached from one registry are not returned for another
+    const std::string asset_id(64, 'a');
+    const nlohmann::json assets = { { "assets", { { asset_id, { { "name", "test" } } } } },
+        { "icons", nlohmann::json::object() } };
+    c.set_assets("https://registry.one", assets);
+    GDK_RUNTIME_ASSERT(c.get_assets("https://registry.one", { asset_id }) == assets);
+    GDK_RUNTIME_ASSERT(c.get_assets("http://registry.onion", { asset_id }).is_null());
+    c.invalidate_assets();
+    GDK_RUNTIME_ASSERT(c.get_assets("https://registry.one", { asset_id }).is_null());
+
+    std::cout << "network cache tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,216 @@
+// Run concurrent HTTP requests through a local SOCKS5 stand-in proxy
+#include "src/assertion.hpp"
+#include "src/http_client.hpp"
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/write.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace green;
+namespace asio = boost::asio;
+using tcp = asio::ip::tcp;
+using namespace std::literals;
+
+namespace {
+    constexpr size_t NUM_REQUESTS = 16;
+    // Generous timeouts, so that slow machines never cause spurious failures
+    constexpr int REQUEST_TIMEOUT_SECS = 30;
+    constexpr auto WAIT_TIMEOUT = 30s;
+
+    // A minimal SOCKS5 proxy that also serves the proxied HTTP request itself.
+    // Handshakes are held after method selection until open_gate is called.
+    // The destination host name selects the behaviour:
+    //   "refuse.test": reply "connection refused"
+    //   "stall.test": never complete the connect step
+    //   anything else: connect, then answer the request with "ok"
+    class socks_stand_in {
+    public:
+        socks_stand_in()
+            : m_acceptor(m_io, tcp::endpoint(asio::ip::make_address("127.0.0.1"), 0))
+            , m_gate_future(m_gate.get_future().share())
+            , m_thread([this] { run(); })
+        {
+        }
+
+        ~socks_stand_in()
+        {
+            open_gate();
+            // Wake the blocking accept with a final connection
+            m_stopping = true;
+            tcp::socket socket(m_io);
+            socket.connect(m_acceptor.local_endpoint());
+            m_thread.join();
+            for (auto& t : m_connections) {
+                t.join();
+            }
+        }
+
+        std::string uri() const { return "socks5://127.0.0.1:" + std::to_string(m_acceptor.local_endpoint().port()); }
+
+        // The number of handshakes held at the gate
+        size_t num_waiting() const { return m_num_waiting; }
+
+        void open_gate()
+        {
+            std::call_once(m_gate_once, [this] { m_gate.set_value(); });
+        }
+
+    private:
+        void run()
+        {
+            for (;;) {
+                boost::system::error_code ec;
+                tcp::socket socket(m_io);
+                m_acceptor.accept(socket, ec);
+                if (ec || m_stopping) {
+                    return;
+                }
+                m_connections.emplace_back([this, s = std::move(socket)]() mutable { serve(std::move(s)); });
+            }
+        }
+
+        void serve(tcp::socket socket)
+        {
+            try {
+                // Method selection: version 5, 1 method, no authentication
+                std::array<unsigned char, 3> methods;
+                asio::read(socket, asio::buffer(methods));
+                GDK_RUNTIME_ASSERT(methods[0] == 0x5);
+                ++m_num_waiting;
+                m_gate_future.wait();
+                const std::array<unsigned char, 2> method_reply = { 0x5, 0x0 };
+                asio::write(socket, asio::buffer(method_reply));
+
+                // Connect request using a domain name destination
+                std::array<unsigned char, 5> header;
+                asio::read(socket, asio::buffer(header));
+                GDK_RUNTIME_ASSERT(header[1] == 0x1 && header[3] == 0x3);
+                std::vector<unsigned char> destination(header[4] + sizeof(uint16_t));
+                asio::read(socket, asio::buffer(destination));
+                const std::string host(destination.begin(), destination.begin() + header[4]);
+
+                if (host == "stall.test") {
+                    std::this_thread::sleep_for(3s);
+                    return;
+                }
+                const unsigned char status = host == "refuse.test" ? 0x5 : 0x0;
+                const std::array<unsigned char, 10> connect_reply = { 0x5, status, 0x0, 0x1, 0, 0, 0, 0, 0, 0 };
+                asio::write(socket, asio::buffer(connect_reply));
+                if (status != 0x0) {
+                    return;
+                }
+
+                // Serve the tunnelled HTTP request
+                std::string request;
+                asio::read_until(socket, asio::dynamic_buffer(request), "\r\n\r\n");
+                const std::string response = "HTTP/1.1 200 OK\r\nContent-Length: 2\r\nConnection: close\r\n\r\nok";
+                asio::write(socket, asio::buffer(response));
+            } catch (const std::exception&) {
+                // Client went away
+            }
+        }
+
+        asio::io_context m_io;
+        tcp::acceptor m_acceptor;
+        std::promise<void> m_gate;
+        std::shared_future<void> m_gate_future;
+        std::once_flag m_gate_once;
+        std::atomic<size_t> m_num_waiting{ 0 };
+        std::atomic_bool m_stopping{ false };
+        std::vector<std::thread> m_connections;
+        std::thread m_thread;
+    };
+
+    nlohmann::json make_params(const std::string& host, const std::string& proxy_uri, int timeout_secs)
+    {
+        return { { "host", host }, { "port", "80" }, { "target", "/" }, { "proxy", proxy_uri },
+            { "timeout", timeout_secs } };
+    }
+
+    // Returns the error message of a failed request, or empty on success
+    std::string request_error(
+        asio::io_context& io, const std::string& host, const std::string& proxy_uri, int timeout_secs)
+    {
+        auto client = make_http_client(asio::make_strand(io), nullptr);
+        try {
+            client->request(boost::beast::http::verb::get, make_params(host, proxy_uri, timeout_secs)).get();
+        } catch (const std::exception& e) {
+            std::cout << host << ": " << e.what() << std::endl;
+            return e.what();
+        }
+        return std::string();
+    }
+
+    template <typename PRED> bool wait_for(PRED&& pred)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        while (!pred()) {
+            if (std::chrono::steady_clock::now() - start > WAIT_TIMEOUT) {
+                return false;
+            }
+            std::this_thread::sleep_for(10ms);
+        }
+        return true;
+    }
+} // namespace
+
+int main()
+{
+    socks_stand_in proxy;
+
+    asio::io_context io;
+    auto work = asio::make_work_guard(io);
+    std::vector<std::thread> io_threads;
+    for (size_t i = 0; i < 2; ++i) {
+        io_threads.emplace_back([&io] { io.run(); });
+    }
+
+    // Issuing requests must not block on the proxy handshake, and the
+    // handshakes must proceed in parallel rather than one after another.
+    // The proxy holds every handshake until all of them have started,
+    // which can only happen if neither is the case.
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::shared_ptr<http_client>> clients;
+    std::vector<std::future<nlohmann::json>> results;
+    for (size_t i = 0; i < NUM_REQUESTS; ++i) {
+        const auto host = "host" + std::to_string(i) + ".test";
+        clients.emplace_back(make_http_client(asio::make_strand(io), nullptr));
+        results.emplace_back(clients.back()->request(
+            boost::beast::http::verb::get, make_params(host, proxy.uri(), REQUEST_TIMEOUT_SECS)));
+    }
+    GDK_RUNTIME_ASSERT(wait_for([&proxy] { return proxy.num_waiting() == NUM_REQUESTS; }));
+    proxy.open_gate();
+
+    for (auto& result : results) {
+        GDK_RUNTIME_ASSERT(result.get().at("body") == "ok");
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << NUM_REQUESTS << " proxied requests took "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << "ms" << std::endl;
+
+    // Proxy errors and stalled handshakes are reported, not hung on
+    GDK_RUNTIME_ASSERT(!request_error(io, "refuse.test", proxy.uri(), REQUEST_TIMEOUT_SECS).empty());
+    GDK_RUNTIME_ASSERT(!request_error(io, "stall.test", proxy.uri(), 1).empty());
+
+    // Resolving the proxy host is under the request deadline too: with no
+    // time allowed, the request fails before connecting to the proxy
+    const auto error = request_error(io, "host.test", proxy.uri(), 0);
+    GDK_RUNTIME_ASSERT(error.find("timed out resolving proxy host") != std::string::npos);
+
+    work.reset();
+    for (auto& t : io_threads) {
+        t.join();
+    }
+    return 0;
+}
@@ -0,0 +1,139 @@
+// Verify that cache::query_transactions applies each filter, sort order and
+// page cursor to the indexed tx cache tables
+#include "src/assertion.hpp"
+#include "src/ga_cache.hpp"
+#include "src/memory.hpp"
+#include "src/network_parameters.hpp"
+#include "src/session.hpp"
+#include "src/utils.hpp"
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <vector>
+
+using namespace green;
+
+namespace {
+    constexpr uint32_t SUBACCOUNT = 1;
+
+    struct test_tx {
+        uint64_t timestamp;
+        uint32_t block_height;
+        const char* type;
+        const char* memo;
+        int64_t btc;
+        const char* address;
+    };
+
+    // Ordered by timestamp
+    const std::vector<test_tx> TEST_TXS = {
+        { 100, 10, "incoming", "", 5000, "addr_a" },
+        { 200, 11, "outgoing", "Rent", -12000, "addr_b" },
+        { 300, 12, "incoming", "salary", 70000, "addr_c" },
+        { 400, 12, "redeposit", "", -300, "addr_a" },
+        { 500, 0, "incoming", "", 900, "addr_d" }, // Mempool
+    };
+
+    std::string get_txhash_hex(uint64_t timestamp)
+    {
+        const auto ts = std::to_string(timestamp);
+        return b2h_rev(sha256d(ustring_span(ts)));
+    }
+
+    void insert_tx(cache& c, const test_tx& tx)
+    {
+        const nlohmann::json tx_json = { { "block_height", tx.block_height }, { "type", tx.type },
+            { "memo", tx.memo }, { "satoshi", { { "btc", tx.btc } } },
+            { "outputs", nlohmann::json::array({ { { "address", tx.address } } }) } };
+        c.insert_transaction(SUBACCOUNT, tx.timestamp, get_txhash_hex(tx.timestamp), tx_json);
+    }
+
+    std::vector<uint64_t> query(cache& c, nlohmann::json q)
+    {
+        q["subaccount"] = SUBACCOUNT;
+        std::vector<uint64_t> timestamps;
+        c.query_transactions(q,
+            { [&timestamps](uint64_t ts, const std::string& txhash, uint32_t /*block*/, uint32_t /*spent*/,
+                  uint32_t /*spv_status*/, nlohmann::json& /*tx_json*/) {
+                GDK_RUNTIME_ASSERT(txhash == get_txhash_hex(ts));
+                timestamps.push_back(ts);
+            } });
+        return timestamps;
+    }
+
+    bool check(cache& c, const nlohmann::json& q, const std::vector<uint64_t>& expected)
+    {
+        const auto actual = query(c, q);
+        if (actual == expected) {
+            return true;
+        }
+        std::cerr << "query " << q.dump() << " returned [";
+        for (const auto ts : actual) {
+            std::cerr << " " << ts;
+        }
+        std::cerr << " ]" << std::endl;
+        return false;
+    }
+} // namespace
+
+int main()
+{
+    nlohmann::json init_config;
+    init_config["datadir"] = ".";
+    gdk_init(init_config);
+
+    network_parameters net_params{ network_parameters::get("localtest") };
+    cache c(net_params, "localtest"); // In-memory only, since no db is loaded
+
+    for (const auto& tx : TEST_TXS) {
+        insert_tx(c, tx);
+    }
+    // A tx in another subaccount must never be returned
+    c.insert_transaction(SUBACCOUNT + 1, 250, get_txhash_hex(250),
+        { { "block_height", 11 }, { "type", "incoming" }, { "satoshi", { { "btc", 1 } } } });
+
+    bool ok = true;
+    // Sorting and paging
+    ok &= check(c, {}, { 500, 400, 300, 200, 100 });
+    ok &= check(c, { { "sort_by", "oldest" } }, { 100, 200, 300, 400, 500 });
+    ok &= check(c, { { "count", 2 }, { "first", 1 } }, { 400, 300 });
+    ok &= check(c, { { "asset_id", "btc" }, { "sort_by", "largest" } }, { 300, 200, 100, 500, 400 });
+    ok &= check(c, { { "asset_id", "btc" }, { "sort_by", "smallest" }, { "count", 2 } }, { 400, 500 });
+    // Page cursors, as passed by the session for "newest" and "oldest"
+    ok &= check(c, { { "before_ts", 300 } }, { 200, 100 });
+    ok &= check(c, { { "after_ts", 300 }, { "sort_by", "oldest" } }, { 400, 500 });
+    ok &= check(c, { { "before_ts", 500 }, { "count", 2 } }, { 400, 300 });
+    // Type and address filters
+    ok &= check(c, { { "type", "incoming" } }, { 500, 300, 100 });
+    ok &= check(c, { { "type", "mixed" } }, {});
+    ok &= check(c, { { "address", "addr_a" } }, { 400, 100 });
+    // Time and block filters
+    ok &= check(c, { { "start_ts", 200 }, { "end_ts", 400 } }, { 400, 300, 200 });
+    ok &= check(c, { { "min_block_height", 12 } }, { 400, 300 });
+    ok &= check(c, { { "max_block_height", 11 } }, { 200, 100 }); // Excludes mempool
+    // Amount filters compare absolute values
+    ok &= check(c, { { "asset_id", "btc" }, { "min_satoshi", 5000 } }, { 300, 200, 100 });
+    ok &= check(c, { { "asset_id", "btc" }, { "max_satoshi", 900 } }, { 500, 400 });
+    ok &= check(c, { { "asset_id", "other" } }, {});
+    // Memo filters match either the cached memo or the given txids
+    ok &= check(c, { { "memo_txids", nlohmann::json::array() }, { "memo", "SAL" } }, { 300 });
+    const auto txids = nlohmann::json::array({ get_txhash_hex(100), get_txhash_hex(400) });
+    ok &= check(c, { { "memo_txids", txids } }, { 400, 100 });
+    ok &= check(c, { { "memo_txids", nlohmann::json::array({ txids[0] }) }, { "memo", "rent" } }, { 200, 100 });
+    ok &= check(c, { { "memo_txids", nlohmann::json::array() } }, {});
+    // Many more txids than SQLite allows bound parameters in one statement
+    nlohmann::json many_txids = nlohmann::json::array();
+    for (uint64_t i = 0; i < 40000; ++i) {
+        many_txids.push_back(get_txhash_hex(1000 + i));
+    }
+    many_txids.push_back(get_txhash_hex(200));
+    ok &= check(c, { { "memo_txids", std::move(many_txids) } }, { 200 });
+    // Combined filters
+    ok &= check(c, { { "type", "incoming" }, { "asset_id", "btc" }, { "min_satoshi", 1000 }, { "sort_by", "oldest" } },
+        { 100, 300 });
+
+    if (!ok) {
+        return 1;
+    }
+    std::cout << "tx query tests passed" << std::endl;
+    return 0;
+}
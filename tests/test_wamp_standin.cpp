@@ -0,0 +1,567 @@
+// A local WAMP server stand-in which replays recorded Green backend traffic,
+// for load testing multisig sessions offline.
+//
+// Usage:
+//   test_wamp_standin          Run the load test against an in-process stand-in
+//   test_wamp_standin --serve  Run the stand-in only, until stdin is closed.
+//                              Use with the "localtest" network, or any network
+//                              registered with "wamp_url" set to ws://127.0.0.1:<port>/v2/ws
+//   test_wamp_standin --record <file>
+//                              Log in to the GA_MNEMONIC wallet on GA_NETWORK through
+//                              a proxy to the real server, syncing its transactions and
+//                              UTXOs and waiting GDK_LOAD_SECONDS for events, then write
+//                              the traffic seen to <file> as a recording
+//
+// Recordings are JSON files of the form:
+//   {
+//     "calls": { "com.greenaddress.txs.get_list_v3": [ <result>, ... ], ... },
+//     "events": { "com.greenaddress.blocks": [ <event>, ... ], ... }
+//   }
+// Each call is answered with the next recorded result for its procedure,
+// in order and repeating, independently for each connection. Unrecorded
+// procedures fail with "wamp.error.no_such_procedure". Events are published
+// round-robin to all subscribers of their topic at a configurable rate.
+// The stand-in itself is in wamp_standin.hpp, which bench_wallet also uses
+// to benchmark wallet operations in a logged in multisig session.
+//
+// tests/wamp_standin_recording.json is a minimal recording of a wallet with
+// no transactions, which covers login, tx/UTXO sync and block, ticker and tx
+// events. It is run by ctest with the BIP39 test mnemonic "abandon ... about".
+// It was written by hand rather than recorded: its results are the minimum
+// gdk needs to log in and sync an empty wallet, on a synthetic chain at block
+// height 1000. Use --record to capture the traffic of a real wallet instead.
+//
+// Environment:
+//   GDK_WAMP_RECORDING    Recording file to replay (default: none, so only
+//                         connection and reconnection are tested)
+//   GDK_WAMP_UPSTREAM     Server to proxy to when recording (default: the
+//                         "wamp_url" of GA_NETWORK). Must be a ws:// URL; run
+//                         a TLS terminating proxy in front of wss:// servers
+//   GDK_WAMP_PORT         Port to listen on (default: 8080 for --serve, else any)
+//   GDK_CALL_DELAY_MS     Simulated server latency per call (default 0)
+//   GDK_EVENTS_PER_SEC    Event publishing rate after login (default 100)
+//   GDK_NUM_SESSIONS      Number of concurrent sessions (default 4)
+//   GDK_LOAD_SECONDS      Duration of the event storm (default 2)
+//   GA_NETWORK            Network the recording was made on (default localtest)
+//   GA_MNEMONIC           Mnemonic of the recorded wallet. If given, sessions
+//                         log in, sync transactions/UTXOs and receive events
+#include "src/assertion.hpp"
+#include "src/ga_auth_handlers.hpp"
+#include "src/network_parameters.hpp"
+#include "src/session.hpp"
+#include "src/utils.hpp"
+#include "tests/wamp_standin.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <thread>
+#include <websocketpp/client.hpp>
+#include <websocketpp/config/asio_no_tls.hpp>
+#include <websocketpp/config/asio_no_tls_client.hpp>
+#include <websocketpp/server.hpp>
+
+using namespace green;
+using namespace std::chrono_literals;
+
+namespace {
+
+    static uint64_t envnum(const char* name, const uint64_t default_)
+    {
+        const auto p = std::getenv(name);
+        return p ? static_cast<uint64_t>(std::strtoull(p, nullptr, 10)) : default_;
+    }
+
+    static std::string envstr(const char* name, const std::string& default_)
+    {
+        const auto p = std::getenv(name);
+        return p ? std::string(p) : default_;
+    }
+
+    // A proxy which forwards each connection to an upstream WAMP server,
+    // recording call results and events in the format the stand-in replays
+    class wamp_recorder final {
+    public:
+        using server_t = websocketpp::server<websocketpp::config::asio>;
+        using client_t = websocketpp::client<websocketpp::config::asio_client>;
+        using hdl_t = websocketpp::connection_hdl;
+
+        explicit wamp_recorder(std::string upstream_url)
+            : m_upstream_url(std::move(upstream_url))
+            , m_recording({ { "calls", nlohmann::json::object() }, { "events", nlohmann::json::object() } })
+        {
+            m_server.clear_access_channels(websocketpp::log::alevel::all);
+            m_server.clear_error_channels(websocketpp::log::elevel::all);
+            m_server.init_asio(&m_io);
+            m_server.set_reuse_addr(true);
+            m_server.set_validate_handler([this](hdl_t hdl) { return on_validate(hdl); });
+            m_server.set_open_handler([this](hdl_t hdl) { on_open(hdl); });
+            m_server.set_close_handler([this](hdl_t hdl) { on_close(hdl); });
+            m_server.set_message_handler(
+                [this](hdl_t hdl, server_t::message_ptr msg) { on_client_message(hdl, msg->get_payload()); });
+            m_client.clear_access_channels(websocketpp::log::alevel::all);
+            m_client.clear_error_channels(websocketpp::log::elevel::all);
+            m_client.init_asio(&m_io);
+        }
+
+        wamp_recorder(const wamp_recorder&) = delete;
+        wamp_recorder& operator=(const wamp_recorder&) = delete;
+        wamp_recorder(wamp_recorder&&) = delete;
+        wamp_recorder& operator=(wamp_recorder&&) = delete;
+
+        ~wamp_recorder() { stop(); }
+
+        // Start serving on any port, returning the port used
+        uint16_t start()
+        {
+            using boost::asio::ip::tcp;
+            m_server.listen(tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+            m_server.start_accept();
+            websocketpp::lib::asio::error_code ec;
+            const auto port = m_server.get_local_endpoint(ec).port();
+            GDK_RUNTIME_ASSERT(!ec);
+            m_thread = std::thread([this] { m_io.run(); });
+            return port;
+        }
+
+        void stop()
+        {
+            if (m_thread.joinable()) {
+                boost::asio::post(m_io, [this] {
+                    websocketpp::lib::error_code ec;
+                    m_server.stop_listening(ec);
+                    for (const auto& c : m_connections) {
+                        m_server.close(c.first, websocketpp::close::status::going_away, std::string(), ec);
+                        c.second.upstream->close(websocketpp::close::status::going_away, std::string(), ec);
+                    }
+                });
+                m_thread.join();
+            }
+        }
+
+        // The recorded traffic. Only valid once stopped
+        const nlohmann::json& get_recording() const { return m_recording; }
+
+    private:
+        struct connection {
+            client_t::connection_ptr upstream;
+            bool is_open = false;
+            std::vector<std::string> pending; // Sent before upstream was open
+            std::map<uint64_t, std::string> calls; // request id -> procedure
+            std::map<uint64_t, std::string> subscribing; // request id -> topic
+            std::map<uint64_t, std::string> subscriptions; // id -> topic
+        };
+
+        bool on_validate(hdl_t hdl)
+        {
+            auto con = m_server.get_con_from_hdl(hdl);
+            for (const auto& protocol : con->get_requested_subprotocols()) {
+                if (protocol == "wamp.2.msgpack") {
+                    con->select_subprotocol(protocol);
+                    return true;
+                }
+            }
+            return false; // gdk only speaks msgpack
+        }
+
+        void on_open(hdl_t hdl)
+        {
+            websocketpp::lib::error_code ec;
+            auto upstream = m_client.get_connection(m_upstream_url, ec);
+            if (ec) {
+                std::cerr << "cannot connect to " << m_upstream_url << ": " << ec.message() << std::endl;
+                m_server.close(hdl, websocketpp::close::status::internal_endpoint_error, std::string(), ec);
+                return;
+            }
+            upstream->add_subprotocol("wamp.2.msgpack");
+            upstream->set_open_handler([this, hdl](hdl_t) { on_upstream_open(hdl); });
+            upstream->set_message_handler(
+                [this, hdl](hdl_t, client_t::message_ptr msg) { on_upstream_message(hdl, msg->get_payload()); });
+            upstream->set_close_handler([this, hdl](hdl_t) { close_client(hdl); });
+            upstream->set_fail_handler([this, hdl](hdl_t) { close_client(hdl); });
+            m_connections[hdl].upstream = upstream;
+            m_client.connect(upstream);
+        }
+
+        void on_close(hdl_t hdl)
+        {
+            if (const auto p = m_connections.find(hdl); p != m_connections.end()) {
+                websocketpp::lib::error_code ec;
+                p->second.upstream->close(websocketpp::close::status::going_away, std::string(), ec);
+                m_connections.erase(p);
+            }
+        }
+
+        void close_client(hdl_t hdl)
+        {
+            websocketpp::lib::error_code ec;
+            m_server.close(hdl, websocketpp::close::status::going_away, std::string(), ec);
+        }
+
+        void on_upstream_open(hdl_t hdl)
+        {
+            if (const auto p = m_connections.find(hdl); p != m_connections.end()) {
+                auto& c = p->second;
+                c.is_open = true;
+                for (const auto& payload : c.pending) {
+                    c.upstream->send(payload, websocketpp::frame::opcode::binary);
+                }
+                c.pending.clear();
+            }
+        }
+
+        void on_client_message(hdl_t hdl, const std::string& payload)
+        {
+            const auto p = m_connections.find(hdl);
+            if (p == m_connections.end()) {
+                return;
+            }
+            auto& c = p->second;
+            const auto message = nlohmann::json::from_msgpack(payload);
+            const auto type = message.at(0).get<uint32_t>();
+            if (type == wamp::call) {
+                c.calls[message.at(1).get<uint64_t>()] = message.at(3).get<std::string>();
+            } else if (type == wamp::subscribe) {
+                c.subscribing[message.at(1).get<uint64_t>()] = message.at(3).get<std::string>();
+            }
+            if (c.is_open) {
+                c.upstream->send(payload, websocketpp::frame::opcode::binary);
+            } else {
+                c.pending.push_back(payload);
+            }
+        }
+
+        void on_upstream_message(hdl_t hdl, const std::string& payload)
+        {
+            const auto p = m_connections.find(hdl);
+            if (p == m_connections.end()) {
+                return;
+            }
+            auto& c = p->second;
+            const auto message = nlohmann::json::from_msgpack(payload);
+            switch (message.at(0).get<uint32_t>()) {
+            case wamp::result:
+                // [RESULT, request id, details, args]
+                if (const auto call_p = c.calls.find(message.at(1).get<uint64_t>()); call_p != c.calls.end()) {
+                    m_recording["calls"][call_p->second].push_back(get_arg(message, 3));
+                    c.calls.erase(call_p);
+                }
+                break;
+            case wamp::error:
+                // [ERROR, request type, request id, details, error]. Failed
+                // calls are not recorded, so fail as unknown when replayed
+                c.calls.erase(message.at(2).get<uint64_t>());
+                break;
+            case wamp::subscribed:
+                // [SUBSCRIBED, request id, subscription id]
+                if (const auto sub_p = c.subscribing.find(message.at(1).get<uint64_t>());
+                    sub_p != c.subscribing.end()) {
+                    c.subscriptions[message.at(2).get<uint64_t>()] = sub_p->second;
+                    c.subscribing.erase(sub_p);
+                }
+                break;
+            case wamp::event:
+                // [EVENT, subscription id, publication id, details, args]
+                if (const auto sub_p = c.subscriptions.find(message.at(1).get<uint64_t>());
+                    sub_p != c.subscriptions.end()) {
+                    m_recording["events"][sub_p->second].push_back(get_arg(message, 4));
+                }
+                break;
+            default:
+                break; // Forwarded only
+            }
+            websocketpp::lib::error_code ec;
+            m_server.send(hdl, payload, websocketpp::frame::opcode::binary, ec);
+        }
+
+        // The stand-in replays results and events as a single argument
+        static nlohmann::json get_arg(const nlohmann::json& message, size_t index)
+        {
+            if (message.size() > index && !message[index].empty()) {
+                return message[index][0];
+            }
+            return nlohmann::json();
+        }
+
+        // These members are only accessed from the server thread,
+        // or are immutable after construction
+        const std::string m_upstream_url;
+        nlohmann::json m_recording;
+        boost::asio::io_context m_io;
+        server_t m_server;
+        client_t m_client;
+        std::map<hdl_t, connection, std::owner_less<hdl_t>> m_connections;
+        std::thread m_thread;
+    };
+
+    // A datadir unique to this run, removed when destroyed
+    class temp_datadir final {
+    public:
+        temp_datadir()
+            : m_path(std::filesystem::temp_directory_path() / ("gdk_wamp_standin_" + b2h(get_random_bytes<8>())))
+        {
+            std::filesystem::create_directories(m_path);
+        }
+
+        temp_datadir(const temp_datadir&) = delete;
+        temp_datadir& operator=(const temp_datadir&) = delete;
+
+        ~temp_datadir()
+        {
+            std::error_code ec;
+            std::filesystem::remove_all(m_path, ec);
+        }
+
+        std::string get() const { return m_path.string(); }
+
+    private:
+        const std::filesystem::path m_path;
+    };
+
+    // Notification counts for a session under test
+    struct session_counters {
+        std::atomic<uint32_t> connected{ 0 };
+        std::atomic<uint32_t> blocks{ 0 };
+        std::atomic<uint32_t> notifications{ 0 };
+    };
+
+    static void notification_handler(void* context, GA_json* details)
+    {
+        const std::unique_ptr<nlohmann::json> json(reinterpret_cast<nlohmann::json*>(details));
+        auto& counters = *static_cast<session_counters*>(context);
+        ++counters.notifications;
+        const auto& event = json->at("event");
+        if (event == "network" && json->at("network").at("current_state") == "connected") {
+            ++counters.connected;
+        } else if (event == "block") {
+            ++counters.blocks;
+        }
+    }
+
+    static nlohmann::json process_auth(auth_handler& handler)
+    {
+        while (true) {
+            const auto status_json = handler.get_status();
+            const std::string status = status_json.at("status");
+            if (status == "error") {
+                throw std::runtime_error(status_json.at("error"));
+            } else if (status == "call") {
+                handler.operator()();
+            } else if (status == "done") {
+                return status_json.at("result");
+            } else {
+                throw std::runtime_error("unexpected status " + status);
+            }
+        }
+    }
+
+    // Run fn(i) for each session concurrently, returning the elapsed seconds
+    template <typename FN> static double for_each_session(size_t num_sessions, FN&& fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < num_sessions; ++i) {
+            threads.emplace_back([&fn, i] { fn(i); });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Wait until pred() returns true, or fail after timeout
+    template <typename PRED> static double wait_for(PRED&& pred, std::chrono::seconds timeout)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        while (!pred()) {
+            GDK_RUNTIME_ASSERT_MSG(std::chrono::steady_clock::now() - start < timeout, "timed out");
+            std::this_thread::sleep_for(10ms);
+        }
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    // Register a copy of GA_NETWORK which connects to a local server
+    static nlohmann::json register_local_network(uint16_t port)
+    {
+        auto network = network_parameters::get(envstr("GA_NETWORK", "localtest"));
+        network["wamp_url"] = "ws://127.0.0.1:" + std::to_string(port) + "/v2/ws";
+        network["wamp_onion_url"] = std::string();
+        network["blob_server_url"] = std::string();
+        network["blob_server_onion_url"] = std::string();
+        network_parameters::add("wamp-standin", network);
+        return { { "name", "wamp-standin" } };
+    }
+
+    static void login(session& s, const std::string& mnemonic)
+    {
+        const nlohmann::json credentials = { { "mnemonic", mnemonic } };
+        auto_auth_handler call(new login_user_call(s, nlohmann::json(), credentials));
+        process_auth(call);
+    }
+
+    static void sync(session& s)
+    {
+        const nlohmann::json tx_details = { { "subaccount", 0 }, { "first", 0 }, { "count", 99999 } };
+        auto_auth_handler tx_call(new get_transactions_call(s, tx_details));
+        process_auth(tx_call);
+        const nlohmann::json utxo_details = { { "subaccount", 0 }, { "num_confs", 0 } };
+        auto_auth_handler utxo_call(new get_unspent_outputs_call(s, utxo_details));
+        process_auth(utxo_call);
+    }
+
+    // Record the traffic of a wallet logging in and syncing to path
+    static void record(const std::string& path)
+    {
+        const auto mnemonic = envstr("GA_MNEMONIC", std::string());
+        GDK_RUNTIME_ASSERT_MSG(!mnemonic.empty(), "GA_MNEMONIC must be given to record");
+        const auto network = network_parameters::get(envstr("GA_NETWORK", "localtest"));
+        wamp_recorder recorder(envstr("GDK_WAMP_UPSTREAM", network.at("wamp_url").get<std::string>()));
+        const auto net_params = register_local_network(recorder.start());
+        {
+            session_counters counters;
+            session s;
+            s.set_notification_handler(notification_handler, &counters);
+            s.connect(net_params);
+            login(s, mnemonic);
+            sync(s);
+            // Record any events published while we wait
+            std::this_thread::sleep_for(std::chrono::seconds(envnum("GDK_LOAD_SECONDS", 2)));
+        }
+        recorder.stop();
+        std::ofstream f(path);
+        GDK_RUNTIME_ASSERT_MSG(f.is_open(), "cannot open recording");
+        f << recorder.get_recording().dump(2) << std::endl;
+        std::cout << "recorded to " << path << std::endl;
+    }
+
+    static nlohmann::json load_recording()
+    {
+        nlohmann::json recording = nlohmann::json::object();
+        if (const auto path = envstr("GDK_WAMP_RECORDING", std::string()); !path.empty()) {
+            std::ifstream f(path);
+            GDK_RUNTIME_ASSERT_MSG(f.is_open(), "cannot open recording");
+            recording = nlohmann::json::parse(f);
+        }
+        return recording;
+    }
+
+    // Serve the recording until stdin is closed
+    static void serve()
+    {
+        wamp_standin standin(load_recording(), envnum("GDK_CALL_DELAY_MS", 0));
+        const auto port = standin.start(envnum("GDK_WAMP_PORT", 8080));
+        std::cout << "serving on port " << port << ", close stdin to exit" << std::endl;
+        standin.start_events(envnum("GDK_EVENTS_PER_SEC", 100));
+        while (std::cin.get() != EOF) {
+            // No-op
+        }
+        std::cout << standin.get_stats().dump() << std::endl;
+    }
+
+    // Connect, reconnect, and optionally log in and sync sessions against
+    // an in-process stand-in, returning the timings and counts seen
+    static nlohmann::json run_load_test()
+    {
+        wamp_standin standin(load_recording(), envnum("GDK_CALL_DELAY_MS", 0));
+        const auto net_params = register_local_network(standin.start(envnum("GDK_WAMP_PORT", 0)));
+
+        const size_t num_sessions = envnum("GDK_NUM_SESSIONS", 4);
+        std::vector<std::unique_ptr<session>> sessions(num_sessions);
+        std::vector<session_counters> counters(num_sessions);
+        nlohmann::json results = nlohmann::json::object();
+
+        // Connect all sessions at once
+        results["connect_secs"] = for_each_session(num_sessions, [&](size_t i) {
+            sessions[i] = std::make_unique<session>();
+            sessions[i]->set_notification_handler(notification_handler, &counters[i]);
+            sessions[i]->connect(net_params);
+        });
+
+        const auto all_connected = [&counters] {
+            return std::all_of(counters.begin(), counters.end(), [](const auto& c) { return c.connected > 0; });
+        };
+        const auto num_connections = [&standin] { return standin.get_stats().at("connections").get<uint64_t>(); };
+
+        // Drop all connections and wait for every session to reconnect.
+        // Connected notifications are delivered asynchronously, so wait for
+        // every session to have seen its first one before resetting the counts
+        wait_for([&] { return num_connections() == num_sessions && all_connected(); }, 30s);
+        for (auto& c : counters) {
+            c.connected = 0;
+        }
+        standin.drop_connections();
+        results["reconnect_secs"]
+            = wait_for([&] { return num_connections() >= 2 * num_sessions && all_connected(); }, 120s);
+
+        if (const auto mnemonic = envstr("GA_MNEMONIC", std::string()); !mnemonic.empty()) {
+            // Log in and sync all sessions at once
+            results["login_secs"] = for_each_session(num_sessions, [&](size_t i) { login(*sessions[i], mnemonic); });
+            // Each login notifies the current block
+            const auto all_have_blocks = [&counters] {
+                return std::all_of(counters.begin(), counters.end(), [](const auto& c) { return c.blocks > 0; });
+            };
+            wait_for(all_have_blocks, 30s);
+            results["sync_secs"] = for_each_session(num_sessions, [&](size_t i) { sync(*sessions[i]); });
+
+            // Publish a storm of recorded events to the logged in sessions
+            const auto load_secs = std::chrono::seconds(envnum("GDK_LOAD_SECONDS", 2));
+            const auto count_notifications = [&counters] {
+                uint64_t total = 0;
+                for (const auto& c : counters) {
+                    total += c.notifications;
+                }
+                return total;
+            };
+            const auto notifications_before = count_notifications();
+            standin.start_events(envnum("GDK_EVENTS_PER_SEC", 100));
+            std::this_thread::sleep_for(load_secs);
+            standin.stop_events();
+            const auto event_storm_notifications = count_notifications() - notifications_before;
+            const auto num_events = standin.get_stats().at("events").get<uint64_t>();
+            GDK_RUNTIME_ASSERT_MSG(!num_events || event_storm_notifications, "published events were not notified");
+            results["event_storm_notifications"] = event_storm_notifications;
+        }
+
+        // Destroy the sessions before the stand-in
+        results["disconnect_secs"] = for_each_session(num_sessions, [&](size_t i) { sessions[i].reset(); });
+        results["num_sessions"] = num_sessions;
+        results["server"] = standin.get_stats();
+        return results;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::string mode = argc > 1 ? argv[1] : std::string();
+    if (mode == "--serve") {
+        serve();
+        return 0;
+    }
+
+    // Use a new datadir for each run, so runs never share cached state
+    const temp_datadir datadir;
+    nlohmann::json init_config;
+    init_config["datadir"] = datadir.get();
+    init_config["log_level"] = "none";
+    gdk_init(init_config);
+
+    try {
+        if (mode == "--record") {
+            GDK_RUNTIME_ASSERT_MSG(argc > 2, "usage: test_wamp_standin --record <file>");
+            record(argv[2]);
+        } else {
+            std::cout << run_load_test().dump() << std::endl;
+        }
+    } catch (const std::exception& e) {
+        // Return rather than throw, so the datadir is removed
+        std::cerr << "failed: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,285 @@
+#ifndef GDK_TESTS_WAMP_STANDIN_HPP
+#define GDK_TESTS_WAMP_STANDIN_HPP
+#pragma once
+
+// A local WAMP server which replays recorded Green backend traffic, for
+// running multisig sessions offline. See test_wamp_standin.cpp for the
+// recording format.
+#include "src/assertion.hpp"
+
+#include <atomic>
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <future>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <websocketpp/config/asio_no_tls.hpp>
+#include <websocketpp/server.hpp>
+
+namespace green {
+
+    // WAMP message types used by gdk
+    namespace wamp {
+        constexpr uint32_t hello = 1;
+        constexpr uint32_t welcome = 2;
+        constexpr uint32_t goodbye = 6;
+        constexpr uint32_t error = 8;
+        constexpr uint32_t subscribe = 32;
+        constexpr uint32_t subscribed = 33;
+        constexpr uint32_t unsubscribe = 34;
+        constexpr uint32_t unsubscribed = 35;
+        constexpr uint32_t event = 36;
+        constexpr uint32_t call = 48;
+        constexpr uint32_t result = 50;
+    } // namespace wamp
+
+    class wamp_standin final {
+    public:
+        using server_t = websocketpp::server<websocketpp::config::asio>;
+        using hdl_t = websocketpp::connection_hdl;
+
+        wamp_standin(nlohmann::json recording, uint32_t call_delay_ms)
+            : m_calls(recording.value("calls", nlohmann::json::object()))
+            , m_events(recording.value("events", nlohmann::json::object()))
+            , m_call_delay(call_delay_ms)
+            , m_event_timer(m_io)
+        {
+            m_server.clear_access_channels(websocketpp::log::alevel::all);
+            m_server.clear_error_channels(websocketpp::log::elevel::all);
+            m_server.init_asio(&m_io);
+            m_server.set_reuse_addr(true);
+            m_server.set_validate_handler([this](hdl_t hdl) { return on_validate(hdl); });
+            m_server.set_open_handler([this](hdl_t hdl) { m_clients.emplace(hdl, client()); });
+            m_server.set_close_handler([this](hdl_t hdl) { m_clients.erase(hdl); });
+            m_server.set_message_handler(
+                [this](hdl_t hdl, server_t::message_ptr msg) { on_message(hdl, msg->get_payload()); });
+        }
+
+        wamp_standin(const wamp_standin&) = delete;
+        wamp_standin& operator=(const wamp_standin&) = delete;
+        wamp_standin(wamp_standin&&) = delete;
+        wamp_standin& operator=(wamp_standin&&) = delete;
+
+        ~wamp_standin() { stop(); }
+
+        // Start serving on the given port (0 for any), returning the port used
+        uint16_t start(uint16_t port)
+        {
+            using boost::asio::ip::tcp;
+            m_server.listen(tcp::endpoint(boost::asio::ip::address_v4::loopback(), port));
+            m_server.start_accept();
+            websocketpp::lib::asio::error_code ec;
+            port = m_server.get_local_endpoint(ec).port();
+            GDK_RUNTIME_ASSERT(!ec);
+            m_thread = std::thread([this] { m_io.run(); });
+            return port;
+        }
+
+        void stop()
+        {
+            if (m_thread.joinable()) {
+                boost::asio::post(m_io, [this] {
+                    websocketpp::lib::error_code ec;
+                    m_server.stop_listening(ec);
+                    m_event_timer.cancel();
+                    close_all(websocketpp::close::status::going_away);
+                });
+                m_thread.join();
+            }
+        }
+
+        // Close all client connections, e.g. to test reconnection
+        void drop_connections()
+        {
+            boost::asio::post(m_io, [this] { close_all(websocketpp::close::status::service_restart); });
+        }
+
+        // Publish recorded events at the given rate until stop_events is called
+        void start_events(uint32_t events_per_sec)
+        {
+            if (m_events.empty() || !events_per_sec) {
+                return;
+            }
+            const auto interval = std::chrono::microseconds(1000000 / events_per_sec);
+            boost::asio::post(m_io, [this, interval] {
+                m_event_timer.expires_after(interval);
+                m_event_timer.async_wait([this, interval](auto ec) { on_event_timer(ec, interval); });
+            });
+        }
+
+        void stop_events()
+        {
+            boost::asio::post(m_io, [this] { m_event_timer.cancel(); });
+        }
+
+        // Replace the recorded results for a procedure, e.g. with results
+        // computed from a logged in session. Returns once they are in use
+        void set_results(const std::string& procedure, nlohmann::json results)
+        {
+            GDK_RUNTIME_ASSERT(m_thread.joinable() && results.is_array());
+            std::promise<void> done;
+            boost::asio::post(m_io, [this, &procedure, &results, &done] {
+                m_calls[procedure] = std::move(results);
+                done.set_value();
+            });
+            done.get_future().wait();
+        }
+
+        nlohmann::json get_stats() const
+        {
+            return { { "connections", m_num_connections.load() }, { "calls", m_num_calls.load() },
+                { "call_errors", m_num_call_errors.load() }, { "events", m_num_events.load() } };
+        }
+
+    private:
+        struct client {
+            std::map<uint64_t, std::string> subscriptions; // id -> topic
+            std::map<std::string, size_t> replay_positions; // procedure -> next result
+        };
+
+        bool on_validate(hdl_t hdl)
+        {
+            auto con = m_server.get_con_from_hdl(hdl);
+            for (const auto& protocol : con->get_requested_subprotocols()) {
+                if (protocol == "wamp.2.msgpack") {
+                    con->select_subprotocol(protocol);
+                    ++m_num_connections;
+                    return true;
+                }
+            }
+            return false; // gdk only speaks msgpack
+        }
+
+        void send(hdl_t hdl, const nlohmann::json& message)
+        {
+            const auto data = nlohmann::json::to_msgpack(message);
+            websocketpp::lib::error_code ec;
+            m_server.send(hdl, data.data(), data.size(), websocketpp::frame::opcode::binary, ec);
+            // Sends to a disconnected client are expected and ignored
+        }
+
+        void close_all(websocketpp::close::status::value code)
+        {
+            for (const auto& c : m_clients) {
+                websocketpp::lib::error_code ec;
+                m_server.close(c.first, code, std::string(), ec);
+            }
+        }
+
+        void on_message(hdl_t hdl, const std::string& payload)
+        {
+            const auto message = nlohmann::json::from_msgpack(payload);
+            const auto client_p = m_clients.find(hdl);
+            if (client_p == m_clients.end()) {
+                return;
+            }
+            auto& c = client_p->second;
+            switch (message.at(0).get<uint32_t>()) {
+            case wamp::hello: {
+                nlohmann::json roles
+                    = { { "broker", nlohmann::json::object() }, { "dealer", nlohmann::json::object() } };
+                nlohmann::json details = { { "roles", std::move(roles) } };
+                send(hdl, nlohmann::json::array({ wamp::welcome, ++m_last_id, std::move(details) }));
+                break;
+            }
+            case wamp::goodbye:
+                send(hdl,
+                    nlohmann::json::array({ wamp::goodbye, nlohmann::json::object(), "wamp.close.goodbye_and_out" }));
+                break;
+            case wamp::subscribe: {
+                const uint64_t subscription_id = ++m_last_id;
+                c.subscriptions.emplace(subscription_id, message.at(3).get<std::string>());
+                send(hdl, nlohmann::json::array({ wamp::subscribed, message.at(1), subscription_id }));
+                break;
+            }
+            case wamp::unsubscribe:
+                c.subscriptions.erase(message.at(2).get<uint64_t>());
+                send(hdl, nlohmann::json::array({ wamp::unsubscribed, message.at(1) }));
+                break;
+            case wamp::call:
+                on_call(hdl, c, message.at(1).get<uint64_t>(), message.at(3).get<std::string>());
+                break;
+            default:
+                break; // Ignore anything else
+            }
+        }
+
+        void on_call(hdl_t hdl, client& c, uint64_t request_id, const std::string& procedure)
+        {
+            ++m_num_calls;
+            nlohmann::json reply;
+            const auto results_p = m_calls.find(procedure);
+            if (results_p == m_calls.end() || results_p->empty()) {
+                ++m_num_call_errors;
+                reply = nlohmann::json::array(
+                    { wamp::error, wamp::call, request_id, nlohmann::json::object(), "wamp.error.no_such_procedure" });
+            } else {
+                auto& position = c.replay_positions[procedure];
+                const auto& result = results_p->at(position++ % results_p->size());
+                const auto args = nlohmann::json::array({ result });
+                reply = nlohmann::json::array({ wamp::result, request_id, nlohmann::json::object(), args });
+            }
+            if (m_call_delay.count() == 0) {
+                send(hdl, reply);
+                return;
+            }
+            auto timer = std::make_shared<boost::asio::steady_timer>(m_io, m_call_delay);
+            timer->async_wait([this, hdl, timer, reply = std::move(reply)](auto ec) {
+                if (!ec) {
+                    send(hdl, reply);
+                }
+            });
+        }
+
+        void on_event_timer(const boost::system::error_code& ec, std::chrono::microseconds interval)
+        {
+            if (ec) {
+                return; // Cancelled
+            }
+            for (const auto& topic : m_events.items()) {
+                if (topic.value().empty()) {
+                    continue;
+                }
+                auto& position = m_event_positions[topic.key()];
+                const auto args = nlohmann::json::array({ topic.value().at(position++ % topic.value().size()) });
+                for (const auto& c : m_clients) {
+                    for (const auto& sub : c.second.subscriptions) {
+                        if (sub.second == topic.key()) {
+                            const auto publication_id = ++m_last_id;
+                            send(c.first,
+                                nlohmann::json::array(
+                                    { wamp::event, sub.first, publication_id, nlohmann::json::object(), args }));
+                            ++m_num_events;
+                        }
+                    }
+                }
+            }
+            m_event_timer.expires_at(m_event_timer.expiry() + interval);
+            m_event_timer.async_wait([this, interval](auto ec) { on_event_timer(ec, interval); });
+        }
+
+        // These members are only accessed from the server thread,
+        // or are immutable after construction
+        nlohmann::json m_calls;
+        const nlohmann::json m_events;
+        const std::chrono::milliseconds m_call_delay;
+        boost::asio::io_context m_io;
+        server_t m_server;
+        boost::asio::steady_timer m_event_timer;
+        std::map<hdl_t, client, std::owner_less<hdl_t>> m_clients;
+        std::map<std::string, size_t> m_event_positions;
+        uint64_t m_last_id = 0;
+        std::thread m_thread;
+
+        // Statistics, read from other threads
+        std::atomic<uint64_t> m_num_connections{ 0 };
+        std::atomic<uint64_t> m_num_calls{ 0 };
+        std::atomic<uint64_t> m_num_call_errors{ 0 };
+        std::atomic<uint64_t> m_num_events{ 0 };
+    };
+
+} // namespace green
+
+#endif